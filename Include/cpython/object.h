@@ -246,9 +246,17 @@ struct _specialization_cache {
     // - If getitem->func_version == getitem_version, then getitem can be called
     //   with two positional arguments and no keyword arguments, and has neither
     //   *args nor **kwargs (as required by BINARY_SUBSCR_GETITEM):
+    // - The same rules apply to getattr/getattr_version ("__getattr__", two
+    //   positional arguments, LOAD_ATTR_GETATTR_FALLBACK) and to
+    //   descr_get/descr_get_version ("__get__", three positional arguments,
+    //   LOAD_ATTR_DESCRIPTOR_GET).
     PyObject *getitem;
     uint32_t getitem_version;
     PyObject *init;
+    PyObject *getattr;
+    uint32_t getattr_version;
+    PyObject *descr_get;
+    uint32_t descr_get_version;
 };
 
 /* The *real* layout of a type object when allocated on the heap */
@@ -294,6 +302,10 @@ PyAPI_FUNC(int) PyObject_CallFinalizerFromDealloc(PyObject *);
 
 PyAPI_FUNC(void) PyUnstable_Object_ClearWeakRefsNoCallbacks(PyObject *);
 
+/* Enable deferred reference counting on an object (free-threaded build only).
+   Return 1 if it was enabled, 0 otherwise. */
+PyAPI_FUNC(int) PyUnstable_Object_EnableDeferredRefcount(PyObject *);
+
 /* Same as PyObject_Generic{Get,Set}Attr, but passing the attributes
    dict as the last parameter. */
 PyAPI_FUNC(PyObject *)
@@ -91,6 +91,18 @@ typedef struct _object_stats {
     uint64_t type_cache_dunder_hits;
     uint64_t type_cache_dunder_misses;
     uint64_t type_cache_collisions;
+    uint64_t type_cache_thread_hits;
+    uint64_t type_cache_thread_misses;
+    /* Biased reference counting: objects queued for their owning thread,
+       batches handed over, batches handed over when a thread went idle,
+       merges by owning threads, objects merged by owning threads, and the
+       total time the oldest object of each merge waited (in ns) */
+    uint64_t brc_queued;
+    uint64_t brc_batches;
+    uint64_t brc_idle_flushes;
+    uint64_t brc_merges;
+    uint64_t brc_merged;
+    uint64_t brc_merge_latency_ns;
     /* Temporary value used during GC */
     uint64_t object_visits;
 } ObjectStats;
@@ -151,12 +163,26 @@ typedef struct _rare_event_stats {
     uint64_t watched_globals_modification;
 } RareEventStats;
 
+typedef struct _lock_stats {
+    /* PyMutex acquisitions that found the mutex locked */
+    uint64_t contended;
+    /* Contended acquisitions that succeeded while spinning */
+    uint64_t spin_acquired;
+    /* Calls to _PyParkingLot_Park() from PyMutex */
+    uint64_t parked;
+    /* Unlocks that handed the mutex directly to a waiting thread */
+    uint64_t handoffs;
+    /* Wakeups of a waiter on the waker's NUMA node ahead of older waiters */
+    uint64_t numa_local_wakeups;
+} LockStats;
+
 typedef struct _stats {
     OpcodeStats opcode_stats[256];
     CallStats call_stats;
     ObjectStats object_stats;
     OptimizationStats optimization_stats;
     RareEventStats rare_event_stats;
+    LockStats lock_stats;
     GCStats *gc_stats;
 } PyStats;
 
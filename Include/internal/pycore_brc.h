@@ -28,6 +28,26 @@ struct _brc_bucket {
     struct llist_node root;
 };
 
+// Objects are handed to their owning thread in batches of up to
+// _Py_BRC_BATCH_SIZE objects. Each thread collects objects for up to
+// _Py_BRC_NUM_BATCHES owning threads at once; when one more owning thread
+// shows up, the least recently used batch is handed over.
+#define _Py_BRC_BATCH_SIZE 32
+#define _Py_BRC_NUM_BATCHES 4
+
+// Objects queued by a thread that are owned by thread `tid`
+struct _brc_batch {
+    uintptr_t tid;
+    Py_ssize_t size;
+    // Value of the thread's batch_clock when an object was last added
+    uint64_t last_used;
+    PyObject *objects[_Py_BRC_BATCH_SIZE];
+#ifdef Py_STATS
+    // Time at which the first object was added to the batch
+    PyTime_t first_queued;
+#endif
+};
+
 // Per-interpreter biased reference counting state
 struct _brc_state {
     // Hash table of thread states by thread-id. Thread states within a bucket
@@ -48,6 +68,19 @@ struct _brc_thread_state {
 
     // Local stack of objects to be merged (not accessed by other threads)
     _PyObjectStack local_objects_to_merge;
+
+    // Objects queued by this thread that are not yet handed to their owning
+    // threads (not accessed by other threads, except during GC)
+    struct _brc_batch batches[_Py_BRC_NUM_BATCHES];
+
+    // Incremented each time an object is added to a batch
+    uint64_t batch_clock;
+
+#ifdef Py_STATS
+    // Time at which objects_to_merge became non-empty (protected by bucket
+    // mutex)
+    PyTime_t first_queued;
+#endif
 };
 
 // Initialize/finalize the per-thread biased reference counting state
@@ -66,6 +99,10 @@ void _Py_brc_queue_object(PyObject *ob);
 // Merge the refcounts of queued objects for the current thread.
 void _Py_brc_merge_refcounts(PyThreadState *tstate);
 
+// Hand the objects queued by the current thread to their owning threads, as
+// far as possible without blocking. Called when the thread goes idle.
+void _Py_brc_flush_idle(PyThreadState *tstate);
+
 #endif /* Py_GIL_DISABLED */
 
 #ifdef __cplusplus
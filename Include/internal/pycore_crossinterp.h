@@ -82,6 +82,12 @@ struct _xid {
     // to PyMem_RawFree (the default if not explicitly set to NULL).
     // The call will happen with the original interpreter activated.
     xid_freefunc free;
+    // independent is set if the data does not depend on the original
+    // interpreter: "obj" is NULL and "free" may be called in any
+    // interpreter, even after the original one was destroyed.  This is
+    // the case for data allocated with the raw allocator and shared
+    // between interpreters with a reference count.
+    int independent;
 };
 
 PyAPI_FUNC(_PyCrossInterpreterData *) _PyCrossInterpreterData_New(void);
@@ -90,6 +96,7 @@ PyAPI_FUNC(void) _PyCrossInterpreterData_Free(_PyCrossInterpreterData *data);
 #define _PyCrossInterpreterData_DATA(DATA) ((DATA)->data)
 #define _PyCrossInterpreterData_OBJ(DATA) ((DATA)->obj)
 #define _PyCrossInterpreterData_INTERPID(DATA) ((DATA)->interpid)
+#define _PyCrossInterpreterData_INDEPENDENT(DATA) ((DATA)->independent)
 // Users should not need getters for "new_object" or "free".
 
 
@@ -124,6 +131,13 @@ PyAPI_FUNC(void) _PyCrossInterpreterData_Clear(
     do { \
         (DATA)->new_object = (FUNC); \
     } while (0)
+// Data which is not bound to the original interpreter can be released
+// from any interpreter, and outlives the original interpreter.
+#define _PyCrossInterpreterData_SET_INDEPENDENT(DATA) \
+    do { \
+        assert((DATA)->obj == NULL); \
+        (DATA)->independent = 1; \
+    } while (0)
 
 
 /* using cross-interpreter data */
@@ -50,6 +50,16 @@ PyAPI_FUNC(Py_ssize_t) _PyDict_SizeOf(PyDictObject *);
 
 #define _PyDict_HasSplitTable(d) ((d)->ma_values != NULL)
 
+// types.frozendict: an immutable dict subclass with perfect-hash keys
+extern PyTypeObject _PyFrozenDict_Type;
+#define _PyFrozenDict_CheckExact(op) Py_IS_TYPE((op), &_PyFrozenDict_Type)
+
+typedef struct {
+    PyDictObject dict;
+    Py_hash_t fd_hash;      // cached hash, -1 until first computed
+    char fd_frozen;         // set once frozendict_new() has filled the dict
+} _PyFrozenDictObject;
+
 /* Like PyDict_Merge, but override can be 0, 1 or 2.  If override is 0,
    the first occurrence of a key wins, if override is 1, the last occurrence
    of a key wins, if override is 2, a KeyError with conflicting key as
@@ -148,7 +158,11 @@ struct _dictkeysobject {
     uint8_t dk_log2_index_bytes;
 
     /* Kind of keys */
-    uint8_t dk_kind;
+    uint8_t dk_kind : 2;
+
+    /* Log2 of the number of seeds of perfect-hash keys, 0 for other keys.
+       Shares a byte with dk_kind to keep the header within one word. */
+    uint8_t dk_log2_seeds : 6;
 
 #ifdef Py_GIL_DISABLED
     /* Lock used to protect shared keys */
@@ -47,16 +47,52 @@ _Py_freelists_GET(void)
 
 #define _Py_FREELIST_SIZE(NAME) (int)((_Py_freelists_GET()->NAME).size)
 
+static inline Py_ssize_t
+_PyFreeList_Capacity(struct _Py_freelist *fl, Py_ssize_t maxsize)
+{
+#ifdef Py_GIL_DISABLED
+    return maxsize << fl->scale;
+#else
+    return maxsize;
+#endif
+}
+
+// Called when the free list is full. In the free-threaded build, doubles
+// its capacity if many allocations found it empty since it was last
+// resized: the thread allocates and frees more objects at a time than the
+// free list holds. Returns 1 if the capacity was increased.
+static inline int
+_PyFreeList_Grow(struct _Py_freelist *fl, Py_ssize_t maxsize)
+{
+#ifdef Py_GIL_DISABLED
+    Py_ssize_t recent_misses = fl->misses - fl->misses_at_resize;
+    if (fl->scale < _Py_FREELIST_MAX_SCALE &&
+        recent_misses > _PyFreeList_Capacity(fl, maxsize) / 2)
+    {
+        fl->scale++;
+        fl->misses_at_resize = fl->misses;
+        return 1;
+    }
+#endif
+    return 0;
+}
+
 static inline int
 _PyFreeList_Push(struct _Py_freelist *fl, void *obj, Py_ssize_t maxsize)
 {
-    if (fl->size < maxsize && fl->size >= 0) {
+    if (fl->size < 0) {
+        return 0;
+    }
+    if (fl->size < _PyFreeList_Capacity(fl, maxsize) ||
+        _PyFreeList_Grow(fl, maxsize))
+    {
         *(void **)obj = fl->freelist;
         fl->freelist = obj;
         fl->size++;
         OBJECT_STAT_INC(to_freelist);
         return 1;
     }
+    fl->overflows++;
     return 0;
 }
 
@@ -87,8 +123,12 @@ _PyFreeList_Pop(struct _Py_freelist *fl)
     PyObject *op = _PyFreeList_PopNoStats(fl);
     if (op != NULL) {
         OBJECT_STAT_INC(from_freelist);
+        fl->hits++;
         _Py_NewReference(op);
     }
+    else {
+        fl->misses++;
+    }
     return op;
 }
 
@@ -98,12 +138,19 @@ _PyFreeList_PopMem(struct _Py_freelist *fl)
     void *op = _PyFreeList_PopNoStats(fl);
     if (op != NULL) {
         OBJECT_STAT_INC(from_freelist);
+        fl->hits++;
+    }
+    else {
+        fl->misses++;
     }
     return op;
 }
 
 extern void _PyObject_ClearFreeLists(struct _Py_freelists *freelists, int is_finalization);
 
+// Returns a dict describing the free lists (used by sys._freelist_stats())
+extern PyObject* _PyObject_FreeListStats(struct _Py_freelists *freelists);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,11 @@ extern "C" {
 #  define Py_object_stack_chunks_MAXFREELIST 4
 #  define Py_unicode_writers_MAXFREELIST 1
 
+// In the free-threaded build, a thread's freelist grows up to
+// 2**_Py_FREELIST_MAX_SCALE times its default maximum size when the thread
+// keeps allocating and freeing more objects at a time than the freelist holds.
+#  define _Py_FREELIST_MAX_SCALE 2
+
 // A generic freelist of either PyObjects or other data structures.
 struct _Py_freelist {
     // Entries are linked together using the first word of the object.
@@ -31,6 +36,20 @@ struct _Py_freelist {
 
     // The number of items in the free list or -1 if the free list is disabled
     Py_ssize_t size;
+
+    // Allocations served by the free list, allocations that found it empty
+    // and frees that found it full. Reported by sys._freelist_stats().
+    Py_ssize_t hits;
+    Py_ssize_t misses;
+    Py_ssize_t overflows;
+
+#ifdef Py_GIL_DISABLED
+    // The capacity is the default maximum size shifted left by `scale`
+    int scale;
+
+    // The value of `misses` when the capacity was last changed
+    Py_ssize_t misses_at_resize;
+#endif
 };
 
 struct _Py_freelists {
@@ -225,6 +225,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(__weakref__)
         STRUCT_FOR_ID(__xor__)
         STRUCT_FOR_ID(_abc_impl)
+        STRUCT_FOR_ID(_abort)
         STRUCT_FOR_ID(_abstract_)
         STRUCT_FOR_ID(_active)
         STRUCT_FOR_ID(_anonymous_)
@@ -233,6 +234,8 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(_asyncio_future_blocking)
         STRUCT_FOR_ID(_blksize)
         STRUCT_FOR_ID(_bootstrap)
+        STRUCT_FOR_ID(_cancel_message)
+        STRUCT_FOR_ID(_cancelled)
         STRUCT_FOR_ID(_check_retval_)
         STRUCT_FOR_ID(_dealloc_warn)
         STRUCT_FOR_ID(_feature_version)
@@ -251,10 +254,16 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(_length_)
         STRUCT_FOR_ID(_limbo)
         STRUCT_FOR_ID(_lock_unlock_module)
+        STRUCT_FOR_ID(_log_destroy_pending)
         STRUCT_FOR_ID(_loop)
+        STRUCT_FOR_ID(_make_cancelled_error)
         STRUCT_FOR_ID(_needs_com_addref_)
+        STRUCT_FOR_ID(_on_task_done)
         STRUCT_FOR_ID(_only_immortal)
+        STRUCT_FOR_ID(_repr_info)
         STRUCT_FOR_ID(_restype_)
+        STRUCT_FOR_ID(_run)
+        STRUCT_FOR_ID(_scheduled)
         STRUCT_FOR_ID(_showwarnmsg)
         STRUCT_FOR_ID(_shutdown)
         STRUCT_FOR_ID(_slotnames)
@@ -262,9 +271,11 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(_strptime_datetime_date)
         STRUCT_FOR_ID(_strptime_datetime_datetime)
         STRUCT_FOR_ID(_strptime_datetime_time)
+        STRUCT_FOR_ID(_timer_handle_cancelled)
         STRUCT_FOR_ID(_type_)
         STRUCT_FOR_ID(_uninitialized_submodules)
         STRUCT_FOR_ID(_warn_unawaited_coroutine)
+        STRUCT_FOR_ID(_when)
         STRUCT_FOR_ID(_xoptions)
         STRUCT_FOR_ID(abs_tol)
         STRUCT_FOR_ID(access)
@@ -320,6 +331,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(call_soon)
         STRUCT_FOR_ID(callback)
         STRUCT_FOR_ID(cancel)
+        STRUCT_FOR_ID(cancelled)
         STRUCT_FOR_ID(capath)
         STRUCT_FOR_ID(category)
         STRUCT_FOR_ID(cb_type)
@@ -362,6 +374,8 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(coro)
         STRUCT_FOR_ID(count)
         STRUCT_FOR_ID(covariant)
+        STRUCT_FOR_ID(create_future)
+        STRUCT_FOR_ID(create_task)
         STRUCT_FOR_ID(cwd)
         STRUCT_FOR_ID(data)
         STRUCT_FOR_ID(database)
@@ -402,6 +416,8 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(end_lineno)
         STRUCT_FOR_ID(end_offset)
         STRUCT_FOR_ID(endpos)
+        STRUCT_FOR_ID(ensure_future)
+        STRUCT_FOR_ID(entries)
         STRUCT_FOR_ID(entrypoint)
         STRUCT_FOR_ID(env)
         STRUCT_FOR_ID(errors)
@@ -631,6 +647,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(pi_factory)
         STRUCT_FOR_ID(pid)
         STRUCT_FOR_ID(policy)
+        STRUCT_FOR_ID(popleft)
         STRUCT_FOR_ID(pos)
         STRUCT_FOR_ID(pos1)
         STRUCT_FOR_ID(pos2)
@@ -666,7 +683,9 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(reserved)
         STRUCT_FOR_ID(reset)
         STRUCT_FOR_ID(resetids)
+        STRUCT_FOR_ID(result)
         STRUCT_FOR_ID(return)
+        STRUCT_FOR_ID(return_exceptions)
         STRUCT_FOR_ID(reverse)
         STRUCT_FOR_ID(reversed)
         STRUCT_FOR_ID(salt)
@@ -684,6 +703,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(server_hostname)
         STRUCT_FOR_ID(server_side)
         STRUCT_FOR_ID(session)
+        STRUCT_FOR_ID(set_result)
         STRUCT_FOR_ID(setcomp)
         STRUCT_FOR_ID(setpgroup)
         STRUCT_FOR_ID(setsid)
@@ -769,6 +789,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(wbits)
         STRUCT_FOR_ID(week)
         STRUCT_FOR_ID(weekday)
+        STRUCT_FOR_ID(when)
         STRUCT_FOR_ID(which)
         STRUCT_FOR_ID(who)
         STRUCT_FOR_ID(withdata)
@@ -261,6 +261,13 @@ struct _is {
     _PyOptimizerObject *optimizer;
     _PyExecutorObject *executor_list_head;
     size_t trace_run_counter;
+    /* Bytes held by linked executors, plus their JIT code (if any) */
+    size_t executor_memory;
+    /* Cold executors are evicted once executor_memory exceeds this.
+       Zero means no limit. */
+    size_t executor_memory_limit;
+    size_t executors_invalidated_cold;
+    size_t executors_evicted;
     _rare_events rare_events;
     PyDict_WatchCallback builtins_dict_watcher;
 
@@ -206,8 +206,14 @@ typedef unsigned int pymem_uint;  /* assuming >= 16 bits */
  *
  * Arenas are allocated with mmap() on systems supporting anonymous memory
  * mappings to reduce heap fragmentation.
+ *
+ * With PYMALLOC_USE_HUGEPAGES (--with-pymalloc-hugepages), arenas have the
+ * size of one 2 MiB huge page so that each arena is covered by a single TLB
+ * entry.
  */
-#ifdef USE_LARGE_ARENAS
+#if defined(PYMALLOC_USE_HUGEPAGES) && defined(USE_LARGE_ARENAS)
+#define ARENA_BITS              21                    /* 2 MiB */
+#elif defined(USE_LARGE_ARENAS)
 #define ARENA_BITS              20                    /* 1 MiB */
 #else
 #define ARENA_BITS              18                    /* 256 KiB */
@@ -126,6 +126,10 @@ PyAPI_FUNC(void) _Py_Executors_InvalidateDependency(PyInterpreterState *interp,
 PyAPI_FUNC(void) _Py_Executors_InvalidateAll(PyInterpreterState *interp, int is_invalidation);
 PyAPI_FUNC(void) _Py_Executors_InvalidateCold(PyInterpreterState *interp);
 
+// Export for '_opcode' shared extension.
+PyAPI_FUNC(void) _Py_Executors_SetMemoryLimit(PyInterpreterState *interp, size_t limit);
+PyAPI_FUNC(PyObject *) _Py_Executors_GetStats(PyInterpreterState *interp);
+
 #else
 #  define _Py_Executors_InvalidateDependency(A, B, C) ((void)0)
 #  define _Py_Executors_InvalidateAll(A, B) ((void)0)
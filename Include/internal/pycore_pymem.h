@@ -116,15 +116,24 @@ extern int _PyMem_SetupAllocators(PyMemAllocatorName allocator);
 /* Is the debug allocator enabled? */
 extern int _PyMem_DebugEnabled(void);
 
-// Enqueue a pointer to be freed possibly after some delay.
-extern void _PyMem_FreeDelayed(void *ptr);
+// Enqueue a pointer to be freed possibly after some delay. The size is
+// only used to decide how soon to try to free the queued memory.
+PyAPI_FUNC(void) _PyMem_FreeDelayed(void *ptr, size_t size);
 
 // Enqueue an object to be freed possibly after some delay
-extern void _PyObject_FreeDelayed(void *ptr);
+extern void _PyObject_FreeDelayed(void *ptr, size_t size);
 
 // Periodically process delayed free requests.
 extern void _PyMem_ProcessDelayed(PyThreadState *tstate);
 
+// Like _PyMem_ProcessDelayed(), but if the delayed frees of all threads
+// exceed the QSBR memory limit, stops the world to free them. Called from
+// the eval breaker.
+extern void _PyMem_ProcessDelayedOrReclaim(PyThreadState *tstate);
+
+// Frees the delayed free requests of all threads. The world must be stopped.
+extern void _PyMem_ReclaimDelayed(PyInterpreterState *interp);
+
 // Abandon all thread-local delayed free requests and push them to the
 // interpreter's queue.
 extern void _PyMem_AbandonDelayed(PyThreadState *tstate);
@@ -35,6 +35,11 @@ extern "C" {
 #define QSBR_LT(a, b) ((int64_t)((a)-(b)) < 0)
 #define QSBR_LEQ(a, b) ((int64_t)((a)-(b)) <= 0)
 
+// Amount of memory deferred by a thread before it advances the write
+// sequence, or queued before it polls for reclamation at the next eval
+// breaker check.
+#define QSBR_FREE_MEM_LIMIT (1024 * 1024)
+
 struct _qsbr_shared;
 struct _PyThreadStateImpl;  // forward declare to avoid circular dependency
 
@@ -49,11 +54,20 @@ struct _qsbr_thread_state {
     // Thread state (or NULL)
     PyThreadState *tstate;
 
+    // Memory deferred since the write sequence was last advanced
+    size_t deferred_memory;
+
+    // Memory queued by this thread not yet added to the shared backlog
+    size_t queued_memory;
+
     // Used to defer advancing write sequence a fixed number of times
     int deferrals;
 
     // Is this thread state allocated?
     bool allocated;
+
+    // Should the thread process its delayed frees at the next eval breaker?
+    bool should_process;
     struct _qsbr_thread_state *freelist_next;
 };
 
@@ -78,6 +92,22 @@ struct _qsbr_shared {
     // Freelist of unused _qsbr_thread_states (protected by mutex)
     PyMutex mutex;
     struct _qsbr_thread_state *freelist;
+
+    // Bytes of delayed frees waiting for a grace period. Threads add to it
+    // in batches when they process their queues.
+    Py_ssize_t backlog;
+
+    // If the backlog exceeds this many bytes, the next thread processing
+    // its queue stops the world and frees everything (0: no limit).
+    Py_ssize_t memory_limit;
+
+    // Total bytes freed after a grace period and number of times the world
+    // was stopped because of the memory limit.
+    Py_ssize_t reclaimed;
+    Py_ssize_t forced_reclaims;
+
+    // Write sequence after the last reclaim forced by the memory limit
+    uint64_t reclaim_seq;
 };
 
 static inline uint64_t
@@ -116,6 +146,23 @@ _Py_qsbr_advance(struct _qsbr_shared *shared);
 extern uint64_t
 _Py_qsbr_deferred_advance(struct _qsbr_thread_state *qsbr);
 
+// Like `_Py_qsbr_deferred_advance()`, but also advances the write sequence
+// once QSBR_FREE_MEM_LIMIT bytes were deferred since the last advance.
+extern uint64_t
+_Py_qsbr_deferred_advance_for_free(struct _qsbr_thread_state *qsbr,
+                                   size_t size);
+
+// Returns true (once) if the thread should process its delayed frees.
+static inline bool
+_Py_qsbr_should_process(struct _qsbr_thread_state *qsbr)
+{
+    if (qsbr->should_process) {
+        qsbr->should_process = false;
+        return true;
+    }
+    return false;
+}
+
 // Have the read sequences advanced to the given goal? If this returns true,
 // it safe to reclaim any memory tagged with the goal (or earlier goal).
 extern bool
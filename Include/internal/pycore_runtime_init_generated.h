@@ -734,6 +734,7 @@ extern "C" {
     INIT_ID(__weakref__), \
     INIT_ID(__xor__), \
     INIT_ID(_abc_impl), \
+    INIT_ID(_abort), \
     INIT_ID(_abstract_), \
     INIT_ID(_active), \
     INIT_ID(_anonymous_), \
@@ -742,6 +743,8 @@ extern "C" {
     INIT_ID(_asyncio_future_blocking), \
     INIT_ID(_blksize), \
     INIT_ID(_bootstrap), \
+    INIT_ID(_cancel_message), \
+    INIT_ID(_cancelled), \
     INIT_ID(_check_retval_), \
     INIT_ID(_dealloc_warn), \
     INIT_ID(_feature_version), \
@@ -760,10 +763,16 @@ extern "C" {
     INIT_ID(_length_), \
     INIT_ID(_limbo), \
     INIT_ID(_lock_unlock_module), \
+    INIT_ID(_log_destroy_pending), \
     INIT_ID(_loop), \
+    INIT_ID(_make_cancelled_error), \
     INIT_ID(_needs_com_addref_), \
+    INIT_ID(_on_task_done), \
     INIT_ID(_only_immortal), \
+    INIT_ID(_repr_info), \
     INIT_ID(_restype_), \
+    INIT_ID(_run), \
+    INIT_ID(_scheduled), \
     INIT_ID(_showwarnmsg), \
     INIT_ID(_shutdown), \
     INIT_ID(_slotnames), \
@@ -771,9 +780,11 @@ extern "C" {
     INIT_ID(_strptime_datetime_date), \
     INIT_ID(_strptime_datetime_datetime), \
     INIT_ID(_strptime_datetime_time), \
+    INIT_ID(_timer_handle_cancelled), \
     INIT_ID(_type_), \
     INIT_ID(_uninitialized_submodules), \
     INIT_ID(_warn_unawaited_coroutine), \
+    INIT_ID(_when), \
     INIT_ID(_xoptions), \
     INIT_ID(abs_tol), \
     INIT_ID(access), \
@@ -829,6 +840,7 @@ extern "C" {
     INIT_ID(call_soon), \
     INIT_ID(callback), \
     INIT_ID(cancel), \
+    INIT_ID(cancelled), \
     INIT_ID(capath), \
     INIT_ID(category), \
     INIT_ID(cb_type), \
@@ -871,6 +883,8 @@ extern "C" {
     INIT_ID(coro), \
     INIT_ID(count), \
     INIT_ID(covariant), \
+    INIT_ID(create_future), \
+    INIT_ID(create_task), \
     INIT_ID(cwd), \
     INIT_ID(data), \
     INIT_ID(database), \
@@ -911,6 +925,8 @@ extern "C" {
     INIT_ID(end_lineno), \
     INIT_ID(end_offset), \
     INIT_ID(endpos), \
+    INIT_ID(ensure_future), \
+    INIT_ID(entries), \
     INIT_ID(entrypoint), \
     INIT_ID(env), \
     INIT_ID(errors), \
@@ -1140,6 +1156,7 @@ extern "C" {
     INIT_ID(pi_factory), \
     INIT_ID(pid), \
     INIT_ID(policy), \
+    INIT_ID(popleft), \
     INIT_ID(pos), \
     INIT_ID(pos1), \
     INIT_ID(pos2), \
@@ -1175,7 +1192,9 @@ extern "C" {
     INIT_ID(reserved), \
     INIT_ID(reset), \
     INIT_ID(resetids), \
+    INIT_ID(result), \
     INIT_ID(return), \
+    INIT_ID(return_exceptions), \
     INIT_ID(reverse), \
     INIT_ID(reversed), \
     INIT_ID(salt), \
@@ -1193,6 +1212,7 @@ extern "C" {
     INIT_ID(server_hostname), \
     INIT_ID(server_side), \
     INIT_ID(session), \
+    INIT_ID(set_result), \
     INIT_ID(setcomp), \
     INIT_ID(setpgroup), \
     INIT_ID(setsid), \
@@ -1278,6 +1298,7 @@ extern "C" {
     INIT_ID(wbits), \
     INIT_ID(week), \
     INIT_ID(weekday), \
+    INIT_ID(when), \
     INIT_ID(which), \
     INIT_ID(who), \
     INIT_ID(withdata), \
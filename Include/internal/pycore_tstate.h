@@ -14,6 +14,17 @@ extern "C" {
 #include "pycore_qsbr.h"            // struct qsbr
 
 
+#ifdef Py_GIL_DISABLED
+// Size of the per-thread type attribute cache, see _PyType_LookupRef().
+#define MCACHE_THREAD_SIZE_EXP 8
+
+struct _type_cache_thread_entry {
+    unsigned int version;  // initialized from type->tp_version_tag
+    PyObject *name;        // borrowed reference to an immortal str or NULL
+    PyObject *value;       // borrowed reference or NULL
+};
+#endif
+
 // Every PyThreadState is actually allocated as a _PyThreadStateImpl. The
 // PyThreadState fields are exposed as part of the C API, although most fields
 // are intended to be private. The _PyThreadStateImpl fields not exposed.
@@ -41,6 +52,10 @@ typedef struct _PyThreadStateImpl {
         // If set, don't use per-thread refcounts
         int is_finalized;
     } refcounts;
+
+    // Small cache in front of the interpreter's type attribute cache.  Only
+    // the owning thread accesses it, so it needs no synchronization.
+    struct _type_cache_thread_entry type_cache[1 << MCACHE_THREAD_SIZE_EXP];
 #endif
 
 #if defined(Py_REF_DEBUG) && defined(Py_GIL_DISABLED)
@@ -72,6 +72,9 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_BINARY_OP_MULTIPLY_FLOAT] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_ADD_FLOAT] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_SUBTRACT_FLOAT] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_MIXED_INT_FLOAT] = HAS_ARG_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_BINARY_OP_EXTEND_LIST] = HAS_ARG_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_BINARY_OP_REMAINDER_UNICODE] = HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_GUARD_BOTH_UNICODE] = HAS_EXIT_FLAG,
     [_BINARY_OP_ADD_UNICODE] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_INPLACE_ADD_UNICODE] = HAS_LOCAL_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG,
@@ -158,6 +161,8 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_LOAD_ATTR_CLASS_1] = 0,
     [_LOAD_ATTR_CLASS] = HAS_ARG_FLAG | HAS_OPARG_AND_1_FLAG,
     [_LOAD_ATTR_PROPERTY_FRAME] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_LOAD_ATTR_GETATTR_FRAME] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_DEOPT_FLAG,
+    [_LOAD_ATTR_DESCRIPTOR_GET_FRAME] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_GUARD_DORV_NO_DICT] = HAS_EXIT_FLAG,
     [_STORE_ATTR_INSTANCE_VALUE] = 0,
     [_STORE_ATTR_WITH_HINT] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
@@ -247,6 +252,8 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_EXPAND_METHOD_KW] = HAS_ARG_FLAG,
     [_CHECK_IS_NOT_PY_CALLABLE_KW] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
     [_CALL_KW_NON_PY] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_CALL_KW_BUILTIN_FAST] = HAS_ARG_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_CALL_KW_METHOD_DESCRIPTOR_FAST] = HAS_ARG_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_MAKE_CALLARGS_A_TUPLE] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_MAKE_FUNCTION] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_SET_FUNCTION_ATTRIBUTE] = HAS_ARG_FLAG,
@@ -284,6 +291,7 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_CHECK_VALIDITY_AND_SET_IP] = HAS_DEOPT_FLAG,
     [_DEOPT] = 0,
     [_ERROR_POP_N] = HAS_ARG_FLAG,
+    [_REVERSE] = HAS_ARG_FLAG | HAS_PURE_FLAG,
     [_TIER2_RESUME_CHECK] = HAS_DEOPT_FLAG,
 };
 
@@ -298,9 +306,12 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_BINARY_OP_ADD_FLOAT] = "_BINARY_OP_ADD_FLOAT",
     [_BINARY_OP_ADD_INT] = "_BINARY_OP_ADD_INT",
     [_BINARY_OP_ADD_UNICODE] = "_BINARY_OP_ADD_UNICODE",
+    [_BINARY_OP_EXTEND_LIST] = "_BINARY_OP_EXTEND_LIST",
     [_BINARY_OP_INPLACE_ADD_UNICODE] = "_BINARY_OP_INPLACE_ADD_UNICODE",
+    [_BINARY_OP_MIXED_INT_FLOAT] = "_BINARY_OP_MIXED_INT_FLOAT",
     [_BINARY_OP_MULTIPLY_FLOAT] = "_BINARY_OP_MULTIPLY_FLOAT",
     [_BINARY_OP_MULTIPLY_INT] = "_BINARY_OP_MULTIPLY_INT",
+    [_BINARY_OP_REMAINDER_UNICODE] = "_BINARY_OP_REMAINDER_UNICODE",
     [_BINARY_OP_SUBTRACT_FLOAT] = "_BINARY_OP_SUBTRACT_FLOAT",
     [_BINARY_OP_SUBTRACT_INT] = "_BINARY_OP_SUBTRACT_INT",
     [_BINARY_SLICE] = "_BINARY_SLICE",
@@ -324,6 +335,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_CALL_INTRINSIC_1] = "_CALL_INTRINSIC_1",
     [_CALL_INTRINSIC_2] = "_CALL_INTRINSIC_2",
     [_CALL_ISINSTANCE] = "_CALL_ISINSTANCE",
+    [_CALL_KW_BUILTIN_FAST] = "_CALL_KW_BUILTIN_FAST",
+    [_CALL_KW_METHOD_DESCRIPTOR_FAST] = "_CALL_KW_METHOD_DESCRIPTOR_FAST",
     [_CALL_KW_NON_PY] = "_CALL_KW_NON_PY",
     [_CALL_LEN] = "_CALL_LEN",
     [_CALL_LIST_APPEND] = "_CALL_LIST_APPEND",
@@ -443,6 +456,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_LOAD_ATTR_CLASS] = "_LOAD_ATTR_CLASS",
     [_LOAD_ATTR_CLASS_0] = "_LOAD_ATTR_CLASS_0",
     [_LOAD_ATTR_CLASS_1] = "_LOAD_ATTR_CLASS_1",
+    [_LOAD_ATTR_DESCRIPTOR_GET_FRAME] = "_LOAD_ATTR_DESCRIPTOR_GET_FRAME",
+    [_LOAD_ATTR_GETATTR_FRAME] = "_LOAD_ATTR_GETATTR_FRAME",
     [_LOAD_ATTR_INSTANCE_VALUE] = "_LOAD_ATTR_INSTANCE_VALUE",
     [_LOAD_ATTR_INSTANCE_VALUE_0] = "_LOAD_ATTR_INSTANCE_VALUE_0",
     [_LOAD_ATTR_INSTANCE_VALUE_1] = "_LOAD_ATTR_INSTANCE_VALUE_1",
@@ -512,6 +527,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_RESUME_CHECK] = "_RESUME_CHECK",
     [_RETURN_GENERATOR] = "_RETURN_GENERATOR",
     [_RETURN_VALUE] = "_RETURN_VALUE",
+    [_REVERSE] = "_REVERSE",
     [_SAVE_RETURN_OFFSET] = "_SAVE_RETURN_OFFSET",
     [_SEND_GEN_FRAME] = "_SEND_GEN_FRAME",
     [_SETUP_ANNOTATIONS] = "_SETUP_ANNOTATIONS",
@@ -670,6 +686,12 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 2;
         case _BINARY_OP_SUBTRACT_FLOAT:
             return 2;
+        case _BINARY_OP_MIXED_INT_FLOAT:
+            return 2;
+        case _BINARY_OP_EXTEND_LIST:
+            return 2;
+        case _BINARY_OP_REMAINDER_UNICODE:
+            return 2;
         case _GUARD_BOTH_UNICODE:
             return 2;
         case _BINARY_OP_ADD_UNICODE:
@@ -842,6 +864,10 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 1;
         case _LOAD_ATTR_PROPERTY_FRAME:
             return 1;
+        case _LOAD_ATTR_GETATTR_FRAME:
+            return 1;
+        case _LOAD_ATTR_DESCRIPTOR_GET_FRAME:
+            return 1;
         case _GUARD_DORV_NO_DICT:
             return 1;
         case _STORE_ATTR_INSTANCE_VALUE:
@@ -1020,6 +1046,10 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 3 + oparg;
         case _CALL_KW_NON_PY:
             return 3 + oparg;
+        case _CALL_KW_BUILTIN_FAST:
+            return 3 + oparg;
+        case _CALL_KW_METHOD_DESCRIPTOR_FAST:
+            return 3 + oparg;
         case _MAKE_CALLARGS_A_TUPLE:
             return 3 + (oparg & 1);
         case _MAKE_FUNCTION:
@@ -1094,6 +1124,8 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _ERROR_POP_N:
             return oparg;
+        case _REVERSE:
+            return oparg;
         case _TIER2_RESUME_CHECK:
             return 0;
         default:
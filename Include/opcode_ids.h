@@ -130,80 +130,87 @@ extern "C" {
 #define BINARY_OP_ADD_FLOAT                    150
 #define BINARY_OP_ADD_INT                      151
 #define BINARY_OP_ADD_UNICODE                  152
-#define BINARY_OP_MULTIPLY_FLOAT               153
-#define BINARY_OP_MULTIPLY_INT                 154
-#define BINARY_OP_SUBTRACT_FLOAT               155
-#define BINARY_OP_SUBTRACT_INT                 156
-#define BINARY_SUBSCR_DICT                     157
-#define BINARY_SUBSCR_GETITEM                  158
-#define BINARY_SUBSCR_LIST_INT                 159
-#define BINARY_SUBSCR_STR_INT                  160
-#define BINARY_SUBSCR_TUPLE_INT                161
-#define CALL_ALLOC_AND_ENTER_INIT              162
-#define CALL_BOUND_METHOD_EXACT_ARGS           163
-#define CALL_BOUND_METHOD_GENERAL              164
-#define CALL_BUILTIN_CLASS                     165
-#define CALL_BUILTIN_FAST                      166
-#define CALL_BUILTIN_FAST_WITH_KEYWORDS        167
-#define CALL_BUILTIN_O                         168
-#define CALL_ISINSTANCE                        169
-#define CALL_KW_BOUND_METHOD                   170
-#define CALL_KW_NON_PY                         171
-#define CALL_KW_PY                             172
-#define CALL_LEN                               173
-#define CALL_LIST_APPEND                       174
-#define CALL_METHOD_DESCRIPTOR_FAST            175
-#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 176
-#define CALL_METHOD_DESCRIPTOR_NOARGS          177
-#define CALL_METHOD_DESCRIPTOR_O               178
-#define CALL_NON_PY_GENERAL                    179
-#define CALL_PY_EXACT_ARGS                     180
-#define CALL_PY_GENERAL                        181
-#define CALL_STR_1                             182
-#define CALL_TUPLE_1                           183
-#define CALL_TYPE_1                            184
-#define COMPARE_OP_FLOAT                       185
-#define COMPARE_OP_INT                         186
-#define COMPARE_OP_STR                         187
-#define CONTAINS_OP_DICT                       188
-#define CONTAINS_OP_SET                        189
-#define FOR_ITER_GEN                           190
-#define FOR_ITER_LIST                          191
-#define FOR_ITER_RANGE                         192
-#define FOR_ITER_TUPLE                         193
-#define LOAD_ATTR_CLASS                        194
-#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   195
-#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      196
-#define LOAD_ATTR_INSTANCE_VALUE               197
-#define LOAD_ATTR_METHOD_LAZY_DICT             198
-#define LOAD_ATTR_METHOD_NO_DICT               199
-#define LOAD_ATTR_METHOD_WITH_VALUES           200
-#define LOAD_ATTR_MODULE                       201
-#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        202
-#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    203
-#define LOAD_ATTR_PROPERTY                     204
-#define LOAD_ATTR_SLOT                         205
-#define LOAD_ATTR_WITH_HINT                    206
-#define LOAD_GLOBAL_BUILTIN                    207
-#define LOAD_GLOBAL_MODULE                     208
-#define LOAD_SUPER_ATTR_ATTR                   209
-#define LOAD_SUPER_ATTR_METHOD                 210
-#define RESUME_CHECK                           211
-#define SEND_GEN                               212
-#define STORE_ATTR_INSTANCE_VALUE              213
-#define STORE_ATTR_SLOT                        214
-#define STORE_ATTR_WITH_HINT                   215
-#define STORE_SUBSCR_DICT                      216
-#define STORE_SUBSCR_LIST_INT                  217
-#define TO_BOOL_ALWAYS_TRUE                    218
-#define TO_BOOL_BOOL                           219
-#define TO_BOOL_INT                            220
-#define TO_BOOL_LIST                           221
-#define TO_BOOL_NONE                           222
-#define TO_BOOL_STR                            223
-#define UNPACK_SEQUENCE_LIST                   224
-#define UNPACK_SEQUENCE_TUPLE                  225
-#define UNPACK_SEQUENCE_TWO_TUPLE              226
+#define BINARY_OP_EXTEND_LIST                  153
+#define BINARY_OP_MIXED_INT_FLOAT              154
+#define BINARY_OP_MULTIPLY_FLOAT               155
+#define BINARY_OP_MULTIPLY_INT                 156
+#define BINARY_OP_REMAINDER_UNICODE            157
+#define BINARY_OP_SUBTRACT_FLOAT               158
+#define BINARY_OP_SUBTRACT_INT                 159
+#define BINARY_SUBSCR_DICT                     160
+#define BINARY_SUBSCR_GETITEM                  161
+#define BINARY_SUBSCR_LIST_INT                 162
+#define BINARY_SUBSCR_STR_INT                  163
+#define BINARY_SUBSCR_TUPLE_INT                164
+#define CALL_ALLOC_AND_ENTER_INIT              165
+#define CALL_BOUND_METHOD_EXACT_ARGS           166
+#define CALL_BOUND_METHOD_GENERAL              167
+#define CALL_BUILTIN_CLASS                     168
+#define CALL_BUILTIN_FAST                      169
+#define CALL_BUILTIN_FAST_WITH_KEYWORDS        170
+#define CALL_BUILTIN_O                         171
+#define CALL_ISINSTANCE                        172
+#define CALL_KW_BOUND_METHOD                   173
+#define CALL_KW_BUILTIN_FAST                   174
+#define CALL_KW_METHOD_DESCRIPTOR_FAST         175
+#define CALL_KW_NON_PY                         176
+#define CALL_KW_PY                             177
+#define CALL_LEN                               178
+#define CALL_LIST_APPEND                       179
+#define CALL_METHOD_DESCRIPTOR_FAST            180
+#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 181
+#define CALL_METHOD_DESCRIPTOR_NOARGS          182
+#define CALL_METHOD_DESCRIPTOR_O               183
+#define CALL_NON_PY_GENERAL                    184
+#define CALL_PY_EXACT_ARGS                     185
+#define CALL_PY_GENERAL                        186
+#define CALL_STR_1                             187
+#define CALL_TUPLE_1                           188
+#define CALL_TYPE_1                            189
+#define COMPARE_OP_FLOAT                       190
+#define COMPARE_OP_INT                         191
+#define COMPARE_OP_STR                         192
+#define CONTAINS_OP_DICT                       193
+#define CONTAINS_OP_SET                        194
+#define FOR_ITER_GEN                           195
+#define FOR_ITER_LIST                          196
+#define FOR_ITER_RANGE                         197
+#define FOR_ITER_TUPLE                         198
+#define LOAD_ATTR_CLASS                        199
+#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   200
+#define LOAD_ATTR_DESCRIPTOR_GET               201
+#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      202
+#define LOAD_ATTR_GETATTR_FALLBACK             203
+#define LOAD_ATTR_INSTANCE_VALUE               204
+#define LOAD_ATTR_METHOD_LAZY_DICT             205
+#define LOAD_ATTR_METHOD_NO_DICT               206
+#define LOAD_ATTR_METHOD_WITH_VALUES           207
+#define LOAD_ATTR_MODULE                       208
+#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        209
+#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    210
+#define LOAD_ATTR_PROPERTY                     211
+#define LOAD_ATTR_SLOT                         212
+#define LOAD_ATTR_WITH_HINT                    213
+#define LOAD_GLOBAL_BUILTIN                    214
+#define LOAD_GLOBAL_MODULE                     215
+#define LOAD_SUPER_ATTR_ATTR                   216
+#define LOAD_SUPER_ATTR_METHOD                 217
+#define RESUME_CHECK                           218
+#define SEND_GEN                               219
+#define STORE_ATTR_INSTANCE_VALUE              220
+#define STORE_ATTR_SLOT                        221
+#define STORE_ATTR_WITH_HINT                   222
+#define STORE_SUBSCR_DICT                      223
+#define STORE_SUBSCR_LIST_INT                  224
+#define TO_BOOL_ALWAYS_TRUE                    225
+#define TO_BOOL_BOOL                           226
+#define TO_BOOL_INT                            227
+#define TO_BOOL_LIST                           228
+#define TO_BOOL_NONE                           229
+#define TO_BOOL_STR                            230
+#define UNPACK_SEQUENCE_LIST                   231
+#define UNPACK_SEQUENCE_TUPLE                  232
+#define UNPACK_SEQUENCE_TWO_TUPLE              233
 #define INSTRUMENTED_END_FOR                   236
 #define INSTRUMENTED_END_SEND                  237
 #define INSTRUMENTED_LOAD_SUPER_ATTR           238
@@ -22,6 +22,9 @@ _specializations = {
         "BINARY_OP_ADD_FLOAT",
         "BINARY_OP_SUBTRACT_FLOAT",
         "BINARY_OP_ADD_UNICODE",
+        "BINARY_OP_MIXED_INT_FLOAT",
+        "BINARY_OP_EXTEND_LIST",
+        "BINARY_OP_REMAINDER_UNICODE",
         "BINARY_OP_INPLACE_ADD_UNICODE",
     ],
     "BINARY_SUBSCR": [
@@ -65,6 +68,8 @@ _specializations = {
         "LOAD_ATTR_CLASS_WITH_METACLASS_CHECK",
         "LOAD_ATTR_PROPERTY",
         "LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN",
+        "LOAD_ATTR_GETATTR_FALLBACK",
+        "LOAD_ATTR_DESCRIPTOR_GET",
         "LOAD_ATTR_METHOD_WITH_VALUES",
         "LOAD_ATTR_METHOD_NO_DICT",
         "LOAD_ATTR_METHOD_LAZY_DICT",
@@ -112,6 +117,8 @@ _specializations = {
         "CALL_KW_BOUND_METHOD",
         "CALL_KW_PY",
         "CALL_KW_NON_PY",
+        "CALL_KW_BUILTIN_FAST",
+        "CALL_KW_METHOD_DESCRIPTOR_FAST",
     ],
 }
 
@@ -119,81 +126,88 @@ _specialized_opmap = {
     'BINARY_OP_ADD_FLOAT': 150,
     'BINARY_OP_ADD_INT': 151,
     'BINARY_OP_ADD_UNICODE': 152,
+    'BINARY_OP_EXTEND_LIST': 153,
     'BINARY_OP_INPLACE_ADD_UNICODE': 3,
-    'BINARY_OP_MULTIPLY_FLOAT': 153,
-    'BINARY_OP_MULTIPLY_INT': 154,
-    'BINARY_OP_SUBTRACT_FLOAT': 155,
-    'BINARY_OP_SUBTRACT_INT': 156,
-    'BINARY_SUBSCR_DICT': 157,
-    'BINARY_SUBSCR_GETITEM': 158,
-    'BINARY_SUBSCR_LIST_INT': 159,
-    'BINARY_SUBSCR_STR_INT': 160,
-    'BINARY_SUBSCR_TUPLE_INT': 161,
-    'CALL_ALLOC_AND_ENTER_INIT': 162,
-    'CALL_BOUND_METHOD_EXACT_ARGS': 163,
-    'CALL_BOUND_METHOD_GENERAL': 164,
-    'CALL_BUILTIN_CLASS': 165,
-    'CALL_BUILTIN_FAST': 166,
-    'CALL_BUILTIN_FAST_WITH_KEYWORDS': 167,
-    'CALL_BUILTIN_O': 168,
-    'CALL_ISINSTANCE': 169,
-    'CALL_KW_BOUND_METHOD': 170,
-    'CALL_KW_NON_PY': 171,
-    'CALL_KW_PY': 172,
-    'CALL_LEN': 173,
-    'CALL_LIST_APPEND': 174,
-    'CALL_METHOD_DESCRIPTOR_FAST': 175,
-    'CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS': 176,
-    'CALL_METHOD_DESCRIPTOR_NOARGS': 177,
-    'CALL_METHOD_DESCRIPTOR_O': 178,
-    'CALL_NON_PY_GENERAL': 179,
-    'CALL_PY_EXACT_ARGS': 180,
-    'CALL_PY_GENERAL': 181,
-    'CALL_STR_1': 182,
-    'CALL_TUPLE_1': 183,
-    'CALL_TYPE_1': 184,
-    'COMPARE_OP_FLOAT': 185,
-    'COMPARE_OP_INT': 186,
-    'COMPARE_OP_STR': 187,
-    'CONTAINS_OP_DICT': 188,
-    'CONTAINS_OP_SET': 189,
-    'FOR_ITER_GEN': 190,
-    'FOR_ITER_LIST': 191,
-    'FOR_ITER_RANGE': 192,
-    'FOR_ITER_TUPLE': 193,
-    'LOAD_ATTR_CLASS': 194,
-    'LOAD_ATTR_CLASS_WITH_METACLASS_CHECK': 195,
-    'LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN': 196,
-    'LOAD_ATTR_INSTANCE_VALUE': 197,
-    'LOAD_ATTR_METHOD_LAZY_DICT': 198,
-    'LOAD_ATTR_METHOD_NO_DICT': 199,
-    'LOAD_ATTR_METHOD_WITH_VALUES': 200,
-    'LOAD_ATTR_MODULE': 201,
-    'LOAD_ATTR_NONDESCRIPTOR_NO_DICT': 202,
-    'LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES': 203,
-    'LOAD_ATTR_PROPERTY': 204,
-    'LOAD_ATTR_SLOT': 205,
-    'LOAD_ATTR_WITH_HINT': 206,
-    'LOAD_GLOBAL_BUILTIN': 207,
-    'LOAD_GLOBAL_MODULE': 208,
-    'LOAD_SUPER_ATTR_ATTR': 209,
-    'LOAD_SUPER_ATTR_METHOD': 210,
-    'RESUME_CHECK': 211,
-    'SEND_GEN': 212,
-    'STORE_ATTR_INSTANCE_VALUE': 213,
-    'STORE_ATTR_SLOT': 214,
-    'STORE_ATTR_WITH_HINT': 215,
-    'STORE_SUBSCR_DICT': 216,
-    'STORE_SUBSCR_LIST_INT': 217,
-    'TO_BOOL_ALWAYS_TRUE': 218,
-    'TO_BOOL_BOOL': 219,
-    'TO_BOOL_INT': 220,
-    'TO_BOOL_LIST': 221,
-    'TO_BOOL_NONE': 222,
-    'TO_BOOL_STR': 223,
-    'UNPACK_SEQUENCE_LIST': 224,
-    'UNPACK_SEQUENCE_TUPLE': 225,
-    'UNPACK_SEQUENCE_TWO_TUPLE': 226,
+    'BINARY_OP_MIXED_INT_FLOAT': 154,
+    'BINARY_OP_MULTIPLY_FLOAT': 155,
+    'BINARY_OP_MULTIPLY_INT': 156,
+    'BINARY_OP_REMAINDER_UNICODE': 157,
+    'BINARY_OP_SUBTRACT_FLOAT': 158,
+    'BINARY_OP_SUBTRACT_INT': 159,
+    'BINARY_SUBSCR_DICT': 160,
+    'BINARY_SUBSCR_GETITEM': 161,
+    'BINARY_SUBSCR_LIST_INT': 162,
+    'BINARY_SUBSCR_STR_INT': 163,
+    'BINARY_SUBSCR_TUPLE_INT': 164,
+    'CALL_ALLOC_AND_ENTER_INIT': 165,
+    'CALL_BOUND_METHOD_EXACT_ARGS': 166,
+    'CALL_BOUND_METHOD_GENERAL': 167,
+    'CALL_BUILTIN_CLASS': 168,
+    'CALL_BUILTIN_FAST': 169,
+    'CALL_BUILTIN_FAST_WITH_KEYWORDS': 170,
+    'CALL_BUILTIN_O': 171,
+    'CALL_ISINSTANCE': 172,
+    'CALL_KW_BOUND_METHOD': 173,
+    'CALL_KW_BUILTIN_FAST': 174,
+    'CALL_KW_METHOD_DESCRIPTOR_FAST': 175,
+    'CALL_KW_NON_PY': 176,
+    'CALL_KW_PY': 177,
+    'CALL_LEN': 178,
+    'CALL_LIST_APPEND': 179,
+    'CALL_METHOD_DESCRIPTOR_FAST': 180,
+    'CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS': 181,
+    'CALL_METHOD_DESCRIPTOR_NOARGS': 182,
+    'CALL_METHOD_DESCRIPTOR_O': 183,
+    'CALL_NON_PY_GENERAL': 184,
+    'CALL_PY_EXACT_ARGS': 185,
+    'CALL_PY_GENERAL': 186,
+    'CALL_STR_1': 187,
+    'CALL_TUPLE_1': 188,
+    'CALL_TYPE_1': 189,
+    'COMPARE_OP_FLOAT': 190,
+    'COMPARE_OP_INT': 191,
+    'COMPARE_OP_STR': 192,
+    'CONTAINS_OP_DICT': 193,
+    'CONTAINS_OP_SET': 194,
+    'FOR_ITER_GEN': 195,
+    'FOR_ITER_LIST': 196,
+    'FOR_ITER_RANGE': 197,
+    'FOR_ITER_TUPLE': 198,
+    'LOAD_ATTR_CLASS': 199,
+    'LOAD_ATTR_CLASS_WITH_METACLASS_CHECK': 200,
+    'LOAD_ATTR_DESCRIPTOR_GET': 201,
+    'LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN': 202,
+    'LOAD_ATTR_GETATTR_FALLBACK': 203,
+    'LOAD_ATTR_INSTANCE_VALUE': 204,
+    'LOAD_ATTR_METHOD_LAZY_DICT': 205,
+    'LOAD_ATTR_METHOD_NO_DICT': 206,
+    'LOAD_ATTR_METHOD_WITH_VALUES': 207,
+    'LOAD_ATTR_MODULE': 208,
+    'LOAD_ATTR_NONDESCRIPTOR_NO_DICT': 209,
+    'LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES': 210,
+    'LOAD_ATTR_PROPERTY': 211,
+    'LOAD_ATTR_SLOT': 212,
+    'LOAD_ATTR_WITH_HINT': 213,
+    'LOAD_GLOBAL_BUILTIN': 214,
+    'LOAD_GLOBAL_MODULE': 215,
+    'LOAD_SUPER_ATTR_ATTR': 216,
+    'LOAD_SUPER_ATTR_METHOD': 217,
+    'RESUME_CHECK': 218,
+    'SEND_GEN': 219,
+    'STORE_ATTR_INSTANCE_VALUE': 220,
+    'STORE_ATTR_SLOT': 221,
+    'STORE_ATTR_WITH_HINT': 222,
+    'STORE_SUBSCR_DICT': 223,
+    'STORE_SUBSCR_LIST_INT': 224,
+    'TO_BOOL_ALWAYS_TRUE': 225,
+    'TO_BOOL_BOOL': 226,
+    'TO_BOOL_INT': 227,
+    'TO_BOOL_LIST': 228,
+    'TO_BOOL_NONE': 229,
+    'TO_BOOL_STR': 230,
+    'UNPACK_SEQUENCE_LIST': 231,
+    'UNPACK_SEQUENCE_TUPLE': 232,
+    'UNPACK_SEQUENCE_TWO_TUPLE': 233,
 }
 
 opmap = {
@@ -45,3 +45,6 @@
 else:
     from .unix_events import *  # pragma: no cover
     __all__ += unix_events.__all__
+    if sys.platform == 'linux':
+        from .uring_events import *
+        __all__ += uring_events.__all__
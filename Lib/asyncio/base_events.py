@@ -77,6 +77,43 @@ def _format_handle(handle):
         return str(handle)
 
 
+def _pop_due_timers(scheduled, ready, end_time):
+    # Move the timer handles of the 'scheduled' heap that are due before
+    # 'end_time' to the 'ready' queue.
+    while scheduled:
+        handle = scheduled[0]
+        if handle._when >= end_time:
+            break
+        handle = heapq.heappop(scheduled)
+        handle._scheduled = False
+        ready.append(handle)
+
+
+def _run_ready(ready):
+    # Run the callbacks of the handles currently in the 'ready' queue, but
+    # not the ones added by these callbacks: they will be run the next time
+    # (after another I/O poll).  Use an idiom that is thread-safe without
+    # using locks.
+    ntodo = len(ready)
+    for i in range(ntodo):
+        handle = ready.popleft()
+        if handle._cancelled:
+            continue
+        handle._run()
+
+
+_py__pop_due_timers = _pop_due_timers
+_py__run_ready = _run_ready
+
+try:
+    from _asyncio import _pop_due_timers, _run_ready
+except ImportError:
+    pass
+else:
+    _c__pop_due_timers = _pop_due_timers
+    _c__run_ready = _run_ready
+
+
 def _format_pipe(fd):
     if fd == subprocess.PIPE:
         return '<pipe>'
@@ -1999,13 +2036,7 @@ def _run_once(self):
 
         # Handle 'later' callbacks that are ready.
         end_time = self.time() + self._clock_resolution
-        while self._scheduled:
-            handle = self._scheduled[0]
-            if handle._when >= end_time:
-                break
-            handle = heapq.heappop(self._scheduled)
-            handle._scheduled = False
-            self._ready.append(handle)
+        _pop_due_timers(self._scheduled, self._ready, end_time)
 
         # This is the only place where callbacks are actually *called*.
         # All other places just add them to ready.
@@ -2013,24 +2044,24 @@ def _run_once(self):
         # callbacks scheduled by callbacks run this time around --
         # they will be run the next time (after another I/O poll).
         # Use an idiom that is thread-safe without using locks.
+        if not self._debug:
+            _run_ready(self._ready)
+            return
         ntodo = len(self._ready)
         for i in range(ntodo):
             handle = self._ready.popleft()
             if handle._cancelled:
                 continue
-            if self._debug:
-                try:
-                    self._current_handle = handle
-                    t0 = self.time()
-                    handle._run()
-                    dt = self.time() - t0
-                    if dt >= self.slow_callback_duration:
-                        logger.warning('Executing %s took %.3f seconds',
-                                       _format_handle(handle), dt)
-                finally:
-                    self._current_handle = None
-            else:
+            try:
+                self._current_handle = handle
+                t0 = self.time()
                 handle._run()
+                dt = self.time() - t0
+                if dt >= self.slow_callback_duration:
+                    logger.warning('Executing %s took %.3f seconds',
+                                   _format_handle(handle), dt)
+            finally:
+                self._current_handle = None
         handle = None  # Needed to break cycles when an exception occurs.
 
     def _set_coroutine_origin_tracking(self, enabled):
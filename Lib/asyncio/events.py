@@ -126,27 +126,27 @@ def __hash__(self):
         return hash(self._when)
 
     def __lt__(self, other):
-        if isinstance(other, TimerHandle):
+        if isinstance(other, _PyTimerHandle):
             return self._when < other._when
         return NotImplemented
 
     def __le__(self, other):
-        if isinstance(other, TimerHandle):
+        if isinstance(other, _PyTimerHandle):
             return self._when < other._when or self.__eq__(other)
         return NotImplemented
 
     def __gt__(self, other):
-        if isinstance(other, TimerHandle):
+        if isinstance(other, _PyTimerHandle):
             return self._when > other._when
         return NotImplemented
 
     def __ge__(self, other):
-        if isinstance(other, TimerHandle):
+        if isinstance(other, _PyTimerHandle):
             return self._when > other._when or self.__eq__(other)
         return NotImplemented
 
     def __eq__(self, other):
-        if isinstance(other, TimerHandle):
+        if isinstance(other, _PyTimerHandle):
             return (self._when == other._when and
                     self._callback == other._callback and
                     self._args == other._args and
@@ -830,6 +830,8 @@ def new_event_loop():
 _py__set_running_loop = _set_running_loop
 _py_get_running_loop = get_running_loop
 _py_get_event_loop = get_event_loop
+_PyHandle = Handle
+_PyTimerHandle = TimerHandle
 
 
 try:
@@ -848,6 +850,17 @@ def new_event_loop():
     _c_get_event_loop = get_event_loop
 
 
+try:
+    # Handles are created for every callback scheduled on the event loop.
+    from _asyncio import Handle, TimerHandle
+except ImportError:
+    pass
+else:
+    # _CHandle and _CTimerHandle are needed for tests.
+    _CHandle = Handle
+    _CTimerHandle = TimerHandle
+
+
 if hasattr(os, 'fork'):
     def on_fork():
         # Reset the loop and wakeupfd in the forked child process.
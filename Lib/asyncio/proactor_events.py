@@ -162,7 +162,11 @@ def _call_connection_lost(self, exc):
             # just close our end.  First calling shutdown() seems to
             # cure it, but maybe using DisconnectEx() would be better.
             if hasattr(self._sock, 'shutdown') and self._sock.fileno() != -1:
-                self._sock.shutdown(socket.SHUT_RDWR)
+                try:
+                    self._sock.shutdown(socket.SHUT_RDWR)
+                except OSError:
+                    if not self._loop._ignore_shutdown_errors:
+                        raise
             self._sock.close()
             self._sock = None
             server = self._server
@@ -626,6 +630,9 @@ def write_eof(self):
 
 class BaseProactorEventLoop(base_events.BaseEventLoop):
 
+    # Whether transports ignore OSError from shutdown() when they close.
+    _ignore_shutdown_errors = False
+
     def __init__(self, proactor):
         super().__init__()
         logger.debug('Using proactor: %s', proactor.__class__.__name__)
@@ -1,14 +1,19 @@
-__all__ = ('Runner', 'run')
+__all__ = ('Runner', 'run', 'LoopGroup')
 
+import collections
+import concurrent.futures
 import contextvars
 import enum
 import functools
 import inspect
+import itertools
+import os
 import threading
 import signal
 from . import coroutines
 from . import events
 from . import exceptions
+from . import futures
 from . import tasks
 from . import constants
 
@@ -203,6 +208,270 @@ async def main():
         return runner.run(main)
 
 
+class _LoopWorker:
+    """An event loop run by a thread of a LoopGroup."""
+
+    def __init__(self, group, name):
+        self._group = group
+        # Coroutines submitted to this worker which were not started yet,
+        # as (coro, concurrent future) pairs.  The worker consumes its
+        # queue from the left, other workers steal from the right.
+        self._queue = collections.deque()
+        self._wakeup_pending = False
+        self._ntasks = 0
+        self._loop = None
+        self._stop_waiter = None
+        self._error = None
+        self._started = threading.Event()
+        self._thread = threading.Thread(target=self._run, name=name)
+
+    def _run(self):
+        try:
+            with Runner(debug=self._group._debug,
+                        loop_factory=self._group._loop_factory) as runner:
+                runner.run(self._main())
+        except BaseException as exc:
+            if self._started.is_set():
+                raise
+            # The event loop could not be created: the group reports it.
+            self._error = exc
+        finally:
+            self._started.set()
+
+    async def _main(self):
+        self._loop = events.get_running_loop()
+        self._stop_waiter = self._loop.create_future()
+        self._started.set()
+        await self._stop_waiter
+
+    def _stop(self):
+        waiter = self._stop_waiter
+        if waiter is not None:
+            self._loop.call_soon_threadsafe(
+                futures._set_result_unless_cancelled, waiter, None)
+
+    def _load(self):
+        return len(self._queue) + self._ntasks
+
+    def _wakeup(self):
+        # Called from any thread.  Return False if the worker has not
+        # processed its previous wakeup yet: it is probably busy.
+        if self._wakeup_pending:
+            return False
+        self._wakeup_pending = True
+        self._loop.call_soon_threadsafe(self._process_queue)
+        return True
+
+    def _process_queue(self):
+        # Clear the flag before consuming the queue: a coroutine queued
+        # after this point triggers a new wakeup.
+        self._wakeup_pending = False
+        queue = self._queue
+        while True:
+            try:
+                item = queue.popleft()
+            except IndexError:
+                break
+            self._start(item)
+        self._steal()
+
+    def _steal(self):
+        # Take half of the longest queue of another worker, which did not
+        # start these coroutines yet.  This is attempted when the worker
+        # processes its queue and when one of its tasks completes.  Running
+        # tasks cannot be stolen, so they do not count here.
+        victim = max((w for w in self._group._workers if w is not self),
+                     key=lambda w: len(w._queue), default=None)
+        if victim is None or not victim._queue:
+            return
+        for _ in range((len(victim._queue) + 1) // 2):
+            try:
+                item = victim._queue.pop()
+            except IndexError:
+                break
+            self._start(item)
+
+    def _start(self, item):
+        coro, future = item
+        if future.cancelled():
+            coro.close()
+            return
+        try:
+            task = self._loop.create_task(coro)
+            futures._chain_future(task, future)
+        except (SystemExit, KeyboardInterrupt):
+            raise
+        except BaseException as exc:
+            if future.set_running_or_notify_cancel():
+                future.set_exception(exc)
+            return
+        self._ntasks += 1
+        task.add_done_callback(self._task_done)
+
+    def _task_done(self, task):
+        self._ntasks -= 1
+        if not self._queue:
+            self._steal()
+
+
+class LoopGroup:
+    """A context manager running coroutines on a group of event loops.
+
+    Each event loop runs in its own thread.  On free-threaded builds,
+    the loops run in parallel on different CPU cores.
+
+    Coroutines are submitted with submit() from any thread, or awaited
+    with run() from a coroutine.  Submitted coroutines are dispatched
+    to the loops in turn.  Until its loop starts it, a coroutine can
+    be stolen by another loop, so that the work goes to loops which
+    are not busy.  Once started, a task stays on its loop.
+
+    with asyncio.LoopGroup(4) as group:
+        futures = [group.submit(handle(request)) for request in requests]
+
+    If loop_factory is passed, it is used to create the event loops.
+    """
+
+    _counter = itertools.count().__next__
+
+    def __init__(self, workers=None, *, debug=None, loop_factory=None,
+                 thread_name_prefix=''):
+        if workers is None:
+            workers = os.process_cpu_count() or 1
+        if workers <= 0:
+            raise ValueError("workers must be greater than 0")
+        self._nworkers = workers
+        self._debug = debug
+        self._loop_factory = loop_factory
+        self._thread_name_prefix = (thread_name_prefix or
+                                    f"LoopGroup-{self._counter()}")
+        self._workers = ()
+        self._state = _State.CREATED
+        self._lock = threading.Lock()
+        self._next_worker = None
+
+    def __repr__(self):
+        return (f'<{self.__class__.__name__} workers={self._nworkers} '
+                f'{self._state.value}>')
+
+    def __enter__(self):
+        self._lazy_init()
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        self.close()
+
+    def _lazy_init(self):
+        if self._state is _State.INITIALIZED:
+            return
+        with self._lock:
+            if self._state is _State.CLOSED:
+                raise RuntimeError("LoopGroup is closed")
+            if self._state is _State.INITIALIZED:
+                return
+            workers = tuple(
+                _LoopWorker(self, f'{self._thread_name_prefix}_{i}')
+                for i in range(self._nworkers))
+            self._workers = workers
+            for worker in workers:
+                worker._thread.start()
+            for worker in workers:
+                worker._started.wait()
+            errors = [w._error for w in workers if w._error is not None]
+            if errors:
+                self._state = _State.CLOSED
+                self._shutdown()
+                raise errors[0]
+            self._next_worker = itertools.cycle(workers).__next__
+            self._state = _State.INITIALIZED
+
+    def get_loops(self):
+        """Return the event loops of the group."""
+        self._lazy_init()
+        return [worker._loop for worker in self._workers]
+
+    def submit(self, coro):
+        """Schedule a coroutine on one of the event loops.
+
+        Return a concurrent.futures.Future to access the result.  This
+        method can be called from any thread.
+        """
+        if not coroutines.iscoroutine(coro):
+            raise TypeError('A coroutine object is required')
+        if self._state is _State.CLOSED:
+            coro.close()
+            raise RuntimeError("LoopGroup is closed")
+        self._lazy_init()
+        future = concurrent.futures.Future()
+        worker = self._next_worker()
+        worker._queue.append((coro, future))
+        if self._state is _State.CLOSED:
+            # Lost the race with close(): it may not see the coroutine.
+            self._cancel_queued(worker)
+            raise RuntimeError("LoopGroup is closed")
+        if not worker._wakeup():
+            # The worker did not start the previous coroutines yet, it is
+            # probably busy: wake up the least loaded worker to steal them.
+            idle = min(self._workers, key=_LoopWorker._load)
+            if idle is not worker:
+                idle._wakeup()
+        return future
+
+    async def run(self, coro):
+        """Run a coroutine on one of the event loops and return its result.
+
+        The coroutine may run on another event loop than the caller's
+        one.  Cancelling the caller cancels the coroutine.
+        """
+        return await futures.wrap_future(self.submit(coro))
+
+    def submit_each(self, coro_func, *args):
+        """Schedule coro_func(*args) on each of the event loops.
+
+        Return the list of concurrent.futures.Future of the coroutines.
+        For example, this can be used to start a server with
+        reuse_port=True on each of the event loops.
+        """
+        self._lazy_init()
+        return [tasks.run_coroutine_threadsafe(coro_func(*args), worker._loop)
+                for worker in self._workers]
+
+    def close(self):
+        """Cancel the coroutines, stop the event loops and join the threads.
+
+        Tasks still running are cancelled, and coroutines which were not
+        started are closed.
+        """
+        if any(worker._thread is threading.current_thread()
+               for worker in self._workers):
+            raise RuntimeError(
+                "LoopGroup.close() cannot be called from one of its loops")
+        with self._lock:
+            if self._state is not _State.INITIALIZED:
+                self._state = _State.CLOSED
+                return
+            self._state = _State.CLOSED
+        self._shutdown()
+
+    def _shutdown(self):
+        for worker in self._workers:
+            worker._stop()
+        for worker in self._workers:
+            worker._thread.join()
+        for worker in self._workers:
+            self._cancel_queued(worker)
+
+    def _cancel_queued(self, worker):
+        queue = worker._queue
+        while True:
+            try:
+                coro, future = queue.popleft()
+            except IndexError:
+                break
+            coro.close()
+            future.cancel()
+
+
 def _cancel_all_tasks(loop):
     to_cancel = tasks.all_tasks(loop)
     if not to_cancel:
@@ -21,6 +21,7 @@
 
 
 _DEFAULT_LIMIT = 2 ** 16  # 64 KiB
+_RECV_BUFFER_SIZE = 2 ** 16  # 64 KiB
 
 
 async def open_connection(host=None, port=None, *,
@@ -44,7 +45,7 @@ async def open_connection(host=None, port=None, *,
     """
     loop = events.get_running_loop()
     reader = StreamReader(limit=limit, loop=loop)
-    protocol = StreamReaderProtocol(reader, loop=loop)
+    protocol = _BufferedStreamReaderProtocol(reader, loop=loop)
     transport, _ = await loop.create_connection(
         lambda: protocol, host, port, **kwds)
     writer = StreamWriter(transport, protocol, reader, loop)
@@ -77,8 +78,8 @@ async def start_server(client_connected_cb, host=None, port=None, *,
 
     def factory():
         reader = StreamReader(limit=limit, loop=loop)
-        protocol = StreamReaderProtocol(reader, client_connected_cb,
-                                        loop=loop)
+        protocol = _BufferedStreamReaderProtocol(reader, client_connected_cb,
+                                                 loop=loop)
         return protocol
 
     return await loop.create_server(factory, host, port, **kwds)
@@ -93,7 +94,7 @@ async def open_unix_connection(path=None, *,
         loop = events.get_running_loop()
 
         reader = StreamReader(limit=limit, loop=loop)
-        protocol = StreamReaderProtocol(reader, loop=loop)
+        protocol = _BufferedStreamReaderProtocol(reader, loop=loop)
         transport, _ = await loop.create_unix_connection(
             lambda: protocol, path, **kwds)
         writer = StreamWriter(transport, protocol, reader, loop)
@@ -106,8 +107,9 @@ async def start_unix_server(client_connected_cb, path=None, *,
 
         def factory():
             reader = StreamReader(limit=limit, loop=loop)
-            protocol = StreamReaderProtocol(reader, client_connected_cb,
-                                            loop=loop)
+            protocol = _BufferedStreamReaderProtocol(reader,
+                                                     client_connected_cb,
+                                                     loop=loop)
             return protocol
 
         return await loop.create_unix_server(factory, path, **kwds)
@@ -306,6 +308,32 @@ def __del__(self):
                 closed.exception()
 
 
+class _BufferedStreamReaderProtocol(StreamReaderProtocol,
+                                    protocols.BufferedProtocol):
+    """StreamReaderProtocol receiving data in a buffer of the StreamReader.
+
+    Transports supporting buffered protocols, like the selector socket
+    transports, receive the data with recv_into() in a buffer reused for
+    each read, instead of allocating a new bytes object per read.
+
+    This class is used by the stream functions instead of
+    StreamReaderProtocol, so that subclasses of StreamReaderProtocol
+    overriding data_received() keep working.
+    """
+
+    def get_buffer(self, sizehint):
+        reader = self._stream_reader
+        if reader is None:
+            # Nobody reads the stream anymore: the data is discarded.
+            return bytearray(_RECV_BUFFER_SIZE)
+        return reader._get_buffer()
+
+    def buffer_updated(self, nbytes):
+        reader = self._stream_reader
+        if reader is not None:
+            reader._buffer_updated(nbytes)
+
+
 class StreamWriter:
     """Wraps a Transport.
 
@@ -426,6 +454,7 @@ def __init__(self, limit=_DEFAULT_LIMIT, loop=None):
         else:
             self._loop = loop
         self._buffer = bytearray()
+        self._recv_buffer = None  # Used by _BufferedStreamReaderProtocol
         self._eof = False    # Whether we're done.
         self._waiter = None  # A future used by _wait_for_data()
         self._exception = None
@@ -484,6 +513,7 @@ def _maybe_resume_transport(self):
 
     def feed_eof(self):
         self._eof = True
+        self._recv_buffer = None
         self._wakeup_waiter()
 
     def at_eof(self):
@@ -512,6 +542,19 @@ def feed_data(self, data):
             else:
                 self._paused = True
 
+    def _get_buffer(self):
+        # The buffer is allocated once and reused: the transport is done
+        # with it when it calls _buffer_updated().
+        buf = self._recv_buffer
+        if buf is None:
+            buf = self._recv_buffer = memoryview(bytearray(_RECV_BUFFER_SIZE))
+        return buf
+
+    def _buffer_updated(self, nbytes):
+        # feed_data() copies the data in self._buffer: no intermediate
+        # bytes object is created.
+        self.feed_data(self._recv_buffer[:nbytes])
+
     async def _wait_for_data(self, func_name):
         """Wait until feed_data() or feed_eof() is called.
 
@@ -680,10 +723,10 @@ async def readuntil(self, separator=b'\n'):
             raise exceptions.LimitOverrunError(
                 'Separator is found, but chunk is longer than limit', match_start)
 
-        chunk = self._buffer[:match_end]
+        chunk = bytes(memoryview(self._buffer)[:match_end])
         del self._buffer[:match_end]
         self._maybe_resume_transport()
-        return bytes(chunk)
+        return chunk
 
     async def read(self, n=-1):
         """Read up to `n` bytes from the stream.
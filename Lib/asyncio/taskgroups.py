@@ -273,3 +273,19 @@ def _on_task_done(self, task):
             self._abort()
             self._parent_cancel_requested = True
             self._parent_task.cancel()
+
+
+_PyTaskGroup = TaskGroup
+
+try:
+    from _asyncio import _TaskGroupBase
+except ImportError:
+    pass
+else:
+    # The bookkeeping of the tasks (create_task() and the done callback)
+    # is implemented in C, __aenter__() and __aexit__() are inherited.
+    class TaskGroup(_TaskGroupBase, _PyTaskGroup):
+        __doc__ = _PyTaskGroup.__doc__
+        __slots__ = ()
+
+    _CTaskGroup = TaskGroup
@@ -1083,13 +1083,14 @@ def _unregister_eager_task(task):
 _py_leave_task = _leave_task
 _py_swap_current_task = _swap_current_task
 _py_all_tasks = all_tasks
+_py_gather = gather
 
 try:
     from _asyncio import (_register_task, _register_eager_task,
                           _unregister_task, _unregister_eager_task,
                           _enter_task, _leave_task, _swap_current_task,
                           _scheduled_tasks, _eager_tasks, _current_tasks,
-                          current_task, all_tasks)
+                          current_task, all_tasks, gather)
 except ImportError:
     pass
 else:
@@ -1102,3 +1103,4 @@ def _unregister_eager_task(task):
     _c_leave_task = _leave_task
     _c_swap_current_task = _swap_current_task
     _c_all_tasks = all_tasks
+    _c_gather = gather
@@ -0,0 +1,416 @@
+"""Proactor event loop for Linux using io_uring."""
+
+import errno
+import os
+import select
+import socket
+
+from . import exceptions
+from . import futures
+from . import proactor_events
+from . import unix_events
+from .log import logger
+
+try:
+    import _uring
+except ImportError:  # pragma: no cover
+    _uring = None
+
+
+__all__ = ('IoUringEventLoop', 'IoUringProactor', 'new_io_uring_event_loop')
+
+
+# Number of entries of the submission queue.  More operations can be queued
+# per loop iteration: a full queue is submitted to make room.
+RING_ENTRIES = 256
+
+# Returned by a completion callback which queued another operation for the
+# same future.
+_PENDING = object()
+
+
+class _UringFuture(futures.Future):
+    """Subclass of Future which represents an io_uring operation."""
+
+    def __init__(self, proactor, op_id, *, loop=None):
+        super().__init__(loop=loop)
+        if self._source_traceback:
+            del self._source_traceback[-1]
+        self._proactor = proactor
+        self._op_id = op_id
+        # Called with the result of an operation which completed after its
+        # future was cancelled, to release what it created.
+        self._cleanup = None
+
+    def _repr_info(self):
+        info = super()._repr_info()
+        if self._op_id is not None:
+            info.insert(1, f'op={self._op_id}')
+        return info
+
+    def cancel(self, msg=None):
+        if not self.done() and self._op_id is not None:
+            # The completion still arrives, the operation keeps its buffer
+            # until then.
+            self._proactor._cancel(self._op_id)
+        return super().cancel(msg=msg)
+
+
+class IoUringProactor:
+    """Proactor implementation using io_uring.
+
+    Operations are queued on the submission queue and handed to the kernel
+    in one batch by select(), which also collects their completions.
+    """
+
+    _ring = None
+
+    def __init__(self, entries=RING_ENTRIES):
+        if _uring is None:
+            raise OSError(errno.ENOSYS, 'io_uring is not available')
+        self._loop = None
+        self._ring = _uring.IoUring(entries)
+        self._cache = {}    # operation id => (future, object, callback)
+
+    def _check_closed(self):
+        if self._ring is None:
+            raise RuntimeError('IoUringProactor is closed')
+
+    def __repr__(self):
+        info = ['pending=%s' % len(self._cache)]
+        if self._ring is None:
+            info.append('closed')
+        return '<%s %s>' % (self.__class__.__name__, " ".join(info))
+
+    def set_loop(self, loop):
+        self._loop = loop
+
+    def select(self, timeout=None):
+        self._poll(timeout)
+        # Futures are completed by _poll(), there are no events to process.
+        return []
+
+    def _result(self, value):
+        fut = self._loop.create_future()
+        fut.set_result(value)
+        return fut
+
+    def _exception(self, exc):
+        fut = self._loop.create_future()
+        fut.set_exception(exc)
+        return fut
+
+    def _register(self, op_id, obj, callback):
+        self._check_closed()
+        f = _UringFuture(self, op_id, loop=self._loop)
+        # obj is only stored to keep it alive as long as the operation.
+        self._cache[op_id] = (f, obj, callback)
+        return f
+
+    def _resubmit(self, f, op_id, obj, callback):
+        # Queue another operation completing the same future.
+        f._op_id = op_id
+        self._cache[op_id] = (f, obj, callback)
+        return _PENDING
+
+    def _cancel(self, op_id):
+        if self._ring is not None:
+            self._ring.cancel(op_id)
+
+    def recv(self, conn, nbytes, flags=0):
+        readable = getattr(conn, 'readable', None)
+        if readable is not None and not readable():
+            # _ProactorWritePipeTransport reads from the write end of the
+            # pipe to learn when the read end is closed: wait for POLLERR,
+            # which is always reported.
+            self._check_closed()
+            op_id = self._ring.poll(conn.fileno(), 0)
+            return self._register(op_id, conn, lambda res: b'')
+        buf = bytearray(nbytes)
+
+        def finish_recv(res):
+            if res == nbytes:
+                return bytes(buf)
+            with memoryview(buf) as view:
+                return bytes(view[:res])
+
+        return self._register(self._read(conn, buf, flags), conn, finish_recv)
+
+    def recv_into(self, conn, buf, flags=0):
+        return self._register(self._read(conn, buf, flags), conn, None)
+
+    def _read(self, conn, buf, flags):
+        self._check_closed()
+        if isinstance(conn, socket.socket):
+            return self._ring.recv(conn.fileno(), buf, flags)
+        # Pipes and other file objects
+        return self._ring.read(conn.fileno(), buf)
+
+    def recvfrom(self, conn, nbytes, flags=0):
+        return self._when_ready(conn, select.POLLIN,
+                                lambda: conn.recvfrom(nbytes, flags))
+
+    def recvfrom_into(self, conn, buf, nbytes=0, flags=0):
+        return self._when_ready(conn, select.POLLIN,
+                                lambda: conn.recvfrom_into(buf, nbytes, flags))
+
+    def sendto(self, conn, buf, flags=0, addr=None):
+        if addr is None:
+            return self._when_ready(conn, select.POLLOUT,
+                                    lambda: conn.send(buf, flags))
+        return self._when_ready(conn, select.POLLOUT,
+                                lambda: conn.sendto(buf, flags, addr))
+
+    def _when_ready(self, conn, events, func):
+        # Datagram operations need an address: call the non-blocking
+        # socket method when the socket is ready instead of passing
+        # the address to the kernel.
+        self._check_closed()
+        try:
+            return self._result(func())
+        except (BlockingIOError, InterruptedError):
+            pass
+        except OSError as exc:
+            return self._exception(exc)
+
+        fd = conn.fileno()
+
+        def finish_when_ready(res):
+            try:
+                return func()
+            except (BlockingIOError, InterruptedError):
+                return self._resubmit(f, self._ring.poll(fd, events),
+                                      conn, finish_when_ready)
+
+        f = self._register(self._ring.poll(fd, events), conn,
+                           finish_when_ready)
+        return f
+
+    def send(self, conn, buf, flags=0):
+        self._check_closed()
+        fd = conn.fileno()
+        if isinstance(conn, socket.socket):
+            submit = lambda view: self._ring.send(fd, view, flags)
+        else:
+            submit = lambda view: self._ring.write(fd, view)
+        view = memoryview(buf)
+        if view.format != 'B' or view.ndim != 1:
+            view = view.cast('B')
+        total = len(view)
+
+        def finish_send(res):
+            # A stream socket can accept only part of the data: send the
+            # rest with the same future, so that it completes once all
+            # the data has been sent, like an overlapped send.
+            nonlocal view
+            if res == 0 and view:
+                # Nothing was written although data is left: the peer
+                # cannot take more, like a write to a closed pipe.
+                raise BrokenPipeError(errno.EPIPE, os.strerror(errno.EPIPE))
+            view = view[res:]
+            if view:
+                return self._resubmit(f, submit(view), conn, finish_send)
+            return total
+
+        f = self._register(submit(view), conn, finish_send)
+        return f
+
+    def accept(self, listener):
+        self._check_closed()
+
+        def finish_accept(res):
+            conn = socket.socket(fileno=res)
+            conn.settimeout(listener.gettimeout())
+            try:
+                addr = conn.getpeername()
+            except OSError:
+                conn.close()
+                raise
+            return conn, addr
+
+        op_id = self._ring.accept(listener.fileno(),
+                                  socket.SOCK_NONBLOCK | socket.SOCK_CLOEXEC)
+        f = self._register(op_id, listener, finish_accept)
+        # Close a connection accepted after the future was cancelled
+        f._cleanup = os.close
+        return f
+
+    def connect(self, conn, address):
+        self._check_closed()
+        try:
+            conn.connect(address)
+        except (BlockingIOError, InterruptedError):
+            pass
+        except OSError as exc:
+            return self._exception(exc)
+        else:
+            # UDP and some Unix sockets connect immediately
+            return self._result(None)
+
+        def finish_connect(res):
+            err = conn.getsockopt(socket.SOL_SOCKET, socket.SO_ERROR)
+            if err != 0:
+                raise OSError(err, f'Connect call failed {address}')
+
+        return self._register(self._ring.poll(conn.fileno(), select.POLLOUT),
+                              conn, finish_connect)
+
+    def sendfile(self, sock, file, offset, count):
+        # BaseEventLoop.sock_sendfile() falls back to reads and sends
+        raise exceptions.SendfileNotAvailableError(
+            "io_uring proactor has no sendfile operation")
+
+    def read(self, file, nbytes, offset=-1):
+        """Read up to nbytes from file, at offset or at the current position.
+
+        Unlike a read() in a thread, the read is performed by the kernel
+        asynchronously, including on regular files.
+        """
+        self._check_closed()
+        if not isinstance(file, int):
+            file = file.fileno()
+        buf = bytearray(nbytes)
+
+        def finish_read(res):
+            del buf[res:]
+            return bytes(buf)
+
+        return self._register(self._ring.read(file, buf, offset), None,
+                              finish_read)
+
+    def _poll(self, timeout=None):
+        if timeout is not None and timeout < 0:
+            raise ValueError("negative timeout")
+        for op_id, res in self._ring.wait(timeout):
+            try:
+                f, obj, callback = self._cache.pop(op_id)
+            except KeyError:
+                if self._loop.get_debug():
+                    self._loop.call_exception_handler({
+                        'message': 'io_uring returned an unexpected completion',
+                        'status': f'op={op_id} res={res}',
+                    })
+                continue
+
+            if f.done():
+                # The future was cancelled but the operation completed
+                if res >= 0 and f._cleanup is not None:
+                    f._cleanup(res)
+                continue
+            if res < 0:
+                f.set_exception(OSError(-res, os.strerror(-res)))
+                continue
+            try:
+                value = res if callback is None else callback(res)
+            except OSError as exc:
+                f.set_exception(exc)
+            else:
+                if value is not _PENDING:
+                    f.set_result(value)
+
+    def _stop_serving(self, obj):
+        # obj is a listening socket.  Its pending accept is cancelled by
+        # BaseProactorEventLoop._stop_serving(), which then closes it.
+        pass
+
+    def close(self):
+        if self._ring is None:
+            # already closed
+            return
+
+        for fut, obj, callback in list(self._cache.values()):
+            if not fut.done():
+                fut.cancel()
+
+        # Wait until the cancelled operations complete, so that the kernel
+        # does not write into freed buffers.
+        self._ring.close()
+        self._cache.clear()
+        self._ring = None
+
+    def __del__(self):
+        self.close()
+
+
+class IoUringEventLoop(proactor_events.BaseProactorEventLoop):
+    """Linux proactor event loop using io_uring.
+
+    The loop supports sockets, pipes and asynchronous reads of regular
+    files with file_read(), but neither signal handlers nor subprocesses.
+    """
+
+    # Linux fails with ENOTCONN for unconnected datagram sockets and
+    # connections reset by the peer.
+    _ignore_shutdown_errors = True
+
+    def __init__(self, proactor=None):
+        if proactor is None:
+            proactor = IoUringProactor()
+        super().__init__(proactor)
+        self._unix_server_sockets = {}
+
+    # UNIX domain sockets only need the generic socket operations
+    create_unix_connection = \
+        unix_events._UnixSelectorEventLoop.create_unix_connection
+    create_unix_server = unix_events._UnixSelectorEventLoop.create_unix_server
+
+    def _stop_serving(self, sock):
+        # Is this a unix socket that needs cleanup?
+        if sock in self._unix_server_sockets:
+            path = sock.getsockname()
+        else:
+            path = None
+
+        super()._stop_serving(sock)
+
+        if path is not None:
+            prev_ino = self._unix_server_sockets.pop(sock)
+            try:
+                if os.stat(path).st_ino == prev_ino:
+                    os.unlink(path)
+            except FileNotFoundError:
+                pass
+            except OSError as err:
+                logger.error('Unable to clean up listening UNIX socket '
+                             '%r: %r', path, err)
+
+    def _run_forever_setup(self):
+        assert self._self_reading_future is None
+        self.call_soon(self._loop_self_reading)
+        super()._run_forever_setup()
+
+    def _run_forever_cleanup(self):
+        super()._run_forever_cleanup()
+        if self._self_reading_future is not None:
+            # The ring keeps the buffer of the cancelled read until the
+            # kernel is done with it.
+            self._self_reading_future.cancel()
+            self._self_reading_future = None
+
+    async def file_read(self, file, nbytes, offset=None):
+        """Read up to nbytes bytes from file.
+
+        file is a file descriptor or an object with a fileno() method.
+        Read at offset if given, otherwise at the current position of
+        the file, which the read advances.
+        """
+        if offset is None:
+            offset = -1
+        elif offset < 0:
+            raise ValueError("offset must be non-negative or None")
+        return await self._proactor.read(file, nbytes, offset)
+
+
+def new_io_uring_event_loop():
+    """Return an IoUringEventLoop, or a selector event loop if the kernel
+    does not support io_uring.
+
+    This can be passed as loop_factory to asyncio.run() and asyncio.Runner.
+    """
+    try:
+        proactor = IoUringProactor()
+    except OSError as exc:
+        logger.debug('io_uring is not available (%s), '
+                     'using a selector event loop', exc)
+        return unix_events.SelectorEventLoop()
+    return IoUringEventLoop(proactor)
@@ -6,6 +6,7 @@
 __author__ = 'Brian Quinlan (brian@sweetapp.com)'
 
 from concurrent.futures import _base
+from functools import partial
 import itertools
 import queue
 import threading
@@ -81,10 +82,13 @@ def _worker(executor_reference, work_queue, initializer, initargs):
             try:
                 work_item = work_queue.get_nowait()
             except queue.Empty:
-                # attempt to increment idle count if queue is empty
+                # attempt to increment idle count if queue is empty; once
+                # all the threads are started, _adjust_thread_count() no
+                # longer consumes the idle count
                 executor = executor_reference()
-                if executor is not None:
-                    executor._idle_semaphore.release()
+                if (executor is not None
+                        and len(executor._threads) < executor._max_workers):
+                    executor._idle_workers.put(None)
                 del executor
                 work_item = work_queue.get(block=True)
 
@@ -151,7 +155,10 @@ def __init__(self, max_workers=None, thread_name_prefix='',
 
         self._max_workers = max_workers
         self._work_queue = queue.SimpleQueue()
-        self._idle_semaphore = threading.Semaphore(0)
+        # Holds one item each time a worker becomes idle.  It is cheaper than
+        # a threading.Semaphore and does not take a lock on the free-threaded
+        # build.
+        self._idle_workers = queue.SimpleQueue()
         self._threads = set()
         self._broken = False
         self._shutdown = False
@@ -180,9 +187,31 @@ def submit(self, fn, /, *args, **kwargs):
             return f
     submit.__doc__ = _base.Executor.submit.__doc__
 
+    def map(self, fn, *iterables, timeout=None, chunksize=1):
+        if chunksize < 1:
+            raise ValueError("chunksize must be >= 1.")
+        if chunksize == 1:
+            return super().map(fn, *iterables, timeout=timeout)
+
+        # Submit a single work item per chunk
+        results = super().map(partial(_base._process_chunk, fn),
+                              itertools.batched(zip(*iterables), chunksize),
+                              timeout=timeout)
+        return _base._chain_from_iterable_of_lists(results)
+    map.__doc__ = _base.Executor.map.__doc__
+
     def _adjust_thread_count(self):
+        # don't count the idle threads once all the threads are started
+        num_threads = len(self._threads)
+        if num_threads >= self._max_workers:
+            return
+
         # if idle threads are available, don't spin new threads
-        if self._idle_semaphore.acquire(timeout=0):
+        try:
+            self._idle_workers.get_nowait()
+        except queue.Empty:
+            pass
+        else:
             return
 
         # When the executor gets lost, the weakref callback will wake up
@@ -190,18 +219,16 @@ def _adjust_thread_count(self):
         def weakref_cb(_, q=self._work_queue):
             q.put(None)
 
-        num_threads = len(self._threads)
-        if num_threads < self._max_workers:
-            thread_name = '%s_%d' % (self._thread_name_prefix or self,
-                                     num_threads)
-            t = threading.Thread(name=thread_name, target=_worker,
-                                 args=(weakref.ref(self, weakref_cb),
-                                       self._work_queue,
-                                       self._initializer,
-                                       self._initargs))
-            t.start()
-            self._threads.add(t)
-            _threads_queues[t] = self._work_queue
+        thread_name = '%s_%d' % (self._thread_name_prefix or self,
+                                 num_threads)
+        t = threading.Thread(name=thread_name, target=_worker,
+                             args=(weakref.ref(self, weakref_cb),
+                                   self._work_queue,
+                                   self._initializer,
+                                   self._initargs))
+        t.start()
+        self._threads.add(t)
+        _threads_queues[t] = self._work_queue
 
     def _initializer_failed(self):
         with self._shutdown_lock:
@@ -6,6 +6,7 @@
 
 
 from abc import ABCMeta, abstractmethod
+from array import array
 from collections import namedtuple
 from collections.abc import Mapping
 import math
@@ -429,6 +430,12 @@ class EpollSelector(_PollLikeSelector):
         _EVENT_READ = select.EPOLLIN
         _EVENT_WRITE = select.EPOLLOUT
 
+        def __init__(self):
+            super().__init__()
+            # Pairs of (fd, event) filled by epoll.poll_into(), reused
+            # by all the calls to select().
+            self._events = array('I', [0, 0])
+
         def fileno(self):
             return self._selector.fileno()
 
@@ -446,15 +453,21 @@ def select(self, timeout=None):
             # we want to make sure that `select()` can be called when no
             # FD is registered.
             max_ev = len(self._fd_to_key) or 1
+            fd_events = self._events
+            if len(fd_events) < 2 * max_ev:
+                # A file descriptor and an event mask per event
+                fd_events = self._events = array('I', [0]) * (2 * max_ev)
 
             ready = []
             try:
-                fd_event_list = self._selector.poll(timeout, max_ev)
+                nfds = self._selector.poll_into(fd_events, timeout)
             except InterruptedError:
                 return ready
 
             fd_to_key = self._fd_to_key
-            for fd, event in fd_event_list:
+            # zip() reuses its result tuple: no tuple is allocated per event
+            it = iter(fd_events)
+            for _, fd, event in zip(range(nfds), it, it):
                 key = fd_to_key.get(fd)
                 if key:
                     events = ((event & _NOT_EPOLLIN and EVENT_WRITE)
@@ -7,7 +7,7 @@
 # aliases:
 from _interpreters import (
     InterpreterError, InterpreterNotFoundError, NotShareableError,
-    is_shareable,
+    SharedBuffer, is_shareable,
 )
 
 
@@ -15,7 +15,7 @@
     'get_current', 'get_main', 'create', 'list_all', 'is_shareable',
     'Interpreter',
     'InterpreterError', 'InterpreterNotFoundError', 'ExecutionFailed',
-    'NotShareableError',
+    'NotShareableError', 'SharedBuffer',
     'create_queue', 'Queue', 'QueueEmpty', 'QueueFull',
 ]
 
@@ -199,7 +199,8 @@ def close(self):
     def prepare_main(self, ns=None, /, **kwargs):
         """Bind the given values into the interpreter's __main__.
 
-        The values must be shareable.
+        The values must be shareable.  Lists and dicts, including those
+        nested in other shared containers, are bound as copies.
         """
         ns = dict(ns, **kwargs) if ns is not None else kwargs
         _interpreters.set___main___attrs(self._id, ns, restrict=True)
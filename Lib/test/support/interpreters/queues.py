@@ -182,19 +182,26 @@ def put(self, obj, timeout=None, *,
         If "syncobj" is true then the object must be "shareable".
         Examples of "shareable" objects include the builtin singletons,
         str, and memoryview.  One benefit is that such objects are
-        passed through the queue efficiently.
-
-        The key difference, though, is conceptual: the corresponding
-        object returned from Queue.get() will be strictly equivalent
-        to the given obj.  In other words, the two objects will be
-        effectively indistinguishable from each other, even if the
-        object is mutable.  The received object may actually be the
-        same object, or a copy (immutable values only), or a proxy.
-        Regardless, the received object should be treated as though
-        the original has been shared directly, whether or not it
-        actually is.  That's a slightly different and stronger promise
-        than just (initial) equality, which is all "syncobj=False"
-        can promise.
+        passed through the queue efficiently.  Tuples, lists, dicts
+        and frozensets of shareable objects are shareable too.
+
+        The key difference, though, is conceptual: for most shareable
+        objects the corresponding object returned from Queue.get()
+        will be strictly equivalent to the given obj.  In other words,
+        the two objects will be effectively indistinguishable from each
+        other, even if the object is mutable.  The received object may
+        actually be the same object, or a copy (immutable values only),
+        or a proxy.  Regardless, the received object should be treated
+        as though the original has been shared directly, whether or not
+        it actually is.  That's a slightly different and stronger
+        promise than just (initial) equality, which is all
+        "syncobj=False" can promise.
+
+        Lists and dicts are the exception: they are copied, along with
+        any list or dict nested in a shared container.  The receiver
+        gets a new object that is equal to obj when put() is called,
+        and later changes on either side are not seen by the other,
+        just as with "syncobj=False".
 
         "unbound" controls the behavior of Queue.get() for the given
         object if the current interpreter (calling put()) is later
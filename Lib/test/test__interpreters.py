@@ -108,6 +108,9 @@ def test_default_shareables(self):
                 False,
                 100.0,
                 (1, ('spam', 'eggs')),
+                [1, ['spam', 'eggs']],
+                {'spam': 1, 'eggs': [2, 3]},
+                frozenset({1, 'spam'}),
                 ]
         for obj in shareables:
             with self.subTest(obj):
@@ -133,6 +136,7 @@ class SubBytes(bytes):
                 object,
                 object(),
                 Exception(),
+                {1, 2},
                 # user-defined types and objects
                 Cheese,
                 Cheese('Wensleydale'),
@@ -225,6 +229,102 @@ def test_tuples_containing_non_shareable_types(self):
                 with self.assertRaises(ValueError):
                     _testinternalcapi.get_crossinterp_data(value)
 
+    def test_list(self):
+        self._assert_values([[], [1], ['hello', 'world'], [1, True, None, b'spam']])
+        self._assert_values([
+            [[1]],
+            [[1, 2], (3, [4])],
+        ])
+
+    def test_dict(self):
+        self._assert_values([
+            {},
+            {'spam': 1},
+            {1: 'spam', 2.0: b'eggs', None: True, (1, 2): 'ham'},
+            {'spam': {'eggs': [1, {'ham': (2, 3)}]}},
+        ])
+        # The order of the items is preserved.
+        d = {str(i): i for i in range(100, 0, -1)}
+        xid = _testinternalcapi.get_crossinterp_data(d)
+        got = _testinternalcapi.restore_crossinterp_data(xid)
+        self.assertEqual(list(got.items()), list(d.items()))
+
+    def test_frozenset(self):
+        self._assert_values([
+            frozenset(),
+            frozenset({1, 'spam', b'eggs', None}),
+            frozenset({(1, 2), frozenset({3})}),
+        ])
+
+    def test_container_items(self):
+        self._assert_values([
+            ['你好世界', '\U0001f600', 'x' * 1000, b'\0' * 1000],
+            [sys.maxsize, -sys.maxsize - 1, 0.5, float('inf')],
+        ])
+
+    def test_containers_containing_non_shareable_types(self):
+        for value in [
+            [0, object()],
+            {'spam': object()},
+            {'spam': [1, {2, 3}]},
+            frozenset({0, Exception}),
+        ]:
+            with self.subTest(repr(value)):
+                with self.assertRaises(ValueError):
+                    _testinternalcapi.get_crossinterp_data(value)
+        with self.assertRaises(OverflowError):
+            _testinternalcapi.get_crossinterp_data([2**100])
+
+    def test_recursive_container(self):
+        value = [1]
+        value.append(value)
+        with self.assertRaises(RecursionError):
+            _testinternalcapi.get_crossinterp_data(value)
+
+    def test_container_copied(self):
+        value = {'spam': [1, 2]}
+        xid = _testinternalcapi.get_crossinterp_data(value)
+        value['spam'].append(3)
+        got = _testinternalcapi.restore_crossinterp_data(xid)
+        self.assertEqual(got, {'spam': [1, 2]})
+        self.assertIsNot(got, value)
+
+
+class SharedBufferTests(TestBase):
+
+    def test_buffer(self):
+        buf = _interpreters.SharedBuffer(b'spam')
+        self.assertEqual(len(buf), 4)
+        self.assertEqual(bytes(buf), b'spam')
+        with memoryview(buf) as view:
+            self.assertTrue(view.readonly)
+            self.assertEqual(view.tobytes(), b'spam')
+        self.assertIn('4 bytes', repr(buf))
+
+    def test_copy_on_creation(self):
+        data = bytearray(b'spam')
+        buf = _interpreters.SharedBuffer(data)
+        data[:] = b'eggs'
+        self.assertEqual(bytes(buf), b'spam')
+
+    def test_not_a_buffer(self):
+        with self.assertRaises(TypeError):
+            _interpreters.SharedBuffer('spam')
+        with self.assertRaises(TypeError):
+            _interpreters.SharedBuffer()
+
+    def test_shareable(self):
+        buf = _interpreters.SharedBuffer(b'spam' * 1000)
+        self.assertTrue(_interpreters.is_shareable(buf))
+
+        xid = _testinternalcapi.get_crossinterp_data(buf)
+        got = _testinternalcapi.restore_crossinterp_data(xid)
+        self.assertIs(type(got), _interpreters.SharedBuffer)
+        self.assertIsNot(got, buf)
+        self.assertEqual(bytes(got), bytes(buf))
+        del buf
+        self.assertEqual(bytes(got), b'spam' * 1000)
+
 
 class ModuleTests(TestBase):
 
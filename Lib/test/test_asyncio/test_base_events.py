@@ -1,7 +1,9 @@
 """Tests for base_events.py"""
 
+import collections
 import concurrent.futures
 import errno
+import heapq
 import math
 import platform
 import socket
@@ -1045,6 +1047,90 @@ def test_asyncgen_finalization_by_gc_in_other_thread(self):
             self.assertTrue(status['finalized'])
 
 
+class BaseRunOnceHelpersTests:
+
+    pop_due_timers = None
+    run_ready = None
+
+    def setUp(self):
+        super().setUp()
+        self.loop = mock.Mock()
+        self.loop.get_debug.return_value = False
+
+    def test_pop_due_timers(self):
+        scheduled = []
+        for when in (3.0, 1.0, 5.0, 2.0):
+            timer = asyncio.TimerHandle(when, lambda: None, (), self.loop)
+            timer._scheduled = True
+            heapq.heappush(scheduled, timer)
+        ready = collections.deque()
+
+        self.pop_due_timers(scheduled, ready, 3.0)
+        self.assertEqual([h.when() for h in ready], [1.0, 2.0])
+        self.assertFalse(any(h._scheduled for h in ready))
+        self.assertEqual(sorted(h.when() for h in scheduled), [3.0, 5.0])
+        self.assertTrue(all(h._scheduled for h in scheduled))
+
+        self.pop_due_timers(scheduled, ready, 10.0)
+        self.assertEqual([h.when() for h in ready], [1.0, 2.0, 3.0, 5.0])
+        self.assertEqual(scheduled, [])
+
+    def test_run_ready(self):
+        calls = []
+        ready = collections.deque()
+
+        def callback(arg):
+            calls.append(arg)
+            # Handles added by callbacks run on the next call.
+            ready.append(asyncio.Handle(calls.append, ('next',), self.loop))
+
+        cancelled = asyncio.Handle(calls.append, ('cancelled',), self.loop)
+        cancelled.cancel()
+        ready.extend([asyncio.Handle(callback, (1,), self.loop),
+                      cancelled,
+                      asyncio.Handle(callback, (2,), self.loop)])
+
+        self.run_ready(ready)
+        self.assertEqual(calls, [1, 2])
+        self.assertEqual(len(ready), 2)
+
+        self.run_ready(ready)
+        self.assertEqual(calls, [1, 2, 'next', 'next'])
+        self.assertEqual(len(ready), 0)
+
+    def test_run_ready_exception(self):
+        def callback():
+            raise ValueError
+
+        def interrupt():
+            raise KeyboardInterrupt
+
+        ready = collections.deque([
+            asyncio.Handle(callback, (), self.loop),
+            asyncio.Handle(interrupt, (), self.loop),
+            asyncio.Handle(callback, (), self.loop),
+        ])
+        with self.assertRaises(KeyboardInterrupt):
+            self.run_ready(ready)
+        self.loop.call_exception_handler.assert_called_once()
+        self.assertEqual(len(ready), 1)
+
+
+class PyRunOnceHelpersTests(BaseRunOnceHelpersTests, unittest.TestCase):
+
+    pop_due_timers = staticmethod(base_events._py__pop_due_timers)
+    run_ready = staticmethod(base_events._py__run_ready)
+
+
+@unittest.skipUnless(hasattr(base_events, '_c__run_ready'),
+                     'requires the C _asyncio module')
+class CRunOnceHelpersTests(BaseRunOnceHelpersTests, unittest.TestCase):
+
+    pop_due_timers = staticmethod(getattr(base_events,
+                                          '_c__pop_due_timers', None))
+    run_ready = staticmethod(getattr(base_events, '_c__run_ready', None))
+
+
 class MyProto(asyncio.Protocol):
     done = None
 
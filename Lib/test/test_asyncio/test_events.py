@@ -2258,12 +2258,60 @@ class SelectEventLoopTests(EventLoopTestsMixin,
         def create_event_loop(self):
             return asyncio.SelectorEventLoop(selectors.SelectSelector())
 
+    if sys.platform == 'linux':
+        @unittest.skipUnless(test_utils.has_io_uring(), 'requires io_uring')
+        class IoUringEventLoopTests(EventLoopTestsMixin,
+                                    test_utils.TestCase):
+
+            def create_event_loop(self):
+                return asyncio.IoUringEventLoop()
+
+            def test_reader_callback(self):
+                raise unittest.SkipTest("IoUringEventLoop does not have add_reader()")
+
+            def test_reader_callback_cancel(self):
+                raise unittest.SkipTest("IoUringEventLoop does not have add_reader()")
+
+            def test_writer_callback(self):
+                raise unittest.SkipTest("IoUringEventLoop does not have add_writer()")
+
+            def test_writer_callback_cancel(self):
+                raise unittest.SkipTest("IoUringEventLoop does not have add_writer()")
+
+            def test_remove_fds_after_closing(self):
+                raise unittest.SkipTest("IoUringEventLoop does not have add_reader()")
+
+            def test_add_signal_handler(self):
+                raise unittest.SkipTest("IoUringEventLoop does not have add_signal_handler()")
+
+            def test_signal_handling_while_selecting(self):
+                raise unittest.SkipTest("IoUringEventLoop does not have add_signal_handler()")
+
+            def test_signal_handling_args(self):
+                raise unittest.SkipTest("IoUringEventLoop does not have add_signal_handler()")
+
+            # These tests block in os.read() before the loop runs again, but
+            # writes are only submitted by the next loop iteration.
+            def test_write_pipe(self):
+                raise unittest.SkipTest("IoUringEventLoop submits writes lazily")
+
+            def test_write_pty(self):
+                raise unittest.SkipTest("IoUringEventLoop submits writes lazily")
+
+            def test_bidirectional_pty(self):
+                raise unittest.SkipTest("IoUringEventLoop submits writes lazily")
+
+            def test_unclosed_pipe_transport(self):
+                raise unittest.SkipTest("proactor transports do not report 'open'")
+
 
 def noop(*args, **kwargs):
     pass
 
 
-class HandleTests(test_utils.TestCase):
+class BaseHandleTests:
+
+    Handle = None
 
     def setUp(self):
         super().setUp()
@@ -2275,7 +2323,7 @@ def callback(*args):
             return args
 
         args = ()
-        h = asyncio.Handle(callback, args, self.loop)
+        h = self.Handle(callback, args, self.loop)
         self.assertIs(h._callback, callback)
         self.assertIs(h._args, args)
         self.assertFalse(h.cancelled())
@@ -2290,7 +2338,7 @@ def callback():
         self.loop = mock.Mock()
         self.loop.call_exception_handler = mock.Mock()
 
-        h = asyncio.Handle(callback, (), self.loop)
+        h = self.Handle(callback, (), self.loop)
         h._run()
 
         self.loop.call_exception_handler.assert_called_with({
@@ -2302,14 +2350,14 @@ def callback():
 
     def test_handle_weakref(self):
         wd = weakref.WeakValueDictionary()
-        h = asyncio.Handle(lambda: None, (), self.loop)
+        h = self.Handle(lambda: None, (), self.loop)
         wd['h'] = h  # Would fail without __weakref__ slot.
 
     def test_handle_repr(self):
         self.loop.get_debug.return_value = False
 
         # simple function
-        h = asyncio.Handle(noop, (1, 2), self.loop)
+        h = self.Handle(noop, (1, 2), self.loop)
         filename, lineno = test_utils.get_function_source(noop)
         self.assertEqual(repr(h),
                         '<Handle noop() at %s:%s>'
@@ -2322,32 +2370,32 @@ def test_handle_repr(self):
 
         # decorated function
         cb = types.coroutine(noop)
-        h = asyncio.Handle(cb, (), self.loop)
+        h = self.Handle(cb, (), self.loop)
         self.assertEqual(repr(h),
                         '<Handle noop() at %s:%s>'
                         % (filename, lineno))
 
         # partial function
         cb = functools.partial(noop, 1, 2)
-        h = asyncio.Handle(cb, (3,), self.loop)
+        h = self.Handle(cb, (3,), self.loop)
         regex = (r'^<Handle noop\(\)\(\) at %s:%s>$'
                  % (re.escape(filename), lineno))
         self.assertRegex(repr(h), regex)
 
         # partial function with keyword args
         cb = functools.partial(noop, x=1)
-        h = asyncio.Handle(cb, (2, 3), self.loop)
+        h = self.Handle(cb, (2, 3), self.loop)
         regex = (r'^<Handle noop\(\)\(\) at %s:%s>$'
                  % (re.escape(filename), lineno))
         self.assertRegex(repr(h), regex)
 
         # partial method
-        method = HandleTests.test_handle_repr
+        method = BaseHandleTests.test_handle_repr
         cb = functools.partialmethod(method)
         filename, lineno = test_utils.get_function_source(method)
-        h = asyncio.Handle(cb, (), self.loop)
+        h = self.Handle(cb, (), self.loop)
 
-        cb_regex = r'<function HandleTests.test_handle_repr .*>'
+        cb_regex = r'<function BaseHandleTests.test_handle_repr .*>'
         cb_regex = fr'functools.partialmethod\({cb_regex}\)\(\)'
         regex = fr'^<Handle {cb_regex} at {re.escape(filename)}:{lineno}>$'
         self.assertRegex(repr(h), regex)
@@ -2358,7 +2406,7 @@ def test_handle_repr_debug(self):
         # simple function
         create_filename = __file__
         create_lineno = sys._getframe().f_lineno + 1
-        h = asyncio.Handle(noop, (1, 2), self.loop)
+        h = self.Handle(noop, (1, 2), self.loop)
         filename, lineno = test_utils.get_function_source(noop)
         self.assertEqual(repr(h),
                         '<Handle noop(1, 2) at %s:%s created at %s:%s>'
@@ -2381,7 +2429,7 @@ def test_handle_repr_debug(self):
         # partial function
         cb = functools.partial(noop, 1, 2)
         create_lineno = sys._getframe().f_lineno + 1
-        h = asyncio.Handle(cb, (3,), self.loop)
+        h = self.Handle(cb, (3,), self.loop)
         regex = (r'^<Handle noop\(1, 2\)\(3\) at %s:%s created at %s:%s>$'
                  % (re.escape(filename), lineno,
                     re.escape(create_filename), create_lineno))
@@ -2390,7 +2438,7 @@ def test_handle_repr_debug(self):
         # partial function with keyword args
         cb = functools.partial(noop, x=1)
         create_lineno = sys._getframe().f_lineno + 1
-        h = asyncio.Handle(cb, (2, 3), self.loop)
+        h = self.Handle(cb, (2, 3), self.loop)
         regex = (r'^<Handle noop\(x=1\)\(2, 3\) at %s:%s created at %s:%s>$'
                  % (re.escape(filename), lineno,
                     re.escape(create_filename), create_lineno))
@@ -2457,7 +2505,35 @@ def test_coroutine_like_object_debug_formatting(self):
         self.assertEqual(coroutines._format_coroutine(coro), 'AAA()')
 
 
-class TimerTests(unittest.TestCase):
+class PyHandleTests(BaseHandleTests, test_utils.TestCase):
+
+    Handle = events._PyHandle
+
+
+@unittest.skipUnless(hasattr(events, '_CHandle'),
+                     'requires the C _asyncio module')
+class CHandleTests(BaseHandleTests, test_utils.TestCase):
+
+    Handle = getattr(events, '_CHandle', None)
+
+    def test_handle_subclass(self):
+        calls = []
+
+        class MyHandle(self.Handle):
+            def _run(self):
+                calls.append(self._args)
+                super()._run()
+
+        h = MyHandle(calls.append, (1,), self.loop)
+        h._run()
+        self.assertEqual(calls, [(1,), 1])
+        self.assertRegex(repr(h), r'^<MyHandle .*>$')
+
+
+class BaseTimerTests:
+
+    Handle = None
+    TimerHandle = None
 
     def setUp(self):
         super().setUp()
@@ -2465,13 +2541,13 @@ def setUp(self):
 
     def test_hash(self):
         when = time.monotonic()
-        h = asyncio.TimerHandle(when, lambda: False, (),
+        h = self.TimerHandle(when, lambda: False, (),
                                 mock.Mock())
         self.assertEqual(hash(h), hash(when))
 
     def test_when(self):
         when = time.monotonic()
-        h = asyncio.TimerHandle(when, lambda: False, (),
+        h = self.TimerHandle(when, lambda: False, (),
                                 mock.Mock())
         self.assertEqual(when, h.when())
 
@@ -2481,7 +2557,7 @@ def callback(*args):
 
         args = (1, 2, 3)
         when = time.monotonic()
-        h = asyncio.TimerHandle(when, callback, args, mock.Mock())
+        h = self.TimerHandle(when, callback, args, mock.Mock())
         self.assertIs(h._callback, callback)
         self.assertIs(h._args, args)
         self.assertFalse(h.cancelled())
@@ -2497,7 +2573,7 @@ def test_timer_repr(self):
         self.loop.get_debug.return_value = False
 
         # simple function
-        h = asyncio.TimerHandle(123, noop, (), self.loop)
+        h = self.TimerHandle(123, noop, (), self.loop)
         src = test_utils.get_function_source(noop)
         self.assertEqual(repr(h),
                         '<TimerHandle when=123 noop() at %s:%s>' % src)
@@ -2513,7 +2589,7 @@ def test_timer_repr_debug(self):
         # simple function
         create_filename = __file__
         create_lineno = sys._getframe().f_lineno + 1
-        h = asyncio.TimerHandle(123, noop, (), self.loop)
+        h = self.TimerHandle(123, noop, (), self.loop)
         filename, lineno = test_utils.get_function_source(noop)
         self.assertEqual(repr(h),
                         '<TimerHandle when=123 noop() '
@@ -2534,8 +2610,8 @@ def callback(*args):
 
         when = time.monotonic()
 
-        h1 = asyncio.TimerHandle(when, callback, (), self.loop)
-        h2 = asyncio.TimerHandle(when, callback, (), self.loop)
+        h1 = self.TimerHandle(when, callback, (), self.loop)
+        h2 = self.TimerHandle(when, callback, (), self.loop)
         # TODO: Use assertLess etc.
         self.assertFalse(h1 < h2)
         self.assertFalse(h2 < h1)
@@ -2551,8 +2627,8 @@ def callback(*args):
         h2.cancel()
         self.assertFalse(h1 == h2)
 
-        h1 = asyncio.TimerHandle(when, callback, (), self.loop)
-        h2 = asyncio.TimerHandle(when + 10.0, callback, (), self.loop)
+        h1 = self.TimerHandle(when, callback, (), self.loop)
+        h2 = self.TimerHandle(when + 10.0, callback, (), self.loop)
         self.assertTrue(h1 < h2)
         self.assertFalse(h2 < h1)
         self.assertTrue(h1 <= h2)
@@ -2564,7 +2640,7 @@ def callback(*args):
         self.assertFalse(h1 == h2)
         self.assertTrue(h1 != h2)
 
-        h3 = asyncio.Handle(callback, (), self.loop)
+        h3 = self.Handle(callback, (), self.loop)
         self.assertIs(NotImplemented, h1.__eq__(h3))
         self.assertIs(NotImplemented, h1.__ne__(h3))
 
@@ -2591,6 +2667,20 @@ def callback(*args):
         self.assertTrue(h1 >= SMALLEST)
 
 
+class PyTimerTests(BaseTimerTests, unittest.TestCase):
+
+    Handle = events._PyHandle
+    TimerHandle = events._PyTimerHandle
+
+
+@unittest.skipUnless(hasattr(events, '_CTimerHandle'),
+                     'requires the C _asyncio module')
+class CTimerTests(BaseTimerTests, unittest.TestCase):
+
+    Handle = getattr(events, '_CHandle', None)
+    TimerHandle = getattr(events, '_CTimerHandle', None)
+
+
 class AbstractEventLoopTests(unittest.TestCase):
 
     def test_not_implemented(self):
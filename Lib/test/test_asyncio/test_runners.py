@@ -1,11 +1,13 @@
 import _thread
 import asyncio
+import concurrent.futures
 import contextvars
 import re
 import signal
 import sys
 import threading
 import unittest
+from test import support
 from test.test_asyncio import utils as test_utils
 from unittest import mock
 from unittest.mock import patch
@@ -523,5 +525,181 @@ async def coro():
         self.assertEqual(0, result.repr_count)
 
 
+class LoopGroupTests(unittest.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.addCleanup(asyncio.set_event_loop_policy, None)
+
+    def test_submit(self):
+        async def f(x):
+            await asyncio.sleep(0)
+            return x, threading.current_thread()
+
+        with asyncio.LoopGroup(3) as group:
+            loops = group.get_loops()
+            self.assertEqual(len(set(loops)), 3)
+            futs = [group.submit(f(i)) for i in range(9)]
+            results = [fut.result(support.SHORT_TIMEOUT) for fut in futs]
+        self.assertEqual([x for x, _ in results], list(range(9)))
+        threads = {thread for _, thread in results}
+        self.assertLessEqual(len(threads), 3)
+        self.assertNotIn(threading.current_thread(), threads)
+        for loop in loops:
+            self.assertTrue(loop.is_closed())
+        self.assertIn('closed', repr(group))
+
+    def test_submit_non_coro(self):
+        with asyncio.LoopGroup(1) as group:
+            with self.assertRaisesRegex(TypeError, 'coroutine object'):
+                group.submit(asyncio.sleep)
+
+    def test_submit_exception(self):
+        async def f():
+            raise ZeroDivisionError
+
+        with asyncio.LoopGroup(2) as group:
+            with self.assertRaises(ZeroDivisionError):
+                group.submit(f()).result(support.SHORT_TIMEOUT)
+
+    def test_run(self):
+        async def f():
+            return asyncio.get_running_loop()
+
+        async def main(group):
+            loop = await group.run(f())
+            self.assertIsNot(loop, asyncio.get_running_loop())
+            return loop
+
+        with asyncio.LoopGroup(2) as group:
+            self.assertIn(asyncio.run(main(group)), group.get_loops())
+
+    def test_run_cancel(self):
+        started = threading.Event()
+        cancelled = threading.Event()
+
+        async def f():
+            started.set()
+            try:
+                await asyncio.sleep(support.LONG_TIMEOUT)
+            except asyncio.CancelledError:
+                cancelled.set()
+                raise
+
+        async def main(group):
+            task = asyncio.create_task(group.run(f()))
+            await asyncio.to_thread(started.wait, support.SHORT_TIMEOUT)
+            task.cancel()
+            with self.assertRaises(asyncio.CancelledError):
+                await task
+
+        with asyncio.LoopGroup(1) as group:
+            asyncio.run(main(group))
+            # The coroutine is cancelled in the loop of the group
+            self.assertTrue(cancelled.wait(support.SHORT_TIMEOUT))
+
+    def test_steal_from_busy_loop(self):
+        started = threading.Event()
+        release = threading.Event()
+        self.addCleanup(release.set)
+
+        async def block():
+            started.set()
+            # Block the event loop
+            release.wait(support.LONG_TIMEOUT)
+            return threading.current_thread()
+
+        async def f():
+            await asyncio.sleep(0)
+            return threading.current_thread()
+
+        with asyncio.LoopGroup(2) as group:
+            blocked = group.submit(block())
+            self.assertTrue(started.wait(support.SHORT_TIMEOUT))
+            # Half of the coroutines are submitted to the blocked loop:
+            # the other loop steals them.
+            futs = [group.submit(f()) for _ in range(4)]
+            threads = [fut.result(support.SHORT_TIMEOUT) for fut in futs]
+            release.set()
+            self.assertNotIn(blocked.result(support.SHORT_TIMEOUT), threads)
+
+    def test_steal_skips_loop_with_empty_queue(self):
+        started = threading.Event()
+        release = threading.Event()
+        self.addCleanup(release.set)
+
+        async def block():
+            started.set()
+            release.wait(support.LONG_TIMEOUT)
+
+        async def f():
+            return threading.current_thread()
+
+        with asyncio.LoopGroup(3) as group:
+            blocked, busy, idle = group._workers
+            group.submit(block())
+            self.assertTrue(started.wait(support.SHORT_TIMEOUT))
+            # The busiest loop runs many tasks but has nothing to steal;
+            # the coroutines are stranded on the blocked loop.
+            busy._ntasks += 100
+            futs = [concurrent.futures.Future() for _ in range(4)]
+            for fut in futs:
+                blocked._queue.append((f(), fut))
+            idle._loop.call_soon_threadsafe(idle._steal)
+            # Half of the queue is stolen, from the right
+            for fut in futs[2:]:
+                self.assertIs(fut.result(support.SHORT_TIMEOUT), idle._thread)
+            busy._ntasks -= 100
+            release.set()
+
+    def test_submit_each(self):
+        async def f(x):
+            return x, asyncio.get_running_loop()
+
+        with asyncio.LoopGroup(3) as group:
+            futs = group.submit_each(f, 'x')
+            results = [fut.result(support.SHORT_TIMEOUT) for fut in futs]
+            self.assertEqual([x for x, _ in results], ['x'] * 3)
+            self.assertEqual([loop for _, loop in results], group.get_loops())
+
+    def test_close(self):
+        started = threading.Event()
+
+        async def f():
+            started.set()
+            await asyncio.sleep(support.LONG_TIMEOUT)
+
+        group = asyncio.LoopGroup(1)
+        fut = group.submit(f())
+        self.assertTrue(started.wait(support.SHORT_TIMEOUT))
+        group.close()
+        self.assertTrue(fut.cancelled())
+        group.close()
+        with self.assertRaisesRegex(RuntimeError, 'LoopGroup is closed'):
+            group.submit(f())
+
+    def test_close_from_loop(self):
+        async def f():
+            group.close()
+
+        with asyncio.LoopGroup(1) as group:
+            with self.assertRaisesRegex(RuntimeError, 'cannot be called'):
+                group.submit(f()).result(support.SHORT_TIMEOUT)
+
+    def test_invalid_workers(self):
+        with self.assertRaises(ValueError):
+            asyncio.LoopGroup(0)
+
+    def test_loop_factory_error(self):
+        def factory():
+            raise ZeroDivisionError
+
+        group = asyncio.LoopGroup(2, loop_factory=factory)
+        with self.assertRaises(ZeroDivisionError):
+            group.get_loops()
+        with self.assertRaisesRegex(RuntimeError, 'LoopGroup is closed'):
+            group.get_loops()
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -44,6 +44,7 @@ def _basetest_open_connection(self, open_connection_fut):
         messages = []
         self.loop.set_exception_handler(lambda loop, ctx: messages.append(ctx))
         reader, writer = self.loop.run_until_complete(open_connection_fut)
+        self.assertIsInstance(writer._protocol, asyncio.BufferedProtocol)
         writer.write(b'GET / HTTP/1.0\r\n\r\n')
         f = reader.readline()
         data = self.loop.run_until_complete(f)
@@ -136,6 +137,26 @@ def test_feed_nonempty_data(self):
         stream.feed_data(self.DATA)
         self.assertEqual(self.DATA, stream._buffer)
 
+    def test_feed_buffered_protocol(self):
+        stream = asyncio.StreamReader(loop=self.loop)
+        protocol = asyncio.streams._BufferedStreamReaderProtocol(
+            stream, loop=self.loop)
+
+        buf = protocol.get_buffer(-1)
+        buf[:len(self.DATA)] = self.DATA
+        protocol.buffer_updated(len(self.DATA))
+        self.assertEqual(self.DATA, stream._buffer)
+        # The receive buffer is reused
+        self.assertIs(protocol.get_buffer(-1), buf)
+
+        line = self.loop.run_until_complete(stream.readline())
+        self.assertEqual(b'line1\n', line)
+
+        protocol.eof_received()
+        self.assertIsNone(stream._recv_buffer)
+        data = self.loop.run_until_complete(stream.read())
+        self.assertEqual(b'line2\nline3\n', data)
+
     def test_read_zero(self):
         # Read zero bytes.
         stream = asyncio.StreamReader(loop=self.loop)
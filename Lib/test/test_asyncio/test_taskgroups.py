@@ -38,7 +38,8 @@ def no_other_refs():
     return [coro]
 
 
-class TestTaskGroup(unittest.IsolatedAsyncioTestCase):
+class BaseTestTaskGroup:
+    TaskGroup = None
 
     async def test_taskgroup_01(self):
 
@@ -50,7 +51,7 @@ async def foo2():
             await asyncio.sleep(0.2)
             return 11
 
-        async with taskgroups.TaskGroup() as g:
+        async with self.TaskGroup() as g:
             t1 = g.create_task(foo1())
             t2 = g.create_task(foo2())
 
@@ -67,7 +68,7 @@ async def foo2():
             await asyncio.sleep(0.2)
             return 11
 
-        async with taskgroups.TaskGroup() as g:
+        async with self.TaskGroup() as g:
             t1 = g.create_task(foo1())
             await asyncio.sleep(0.15)
             t2 = g.create_task(foo2())
@@ -85,7 +86,7 @@ async def foo2():
             await asyncio.sleep(0.2)
             return 11
 
-        async with taskgroups.TaskGroup() as g:
+        async with self.TaskGroup() as g:
             t1 = g.create_task(foo1())
             await asyncio.sleep(0.15)
             # cancel t1 explicitly, i.e. everything should continue
@@ -119,7 +120,7 @@ async def foo2():
         async def runner():
             nonlocal NUM, t2
 
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 g.create_task(foo1())
                 t2 = g.create_task(foo2())
 
@@ -158,7 +159,7 @@ async def foo2():
         async def runner():
             nonlocal NUM, runner_cancel
 
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 g.create_task(foo1())
                 g.create_task(foo1())
                 g.create_task(foo1())
@@ -194,7 +195,7 @@ async def foo():
                 raise
 
         async def runner():
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 for _ in range(5):
                     g.create_task(foo())
 
@@ -222,7 +223,7 @@ async def foo():
 
         async def runner():
             nonlocal NUM
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 for _ in range(5):
                     g.create_task(foo())
 
@@ -251,7 +252,7 @@ async def foo():
                 1 / 0
 
         async def runner():
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 for _ in range(5):
                     g.create_task(foo())
 
@@ -280,7 +281,7 @@ async def foo2():
 
         async def runner():
             nonlocal t1, t2
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 t1 = g.create_task(foo1())
                 t2 = g.create_task(foo2())
                 await asyncio.sleep(0.1)
@@ -310,7 +311,7 @@ async def foo2():
 
         async def runner():
             nonlocal t1, t2
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 t1 = g.create_task(foo1())
                 t2 = g.create_task(foo2())
                 1 / 0
@@ -334,8 +335,8 @@ async def foo():
                 1 / 0
 
         async def runner():
-            async with taskgroups.TaskGroup():
-                async with taskgroups.TaskGroup() as g2:
+            async with self.TaskGroup():
+                async with self.TaskGroup() as g2:
                     for _ in range(5):
                         g2.create_task(foo())
 
@@ -361,10 +362,10 @@ async def foo():
                 1 / 0
 
         async def runner():
-            async with taskgroups.TaskGroup() as g1:
+            async with self.TaskGroup() as g1:
                 g1.create_task(asyncio.sleep(10))
 
-                async with taskgroups.TaskGroup() as g2:
+                async with self.TaskGroup() as g2:
                     for _ in range(5):
                         g2.create_task(foo())
 
@@ -388,10 +389,10 @@ async def crash_after(t):
             raise ValueError(t)
 
         async def runner():
-            async with taskgroups.TaskGroup() as g1:
+            async with self.TaskGroup() as g1:
                 g1.create_task(crash_after(0.1))
 
-                async with taskgroups.TaskGroup() as g2:
+                async with self.TaskGroup() as g2:
                     g2.create_task(crash_after(10))
 
         r = asyncio.create_task(runner())
@@ -407,10 +408,10 @@ async def crash_after(t):
             raise ValueError(t)
 
         async def runner():
-            async with taskgroups.TaskGroup() as g1:
+            async with self.TaskGroup() as g1:
                 g1.create_task(crash_after(10))
 
-                async with taskgroups.TaskGroup() as g2:
+                async with self.TaskGroup() as g2:
                     g2.create_task(crash_after(0.1))
 
         r = asyncio.create_task(runner())
@@ -427,7 +428,7 @@ async def crash_soon():
             1 / 0
 
         async def runner():
-            async with taskgroups.TaskGroup() as g1:
+            async with self.TaskGroup() as g1:
                 g1.create_task(crash_soon())
                 try:
                     await asyncio.sleep(10)
@@ -451,7 +452,7 @@ async def crash_soon():
             1 / 0
 
         async def nested_runner():
-            async with taskgroups.TaskGroup() as g1:
+            async with self.TaskGroup() as g1:
                 g1.create_task(crash_soon())
                 try:
                     await asyncio.sleep(10)
@@ -477,7 +478,7 @@ async def test_taskgroup_17(self):
 
         async def runner():
             nonlocal NUM
-            async with taskgroups.TaskGroup():
+            async with self.TaskGroup():
                 try:
                     await asyncio.sleep(10)
                 except asyncio.CancelledError:
@@ -499,7 +500,7 @@ async def test_taskgroup_18(self):
 
         async def runner():
             nonlocal NUM
-            async with taskgroups.TaskGroup():
+            async with self.TaskGroup():
                 try:
                     await asyncio.sleep(10)
                 except asyncio.CancelledError:
@@ -535,7 +536,7 @@ async def nested():
                 raise MyExc
 
         async def runner():
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 g.create_task(crash_soon())
                 await nested()
 
@@ -559,7 +560,7 @@ async def nested():
                 raise KeyboardInterrupt
 
         async def runner():
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 g.create_task(crash_soon())
                 await nested()
 
@@ -578,7 +579,7 @@ async def nested():
                 raise MyBaseExc
 
         async def runner():
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 g.create_task(crash_soon())
                 await nested()
 
@@ -608,7 +609,7 @@ async def nested():
                 raise TypeError
 
         async def runner():
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 g.create_task(crash_soon())
                 await nested()
 
@@ -628,7 +629,7 @@ async def nested():
                 raise TypeError
 
         async def runner():
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 g.create_task(crash_soon())
                 await nested()
 
@@ -648,7 +649,7 @@ async def foo2():
             return 11
 
         async def runner():
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 g.create_task(foo1())
                 g.create_task(foo2())
 
@@ -664,7 +665,7 @@ async def test_taskgroup_23(self):
         async def do_job(delay):
             await asyncio.sleep(delay)
 
-        async with taskgroups.TaskGroup() as g:
+        async with self.TaskGroup() as g:
             for count in range(10):
                 await asyncio.sleep(0.1)
                 g.create_task(do_job(0.3))
@@ -684,7 +685,7 @@ async def coro1(delay):
             await asyncio.sleep(delay)
 
         async def runner():
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 g.create_task(root(g))
 
         await runner()
@@ -705,7 +706,7 @@ async def hercules():
             1 / 0
 
         async def runner():
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 g.create_task(hydra(g))
                 g.create_task(hercules())
 
@@ -718,7 +719,7 @@ async def runner():
     async def test_taskgroup_task_name(self):
         async def coro():
             await asyncio.sleep(0)
-        async with taskgroups.TaskGroup() as g:
+        async with self.TaskGroup() as g:
             t = g.create_task(coro(), name="yolo")
             self.assertEqual(t.get_name(), "yolo")
 
@@ -729,7 +730,7 @@ async def coro(val):
             await asyncio.sleep(0)
             cvar.set(val)
 
-        async with taskgroups.TaskGroup() as g:
+        async with self.TaskGroup() as g:
             ctx = contextvars.copy_context()
             self.assertIsNone(ctx.get(cvar))
             t1 = g.create_task(coro(1), context=ctx)
@@ -751,7 +752,7 @@ async def coro2(g):
                     g.create_task(coro1())
 
         with self.assertRaises(ExceptionGroup) as cm:
-            async with taskgroups.TaskGroup() as g:
+            async with self.TaskGroup() as g:
                 g.create_task(coro1())
                 g.create_task(coro2(g))
 
@@ -775,7 +776,7 @@ async def database():
         async def main():
             task = asyncio.current_task()
             try:
-                async with taskgroups.TaskGroup() as tg:
+                async with self.TaskGroup() as tg:
                     async with database():
                         tg.create_task(raise_exc())
                         await asyncio.sleep(1)
@@ -789,14 +790,14 @@ async def main():
         await asyncio.create_task(main())
 
     async def test_taskgroup_already_entered(self):
-        tg = taskgroups.TaskGroup()
+        tg = self.TaskGroup()
         async with tg:
             with self.assertRaisesRegex(RuntimeError, "has already been entered"):
                 async with tg:
                     pass
 
     async def test_taskgroup_double_enter(self):
-        tg = taskgroups.TaskGroup()
+        tg = self.TaskGroup()
         async with tg:
             pass
         with self.assertRaisesRegex(RuntimeError, "has already been entered"):
@@ -805,7 +806,7 @@ async def test_taskgroup_double_enter(self):
 
     async def test_taskgroup_finished(self):
         async def create_task_after_tg_finish():
-            tg = taskgroups.TaskGroup()
+            tg = self.TaskGroup()
             async with tg:
                 pass
             coro = asyncio.sleep(0)
@@ -819,13 +820,13 @@ async def create_task_after_tg_finish():
         self.assertEqual(len(w), 0)
 
     async def test_taskgroup_not_entered(self):
-        tg = taskgroups.TaskGroup()
+        tg = self.TaskGroup()
         coro = asyncio.sleep(0)
         with self.assertRaisesRegex(RuntimeError, "has not been entered"):
             tg.create_task(coro)
 
     async def test_taskgroup_without_parent_task(self):
-        tg = taskgroups.TaskGroup()
+        tg = self.TaskGroup()
         with self.assertRaisesRegex(RuntimeError, "parent task"):
             await await_without_task(tg.__aenter__())
         coro = asyncio.sleep(0)
@@ -834,7 +835,7 @@ async def test_taskgroup_without_parent_task(self):
 
     def test_coro_closed_when_tg_closed(self):
         async def run_coro_after_tg_closes():
-            async with taskgroups.TaskGroup() as tg:
+            async with self.TaskGroup() as tg:
                 pass
             coro = asyncio.sleep(0)
             with self.assertRaisesRegex(RuntimeError, "is finished"):
@@ -848,7 +849,7 @@ async def raise_after(t, e):
             raise e()
 
         try:
-            async with asyncio.TaskGroup() as tg:
+            async with self.TaskGroup() as tg:
                 tg.create_task(raise_after(0.0, RuntimeError))
         except* RuntimeError:
             pass
@@ -860,9 +861,9 @@ async def raise_after(t, e):
             raise e()
 
         try:
-            async with asyncio.TaskGroup() as outer_tg:
+            async with self.TaskGroup() as outer_tg:
                 try:
-                    async with asyncio.TaskGroup() as inner_tg:
+                    async with self.TaskGroup() as inner_tg:
                         inner_tg.create_task(raise_after(0, RuntimeError))
                         outer_tg.create_task(raise_after(0, ValueError))
                 except* RuntimeError:
@@ -886,7 +887,7 @@ async def raise_error():
 
         async def inner():
             try:
-                async with taskgroups.TaskGroup() as tg:
+                async with self.TaskGroup() as tg:
                     tg.create_task(raise_error())
                     await asyncio.sleep(1)
                     self.fail("Sleep in group should have been cancelled")
@@ -910,7 +911,7 @@ async def outer():
 
     async def test_exception_refcycles_direct(self):
         """Test that TaskGroup doesn't keep a reference to the raised ExceptionGroup"""
-        tg = asyncio.TaskGroup()
+        tg = self.TaskGroup()
         exc = None
 
         class _Done(Exception):
@@ -928,7 +929,7 @@ class _Done(Exception):
 
     async def test_exception_refcycles_errors(self):
         """Test that TaskGroup deletes self._errors, and __aexit__ args"""
-        tg = asyncio.TaskGroup()
+        tg = self.TaskGroup()
         exc = None
 
         class _Done(Exception):
@@ -946,7 +947,7 @@ class _Done(Exception):
 
     async def test_exception_refcycles_parent_task(self):
         """Test that TaskGroup deletes self._parent_task"""
-        tg = asyncio.TaskGroup()
+        tg = self.TaskGroup()
         exc = None
 
         class _Done(Exception):
@@ -957,7 +958,7 @@ async def coro_fn():
                 raise _Done
 
         try:
-            async with asyncio.TaskGroup() as tg2:
+            async with self.TaskGroup() as tg2:
                 tg2.create_task(coro_fn())
         except* _Done as excs:
             exc = excs.exceptions[0].exceptions[0]
@@ -967,7 +968,7 @@ async def coro_fn():
 
     async def test_exception_refcycles_propagate_cancellation_error(self):
         """Test that TaskGroup deletes propagate_cancellation_error"""
-        tg = asyncio.TaskGroup()
+        tg = self.TaskGroup()
         exc = None
 
         try:
@@ -985,7 +986,7 @@ async def test_exception_refcycles_base_error(self):
         class MyKeyboardInterrupt(KeyboardInterrupt):
             pass
 
-        tg = asyncio.TaskGroup()
+        tg = self.TaskGroup()
         exc = None
 
         try:
@@ -998,5 +999,16 @@ class MyKeyboardInterrupt(KeyboardInterrupt):
         self.assertListEqual(gc.get_referrers(exc), no_other_refs())
 
 
+class TestPyTaskGroup(BaseTestTaskGroup, unittest.IsolatedAsyncioTestCase):
+    TaskGroup = taskgroups._PyTaskGroup
+
+
+@unittest.skipUnless(hasattr(taskgroups, '_CTaskGroup'),
+                     'requires the C _asyncio module')
+class TestCTaskGroup(BaseTestTaskGroup, unittest.IsolatedAsyncioTestCase):
+    TaskGroup = getattr(taskgroups, '_CTaskGroup', None)
+
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -3131,6 +3131,7 @@ def test_asyncio_module_compiled(self):
 
 
 class GatherTestsBase:
+    gather = None
 
     def setUp(self):
         super().setUp()
@@ -3232,21 +3233,21 @@ def test_env_var_debug(self):
         self.assertEqual(stdout.rstrip(), b'True')
 
 
-class FutureGatherTests(GatherTestsBase, test_utils.TestCase):
+class BaseFutureGatherTests(GatherTestsBase):
 
     def wrap_futures(self, *futures):
         return futures
 
     def _gather(self, *args, **kwargs):
-        return asyncio.gather(*args, **kwargs)
+        return self.gather(*args, **kwargs)
 
     def test_constructor_empty_sequence_without_loop(self):
         with self.assertRaisesRegex(RuntimeError, 'no current event loop'):
-            asyncio.gather()
+            self.gather()
 
     def test_constructor_empty_sequence_use_running_loop(self):
         async def gather():
-            return asyncio.gather()
+            return self.gather()
         fut = self.one_loop.run_until_complete(gather())
         self.assertIsInstance(fut, asyncio.Future)
         self.assertIs(fut._loop, self.one_loop)
@@ -3258,7 +3259,7 @@ def test_constructor_empty_sequence_use_global_loop(self):
         # Deprecated in 3.10, undeprecated in 3.12
         asyncio.set_event_loop(self.one_loop)
         self.addCleanup(asyncio.set_event_loop, None)
-        fut = asyncio.gather()
+        fut = self.gather()
         self.assertIsInstance(fut, asyncio.Future)
         self.assertIs(fut._loop, self.one_loop)
         self._run_loop(self.one_loop)
@@ -3269,22 +3270,22 @@ def test_constructor_heterogenous_futures(self):
         fut1 = self.one_loop.create_future()
         fut2 = self.other_loop.create_future()
         with self.assertRaises(ValueError):
-            asyncio.gather(fut1, fut2)
+            self.gather(fut1, fut2)
 
     def test_constructor_homogenous_futures(self):
         children = [self.other_loop.create_future() for i in range(3)]
-        fut = asyncio.gather(*children)
+        fut = self.gather(*children)
         self.assertIs(fut._loop, self.other_loop)
         self._run_loop(self.other_loop)
         self.assertFalse(fut.done())
-        fut = asyncio.gather(*children)
+        fut = self.gather(*children)
         self.assertIs(fut._loop, self.other_loop)
         self._run_loop(self.other_loop)
         self.assertFalse(fut.done())
 
     def test_one_cancellation(self):
         a, b, c, d, e = [self.one_loop.create_future() for i in range(5)]
-        fut = asyncio.gather(a, b, c, d, e)
+        fut = self.gather(a, b, c, d, e)
         cb = test_utils.MockCallback()
         fut.add_done_callback(cb)
         a.set_result(1)
@@ -3303,7 +3304,7 @@ def test_one_cancellation(self):
     def test_result_exception_one_cancellation(self):
         a, b, c, d, e, f = [self.one_loop.create_future()
                             for i in range(6)]
-        fut = asyncio.gather(a, b, c, d, e, f, return_exceptions=True)
+        fut = self.gather(a, b, c, d, e, f, return_exceptions=True)
         cb = test_utils.MockCallback()
         fut.add_done_callback(cb)
         a.set_result(1)
@@ -3324,7 +3325,7 @@ def test_result_exception_one_cancellation(self):
         cb.assert_called_once_with(fut)
 
 
-class CoroutineGatherTests(GatherTestsBase, test_utils.TestCase):
+class BaseCoroutineGatherTests(GatherTestsBase):
 
     def wrap_futures(self, *futures):
         coros = []
@@ -3336,7 +3337,7 @@ async def coro(fut=fut):
 
     def _gather(self, *args, **kwargs):
         async def coro():
-            return asyncio.gather(*args, **kwargs)
+            return self.gather(*args, **kwargs)
         return self.one_loop.run_until_complete(coro())
 
     def test_constructor_without_loop(self):
@@ -3347,7 +3348,7 @@ async def coro():
         gen2 = coro()
         self.addCleanup(gen2.close)
         with self.assertRaisesRegex(RuntimeError, 'no current event loop'):
-            asyncio.gather(gen1, gen2)
+            self.gather(gen1, gen2)
 
     def test_constructor_use_running_loop(self):
         async def coro():
@@ -3355,7 +3356,7 @@ async def coro():
         gen1 = coro()
         gen2 = coro()
         async def gather():
-            return asyncio.gather(gen1, gen2)
+            return self.gather(gen1, gen2)
         fut = self.one_loop.run_until_complete(gather())
         self.assertIs(fut._loop, self.one_loop)
         self.one_loop.run_until_complete(fut)
@@ -3368,7 +3369,7 @@ async def coro():
         self.addCleanup(asyncio.set_event_loop, None)
         gen1 = coro()
         gen2 = coro()
-        fut = asyncio.gather(gen1, gen2)
+        fut = self.gather(gen1, gen2)
         self.assertIs(fut._loop, self.other_loop)
         self.other_loop.run_until_complete(fut)
 
@@ -3396,7 +3397,7 @@ async def inner():
 
         async def outer():
             nonlocal proof, gatherer
-            gatherer = asyncio.gather(child1, child2)
+            gatherer = self.gather(child1, child2)
             await gatherer
             proof += 100
 
@@ -3423,7 +3424,7 @@ async def inner(f):
         b = self.one_loop.create_future()
 
         async def outer():
-            await asyncio.gather(inner(a), inner(b))
+            await self.gather(inner(a), inner(b))
 
         f = asyncio.ensure_future(outer(), loop=self.one_loop)
         test_utils.run_briefly(self.one_loop)
@@ -3447,6 +3448,48 @@ async def coro(s):
             # NameError should not happen:
             self.one_loop.call_exception_handler.assert_not_called()
 
+    def test_eager_children(self):
+        # Children which complete eagerly are handled before gather()
+        # returns: the outer future is done without running the loop.
+        async def coro(s):
+            return s
+        async def fail():
+            raise ZeroDivisionError
+
+        self.one_loop.set_task_factory(asyncio.eager_task_factory)
+        fut = self._gather(coro('a'), coro('b'))
+        self.assertTrue(fut.done())
+        self.assertEqual(fut.result(), ['a', 'b'])
+
+        fut = self._gather(coro('a'), fail(), return_exceptions=True)
+        self.assertTrue(fut.done())
+        self.assertEqual(fut.result()[0], 'a')
+        self.assertIsInstance(fut.result()[1], ZeroDivisionError)
+
+        fut = self._gather(fail(), coro('a'))
+        self.assertTrue(fut.done())
+        self.assertIsInstance(fut.exception(), ZeroDivisionError)
+
+
+class PyFutureGatherTests(BaseFutureGatherTests, test_utils.TestCase):
+    gather = staticmethod(tasks._py_gather)
+
+
+@unittest.skipUnless(hasattr(tasks, '_c_gather'),
+                     'requires the C _asyncio module')
+class CFutureGatherTests(BaseFutureGatherTests, test_utils.TestCase):
+    gather = staticmethod(getattr(tasks, '_c_gather', None))
+
+
+class PyCoroutineGatherTests(BaseCoroutineGatherTests, test_utils.TestCase):
+    gather = staticmethod(tasks._py_gather)
+
+
+@unittest.skipUnless(hasattr(tasks, '_c_gather'),
+                     'requires the C _asyncio module')
+class CCoroutineGatherTests(BaseCoroutineGatherTests, test_utils.TestCase):
+    gather = staticmethod(getattr(tasks, '_c_gather', None))
+
 
 class RunCoroutineThreadsafeTests(test_utils.TestCase):
     """Test case for asyncio.run_coroutine_threadsafe."""
@@ -0,0 +1,259 @@
+import errno
+import os
+import socket
+import sys
+import unittest
+from unittest import mock
+
+if sys.platform != 'linux':
+    raise unittest.SkipTest('Linux only')
+
+from test.support import os_helper
+from test.support.import_helper import import_module
+
+_uring = import_module('_uring')
+
+import asyncio
+from asyncio import uring_events
+from test.test_asyncio import utils as test_utils
+
+if not test_utils.has_io_uring():
+    raise unittest.SkipTest('io_uring is not supported by the kernel')
+
+
+def tearDownModule():
+    asyncio.set_event_loop_policy(None)
+
+
+class IoUringTests(unittest.TestCase):
+
+    def setUp(self):
+        self.ring = _uring.IoUring(4)
+        self.addCleanup(self.ring.close)
+        self.rsock, self.wsock = socket.socketpair()
+        self.addCleanup(self.rsock.close)
+        self.addCleanup(self.wsock.close)
+
+    def test_recv_send(self):
+        buf = bytearray(10)
+        recv_id = self.ring.recv(self.rsock, buf)
+        # Nothing is submitted before wait()
+        self.assertEqual(self.ring.pending, 1)
+        self.assertEqual(self.ring.wait(0), [])
+        send_id = self.ring.send(self.wsock, b'spam')
+        self.assertEqual(sorted(self.ring.wait()),
+                         sorted([(recv_id, 4), (send_id, 4)]))
+        self.assertEqual(buf[:4], b'spam')
+        self.assertEqual(self.ring.pending, 0)
+
+    def test_buffer_kept_exported(self):
+        buf = bytearray(10)
+        self.ring.recv(self.rsock, buf)
+        with self.assertRaises(BufferError):
+            buf.append(0)
+        self.wsock.send(b'x')
+        self.assertEqual(len(self.ring.wait()), 1)
+        buf.append(0)
+
+    def test_wait_timeout(self):
+        self.ring.recv(self.rsock, bytearray(1))
+        self.assertEqual(self.ring.wait(0.01), [])
+        self.assertEqual(self.ring.pending, 1)
+
+    def test_cancel(self):
+        op_id = self.ring.recv(self.rsock, bytearray(1))
+        self.assertTrue(self.ring.cancel(op_id))
+        self.assertEqual(self.ring.wait(), [(op_id, -errno.ECANCELED)])
+        self.assertFalse(self.ring.cancel(op_id))
+
+    def test_full_queue(self):
+        # More operations than entries: the queue is submitted to make room
+        ids = [self.ring.recv(self.rsock, bytearray(1)) for _ in range(10)]
+        self.assertEqual(self.ring.pending, 10)
+        self.wsock.send(b'x' * 10)
+        results = []
+        while len(results) < 10:
+            results += self.ring.wait()
+        self.assertEqual(sorted(results), [(i, 1) for i in ids])
+
+    def test_read_write_file(self):
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        with open(os_helper.TESTFN, 'wb+') as f:
+            op_id = self.ring.write(f.fileno(), b'0123456789', 0)
+            self.assertEqual(self.ring.wait(), [(op_id, 10)])
+            buf = bytearray(4)
+            op_id = self.ring.read(f.fileno(), buf, 3)
+            self.assertEqual(self.ring.wait(), [(op_id, 4)])
+            self.assertEqual(buf, b'3456')
+
+    def test_error_result(self):
+        fd = os.open(os.devnull, os.O_WRONLY)
+        self.addCleanup(os.close, fd)
+        op_id = self.ring.read(fd, bytearray(1))
+        self.assertEqual(self.ring.wait(), [(op_id, -errno.EBADF)])
+
+    def test_close(self):
+        self.ring.recv(self.rsock, bytearray(1))
+        self.ring.close()
+        self.assertTrue(self.ring.closed)
+        self.assertEqual(self.ring.pending, 0)
+        with self.assertRaises(ValueError):
+            self.ring.wait()
+        with self.assertRaises(ValueError):
+            self.ring.recv(self.rsock, bytearray(1))
+        self.ring.close()
+
+
+class IoUringEventLoopTests(test_utils.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.loop = asyncio.IoUringEventLoop()
+        self.set_event_loop(self.loop)
+
+    def test_sock_sendall_large(self):
+        rsock, wsock = socket.socketpair()
+        self.addCleanup(rsock.close)
+        self.addCleanup(wsock.close)
+        rsock.setblocking(False)
+        wsock.setblocking(False)
+        data = os.urandom(4 * 1024 * 1024)
+
+        async def reader():
+            chunks = []
+            size = 0
+            while size < len(data):
+                chunk = await self.loop.sock_recv(rsock, 65536)
+                chunks.append(chunk)
+                size += len(chunk)
+            return b''.join(chunks)
+
+        async def main():
+            # The socket only accepts part of the data at once
+            task = self.loop.create_task(reader())
+            await self.loop.sock_sendall(wsock, data)
+            return await task
+
+        self.assertEqual(self.loop.run_until_complete(main()), data)
+
+    def test_send_no_progress(self):
+        rsock, wsock = socket.socketpair()
+        self.addCleanup(rsock.close)
+        self.addCleanup(wsock.close)
+        proactor = self.loop._proactor
+        with mock.patch.object(proactor, '_ring') as ring:
+            ring.send.return_value = 12345
+            fut = proactor.send(wsock, b'data')
+            f, obj, finish_send = proactor._cache.pop(12345)
+        self.assertIs(f, fut)
+        # A completion that wrote nothing while data is left is an error
+        # rather than a short send reported as complete.
+        self.assertRaises(BrokenPipeError, finish_send, 0)
+        fut.cancel()
+
+    def test_sock_recv_cancel(self):
+        rsock, wsock = socket.socketpair()
+        self.addCleanup(rsock.close)
+        self.addCleanup(wsock.close)
+        rsock.setblocking(False)
+
+        async def main():
+            with self.assertRaises(TimeoutError):
+                await asyncio.wait_for(self.loop.sock_recv(rsock, 10), 0.01)
+            # The cancelled read does not steal the data
+            wsock.send(b'data')
+            return await self.loop.sock_recv(rsock, 10)
+
+        self.assertEqual(self.loop.run_until_complete(main()), b'data')
+
+    def test_sock_accept_cancel(self):
+        listener = socket.create_server(('127.0.0.1', 0))
+        self.addCleanup(listener.close)
+        listener.setblocking(False)
+
+        async def main():
+            fut = self.loop._proactor.accept(listener)
+            await asyncio.sleep(0)
+            fut.cancel()
+            # The connection completes the cancelled accept() or stays in
+            # the backlog, it is never leaked.
+            conn = socket.create_connection(listener.getsockname())
+            self.addCleanup(conn.close)
+            await asyncio.sleep(0.01)
+
+        with mock.patch('os.close', wraps=os.close) as close:
+            self.loop.run_until_complete(main())
+        if close.called:
+            self.assertEqual(len(close.call_args_list), 1)
+
+    def test_file_read(self):
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        with open(os_helper.TESTFN, 'wb') as f:
+            f.write(b'0123456789')
+
+        async def main():
+            with open(os_helper.TESTFN, 'rb') as f:
+                head = await self.loop.file_read(f, 4)
+                rest = await self.loop.file_read(f.fileno(), 100)
+                middle = await self.loop.file_read(f, 2, 5)
+            return head, rest, middle
+
+        self.assertEqual(self.loop.run_until_complete(main()),
+                         (b'0123', b'456789', b'56'))
+
+    def test_file_read_negative_offset(self):
+        with self.assertRaises(ValueError):
+            self.loop.run_until_complete(self.loop.file_read(0, 1, -1))
+
+    def test_sendfile_fallback(self):
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        data = b'x' * 100_000
+        with open(os_helper.TESTFN, 'wb') as f:
+            f.write(data)
+        rsock, wsock = socket.socketpair()
+        self.addCleanup(rsock.close)
+        self.addCleanup(wsock.close)
+        rsock.setblocking(False)
+        wsock.setblocking(False)
+
+        async def reader():
+            received = bytearray()
+            while len(received) < len(data):
+                received += await self.loop.sock_recv(rsock, 65536)
+            return bytes(received)
+
+        async def main():
+            task = self.loop.create_task(reader())
+            with open(os_helper.TESTFN, 'rb') as f:
+                sent = await self.loop.sock_sendfile(wsock, f)
+            return sent, await task
+
+        self.assertEqual(self.loop.run_until_complete(main()),
+                         (len(data), data))
+
+
+class NewIoUringEventLoopTests(unittest.TestCase):
+
+    def test_io_uring(self):
+        loop = asyncio.new_io_uring_event_loop()
+        self.addCleanup(loop.close)
+        self.assertIsInstance(loop, asyncio.IoUringEventLoop)
+
+    def test_fallback(self):
+        error = OSError(errno.ENOSYS, 'Function not implemented')
+        with mock.patch.object(_uring, 'IoUring', side_effect=error):
+            loop = asyncio.new_io_uring_event_loop()
+        self.addCleanup(loop.close)
+        self.assertIsInstance(loop, asyncio.SelectorEventLoop)
+
+    def test_run(self):
+        async def main():
+            return type(asyncio.get_running_loop())
+
+        self.assertIs(asyncio.run(main(),
+                                  loop_factory=asyncio.new_io_uring_event_loop),
+                      asyncio.IoUringEventLoop)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -3,6 +3,7 @@
 import asyncio
 import collections
 import contextlib
+import functools
 import io
 import logging
 import os
@@ -579,6 +580,17 @@ def disable_logger():
         logger.setLevel(old_level)
 
 
+@functools.cache
+def has_io_uring():
+    """Return True if the kernel supports the io_uring event loop."""
+    try:
+        import _uring
+        _uring.IoUring(1).close()
+    except (ImportError, OSError):
+        return False
+    return True
+
+
 def mock_nonblocking_socket(proto=socket.IPPROTO_TCP, type=socket.SOCK_STREAM,
                             family=socket.AF_INET):
     """Create a mock of a non-blocking socket."""
@@ -1,6 +1,6 @@
 import unittest
 from collections import OrderedDict, UserDict
-from types import MappingProxyType
+from types import MappingProxyType, frozendict
 from test import support
 from test.support import import_helper
 
@@ -99,6 +99,12 @@ def test_dict_clear(self):
         self.assertEqual(lst, [1, 2])
         clear(object())
 
+        fd = frozendict({'a': 1, 'b': 2})
+        h = hash(fd)
+        self.assertRaises(TypeError, clear, fd)
+        self.assertEqual(fd, {'a': 1, 'b': 2})
+        self.assertEqual(hash(fd), h)
+
         # CRASHES? clear(NULL)
 
     def test_dict_size(self):
@@ -254,6 +260,7 @@ def test_dict_setitem(self):
         self.assertEqual(dct2, {'a': 5})
 
         self.assertRaises(TypeError, setitem, {}, [], 5)  # unhashable
+        self.assertRaises(TypeError, setitem, frozendict(), 'a', 5)
         self.assertRaises(SystemError, setitem, UserDict(), 'a', 5)
         self.assertRaises(SystemError, setitem, [1], 0, 5)
         self.assertRaises(SystemError, setitem, 42, 'a', 5)
@@ -217,6 +217,45 @@ def f():
         exe = get_first_executor(f)
         self.assertIsNone(exe)
 
+    def test_executor_memory_limit(self):
+        ns = {}
+        exec(textwrap.dedent("""
+            def f():
+                for i in range(1000):
+                    pass
+            def g():
+                for i in range(1000):
+                    pass
+        """), ns, ns)
+        f, g = ns['f'], ns['g']
+        opt = _testinternalcapi.new_uop_optimizer()
+        with temporary_optimizer(opt):
+            f()
+            g()
+        exe_f = get_first_executor(f)
+        exe_g = get_first_executor(g)
+        self.assertTrue(exe_f.is_valid())
+        self.assertTrue(exe_g.is_valid())
+        stats = _opcode.get_executor_stats()
+        self.assertGreaterEqual(stats["executors"], 2)
+        self.assertGreater(stats["memory"], 0)
+        self.assertEqual(stats["memory_limit"], 0)
+        evicted = stats["evicted"]
+        try:
+            # Everything is over a one byte budget:
+            _opcode.set_executor_memory_limit(1)
+            self.assertFalse(exe_f.is_valid())
+            self.assertFalse(exe_g.is_valid())
+            self.assertIsNone(get_first_executor(f))
+            stats = _opcode.get_executor_stats()
+            self.assertEqual(stats["executors"], 0)
+            self.assertEqual(stats["memory"], 0)
+            self.assertEqual(stats["memory_limit"], 1)
+            self.assertGreaterEqual(stats["evicted"], evicted + 2)
+        finally:
+            _opcode.set_executor_memory_limit(0)
+        self.assertRaises(ValueError, _opcode.set_executor_memory_limit, -1)
+
 
 @requires_specialization
 @unittest.skipUnless(hasattr(_testinternalcapi, "get_optimizer"),
@@ -1481,6 +1520,23 @@ def fn(a):
 
         fn(A())
 
+    def test_build_unpack_tuple_sunk(self):
+        def testfunc(n):
+            a, b, c, d = 1, 2, 3, 4
+            for _ in range(n):
+                a, b, c, d = b, c, d, a
+            return a, b, c, d
+
+        loops = TIER2_THRESHOLD * 2 + 1
+        res, ex = self._run_with_optimizer(testfunc, loops)
+        self.assertEqual(res, ((2, 3, 4, 1), (3, 4, 1, 2),
+                               (4, 1, 2, 3), (1, 2, 3, 4))[loops % 4 - 1])
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertNotIn("_BUILD_TUPLE", uops)
+        self.assertNotIn("_UNPACK_SEQUENCE_TUPLE", uops)
+        self.assertIn("_REVERSE", uops)
+
 
 if __name__ == "__main__":
     unittest.main()
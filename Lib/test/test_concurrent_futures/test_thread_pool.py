@@ -23,6 +23,37 @@ def record_finished(n):
         self.executor.shutdown(wait=True)
         self.assertCountEqual(finished, range(10))
 
+    def test_map_chunksize(self):
+        ref = list(map(pow, range(40), range(40)))
+        for chunksize in (6, 40, 50):
+            with self.subTest(chunksize=chunksize):
+                self.assertEqual(
+                    list(self.executor.map(pow, range(40), range(40),
+                                           chunksize=chunksize)),
+                    ref)
+        with self.assertRaises(ValueError):
+            self.executor.map(pow, range(40), range(40), chunksize=0)
+
+    def test_map_chunksize_single_work_item(self):
+        # Each chunk is run by a single call in a worker thread
+        threads = []
+        def record_thread(x):
+            threads.append(threading.get_ident())
+            return x
+
+        self.assertEqual(
+            list(self.executor.map(record_thread, range(10), chunksize=10)),
+            list(range(10)))
+        self.assertEqual(len(set(threads)), 1)
+
+    def test_map_chunksize_exception(self):
+        # The exception of a call is raised when the first result of its
+        # chunk is retrieved
+        i = self.executor.map(divmod, [1, 1, 1, 1], [2, 3, 0, 5], chunksize=2)
+        self.assertEqual(next(i), (0, 1))
+        self.assertEqual(next(i), (0, 1))
+        self.assertRaises(ZeroDivisionError, next, i)
+
     def test_default_workers(self):
         executor = self.executor_type()
         expected = min(32, (os.process_cpu_count() or 1) + 4)
@@ -50,6 +81,20 @@ def test_idle_thread_reuse(self):
         self.assertEqual(len(executor._threads), 1)
         executor.shutdown(wait=True)
 
+    def test_idle_count_bounded(self):
+        executor = self.executor_type(2)
+        event = threading.Event()
+        futs = [executor.submit(event.wait) for _ in range(2)]
+        self.assertEqual(len(executor._threads), 2)
+        event.set()
+        for fut in futs:
+            fut.result()
+        # Workers going idle in a full pool do not add to the idle count
+        for _ in range(2000):
+            executor.submit(mul, 6, 7).result()
+        self.assertLessEqual(executor._idle_workers.qsize(), 2)
+        executor.shutdown(wait=True)
+
     @support.requires_fork()
     @unittest.skipUnless(hasattr(os, 'register_at_fork'), 'need os.register_at_fork')
     @support.requires_resource('cpu')
@@ -7,6 +7,7 @@
 import sys
 import unittest
 import weakref
+from types import frozendict
 from test import support
 from test.support import import_helper, get_c_recursion_limit
 
@@ -856,6 +857,62 @@ def __eq__(self, other):
         resizing = True
         d[9] = 6
 
+    def test_large_tables(self):
+        # Tables of 2**16 slots and more are probed through control bytes.
+        n = 60_000
+        for keys in (list(range(n)),
+                     [str(i) for i in range(n)],
+                     [i << 40 for i in range(n)],
+                     [-i for i in range(n)]):
+            with self.subTest(type=type(keys[0]), last=keys[-1]):
+                d = dict.fromkeys(keys, 0)
+                for i, k in enumerate(keys):
+                    d[k] = i
+                self.assertEqual(len(d), n)
+                self.assertEqual(list(d), keys)
+                for i, k in enumerate(keys):
+                    self.assertEqual(d[k], i)
+                self.assertNotIn(n, d)
+                self.assertNotIn(str(n), d)
+
+                for k in keys[::2]:
+                    del d[k]
+                self.assertEqual(list(d), keys[1::2])
+                self.assertEqual(d.popitem(), (keys[-1], n - 1))
+                for k in keys[::2]:
+                    self.assertNotIn(k, d)
+                    d[k] = -1
+                self.assertEqual(len(d), n - 1)
+                self.assertEqual(list(d), keys[1:-1:2] + keys[::2])
+
+                c = d.copy()
+                self.assertEqual(c, d)
+                self.assertEqual(list(c), list(d))
+                c.clear()
+                self.assertEqual(len(d), n - 1)
+
+    def test_large_table_eq_deletes_key(self):
+        # __eq__ deletes another key whose control byte matched in the same
+        # group of a large table.
+        armed = False
+        class Key:
+            def __hash__(self):
+                return 12345
+            def __eq__(self, other):
+                nonlocal armed
+                if self is a and armed:
+                    armed = False
+                    del d[b]
+                return self is other
+
+        a, b, c = Key(), Key(), Key()
+        d = dict.fromkeys(range(50_000))
+        d[a] = d[b] = d[c] = 1
+        armed = True
+        self.assertIn(c, d)
+        self.assertNotIn(b, d)
+        self.assertIn(a, d)
+
     def test_empty_presized_dict_in_freelist(self):
         # Bug #3537: if an empty but presized dict with a size larger
         # than 7 was in the freelist, it triggered an assertion failure
@@ -1595,6 +1652,109 @@ def make_pairs():
                 self.assertGreaterEqual(eq_count, 1)
 
 
+class FrozenDictTest(unittest.TestCase):
+
+    def test_constructor(self):
+        self.assertEqual(frozendict(), {})
+        self.assertEqual(frozendict({'a': 1}, b=2), {'a': 1, 'b': 2})
+        self.assertEqual(frozendict([(1, 2), (3, 4)]), {1: 2, 3: 4})
+        self.assertEqual(frozendict.fromkeys('ab', 0), {'a': 0, 'b': 0})
+        self.assertIsInstance(frozendict(), dict)
+        fd = frozendict(x=1)
+        self.assertIs(frozendict(fd), fd)
+        self.assertIs(fd.copy(), fd)
+        self.assertEqual(repr(fd), "frozendict({'x': 1})")
+        self.assertEqual(repr(frozendict()), "frozendict()")
+
+    def test_immutable(self):
+        fd = frozendict(x=1)
+        with self.assertRaises(TypeError):
+            fd['y'] = 2
+        with self.assertRaises(TypeError):
+            del fd['x']
+        for meth, args in [('clear', ()), ('pop', ('x',)), ('popitem', ()),
+                           ('setdefault', ('y', 2)), ('update', ({'y': 2},))]:
+            with self.subTest(meth):
+                self.assertRaises(TypeError, getattr(fd, meth), *args)
+        fd.__init__(y=2)
+        self.assertEqual(fd, {'x': 1})
+
+        alias = fd
+        fd |= {'y': 2}
+        self.assertEqual(fd, {'x': 1, 'y': 2})
+        self.assertIs(type(fd), frozendict)
+        self.assertEqual(alias, {'x': 1})
+        self.assertIs(type(alias | {}), frozendict)
+        self.assertIs(type({} | alias), dict)
+
+    def test_dict_methods_immutable(self):
+        fd = frozendict(x=1)
+        for meth, args in [('__setitem__', ('y', 2)), ('__delitem__', ('x',)),
+                           ('__init__', ({'y': 2},)), ('__ior__', ({'y': 2},)),
+                           ('clear', ()), ('pop', ('x',)), ('popitem', ()),
+                           ('setdefault', ('y', 2)), ('update', ({'y': 2},))]:
+            with self.subTest(meth):
+                self.assertRaises(TypeError, getattr(dict, meth), fd, *args)
+        self.assertEqual(fd, {'x': 1})
+
+        class Sub(frozendict):
+            pass
+        sub = Sub(x=1)
+        self.assertRaises(TypeError, dict.update, sub, y=2)
+        self.assertEqual(sub, {'x': 1})
+
+    def test_hash(self):
+        self.assertEqual(hash(frozendict(a=1, b=2)), hash(frozendict(b=2, a=1)))
+        fd = frozendict(a=1, b=2)
+        self.assertEqual(hash(fd), hash(fd))
+        self.assertEqual(hash(fd), hash(frozenset(fd.items())))
+        self.assertEqual(len({frozendict(a=1), frozendict(a=1)}), 1)
+        self.assertRaises(TypeError, hash, frozendict(a=[]))
+
+    def test_pickle(self):
+        fd = frozendict({1: 'a', 'b': (2,)})
+        for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+            with self.subTest(proto=proto):
+                res = pickle.loads(pickle.dumps(fd, proto))
+                self.assertIs(type(res), frozendict)
+                self.assertEqual(res, fd)
+
+    def test_lookup(self):
+        class Colliding:
+            def __hash__(self):
+                return 42
+        colliding = [Colliding() for _ in range(20)]
+        for keys in (list(range(1000)),
+                     [str(i) for i in range(1000)],
+                     [i << 40 for i in range(1000)],
+                     [-1, -2, 1.5, (1, 2), None],
+                     colliding):
+            with self.subTest(keys=keys[:3]):
+                fd = frozendict((k, i) for i, k in enumerate(keys))
+                self.assertEqual(list(fd), keys)
+                for i, k in enumerate(keys):
+                    self.assertIn(k, fd)
+                    self.assertEqual(fd[k], i)
+                self.assertNotIn(object(), fd)
+                self.assertNotIn('missing', fd)
+                self.assertIsNone(fd.get(Colliding()))
+
+                # Copies can be changed, the frozendict itself cannot.
+                d = dict(fd)
+                self.assertEqual(d, fd)
+                del d[keys[0]]
+                self.assertNotIn(keys[0], d)
+                d[keys[0]] = -1
+                d['new'] = -2
+                self.assertEqual(d[keys[0]], -1)
+                self.assertEqual(d['new'], -2)
+                with self.assertRaises(TypeError):
+                    dict.update(fd, new=0)
+                self.assertNotIn('new', fd)
+                for i, k in enumerate(keys):
+                    self.assertEqual(fd[k], i)
+
+
 class CAPITest(unittest.TestCase):
 
     # Test _PyDict_GetItem_KnownHash()
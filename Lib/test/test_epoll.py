@@ -21,6 +21,7 @@
 """
 Tests for epoll wrapper.
 """
+import array
 import errno
 import os
 import select
@@ -213,6 +214,75 @@ def test_control_and_wait(self):
         expected = [(server.fileno(), select.EPOLLOUT)]
         self.assertEqual(events, expected)
 
+    def test_poll_into(self):
+        client, server = self._connected_pair()
+        ep = select.epoll(16)
+        self.addCleanup(ep.close)
+        ep.register(server.fileno(),
+                    select.EPOLLIN | select.EPOLLOUT | select.EPOLLET)
+        ep.register(client.fileno(), select.EPOLLOUT)
+
+        events = array.array('I', [0]) * 8
+        n = ep.poll_into(events, 1)
+        self.assertEqual(n, 2)
+        self.assertEqual(sorted(zip(events[0:2*n:2], events[1:2*n:2])),
+                         sorted([(client.fileno(), select.EPOLLOUT),
+                                 (server.fileno(), select.EPOLLOUT)]))
+        # The rest of the buffer is left untouched
+        self.assertEqual(events[2*n:].tolist(), [0] * (8 - 2*n))
+
+        # Edge-triggered: the event is only reported once
+        events = array.array('I', [0]) * 8
+        self.assertEqual(ep.poll_into(events, 0), 1)
+        self.assertEqual(events[:2].tolist(),
+                         [client.fileno(), select.EPOLLOUT])
+
+        # The buffer size limits the number of events
+        events = array.array('I', [0, 0])
+        self.assertEqual(ep.poll_into(events, timeout=0), 1)
+        self.assertEqual(events.tolist(), [client.fileno(), select.EPOLLOUT])
+
+        # Any writable buffer of C unsigned ints can be used
+        buf = bytearray(16)
+        self.assertEqual(ep.poll_into(memoryview(buf).cast('I')), 1)
+
+        self.assertRaises(ValueError, ep.poll_into, array.array('I', [0]))
+        self.assertRaises(TypeError, ep.poll_into, bytes(8))
+        # Buffers of other item types would be misparsed
+        self.assertRaises(TypeError, ep.poll_into, bytearray(16))
+        self.assertRaises(TypeError, ep.poll_into, array.array('H', [0] * 8))
+        self.assertRaises(TypeError, ep.poll_into, array.array('i', [0] * 4))
+        self.assertRaises(TypeError, ep.poll_into, events, 'spam')
+
+    def test_register_modify_many(self):
+        client, server = self._connected_pair()
+        ep = select.epoll(16)
+        self.addCleanup(ep.close)
+        ep.register_many([(client, select.EPOLLIN),
+                          (server.fileno(), select.EPOLLOUT)])
+        self.assertEqual(ep.poll(0), [(server.fileno(), select.EPOLLOUT)])
+
+        ep.modify_many(iter([(client, select.EPOLLOUT),
+                             (server, select.EPOLLIN)]))
+        self.assertEqual(ep.poll(0), [(client.fileno(), select.EPOLLOUT)])
+
+        ep.register_many([])
+        ep.modify_many(())
+
+        # The operations before the failing one are applied
+        other, _ = self._connected_pair()
+        with self.assertRaises(OSError) as cm:
+            ep.register_many([(other, select.EPOLLOUT),
+                              (client, select.EPOLLOUT)])
+        self.assertEqual(cm.exception.errno, errno.EEXIST)
+        ep.unregister(other)
+
+        self.assertRaises(TypeError, ep.register_many, None)
+        self.assertRaises(TypeError, ep.register_many, [client])
+        self.assertRaises(TypeError, ep.register_many, [(client, 'spam')])
+        self.assertRaises(ValueError, ep.register_many,
+                          [(-1, select.EPOLLIN)])
+
     def test_errors(self):
         self.assertRaises(ValueError, select.epoll, -2)
         self.assertRaises(ValueError, select.epoll().register, -1,
@@ -256,6 +326,11 @@ def test_close(self):
         # operations must fail with ValueError("I/O operation on closed ...")
         self.assertRaises(ValueError, epoll.modify, fd, select.EPOLLIN)
         self.assertRaises(ValueError, epoll.poll, 1.0)
+        self.assertRaises(ValueError, epoll.poll_into, bytearray(8), 1.0)
+        self.assertRaises(ValueError, epoll.register_many,
+                          [(fd, select.EPOLLIN)])
+        self.assertRaises(ValueError, epoll.modify_many,
+                          [(fd, select.EPOLLIN)])
         self.assertRaises(ValueError, epoll.register, fd, select.EPOLLIN)
         self.assertRaises(ValueError, epoll.unregister, fd)
 
@@ -0,0 +1,47 @@
+import threading
+import unittest
+
+from test.support import import_helper, threading_helper
+
+_testinternalcapi = import_helper.import_module('_testinternalcapi')
+
+
+class Owned:
+    pass
+
+
+@threading_helper.requires_working_threading()
+class TestBiasedRefcount(unittest.TestCase):
+    def test_batches_per_owner(self):
+        # Objects owned by two threads and released by a third one are
+        # collected in one batch per owning thread.
+        nobjects = 8
+        objects = [[], []]
+        tids = [None, None]
+        created = threading.Barrier(3)
+        done = threading.Event()
+
+        def owner(i):
+            tids[i] = _testinternalcapi.py_thread_id()
+            objects[i].extend(Owned() for _ in range(nobjects))
+            created.wait()
+            # Stay alive: the objects of an exited thread are merged
+            # directly.
+            done.wait()
+
+        threads = [threading.Thread(target=owner, args=(i,))
+                   for i in range(2)]
+        with threading_helper.start_threads(threads):
+            try:
+                created.wait()
+                # Alternate the owners.
+                interleaved = [ob for pair in zip(*objects) for ob in pair]
+                objects.clear()
+                batches = _testinternalcapi.brc_clear_list(interleaved)
+            finally:
+                done.set()
+        self.assertEqual(batches, {tids[0]: nobjects, tids[1]: nobjects})
+
+
+if __name__ == "__main__":
+    unittest.main()
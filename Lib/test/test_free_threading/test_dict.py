@@ -142,6 +142,39 @@ def writer_func(l):
             for ref in thread_list:
                 self.assertIsNone(ref())
 
+    def test_racing_reversed_iter(self):
+        """Reversed iteration reads entries without the lock; it must
+        never see a key that is not in the dict"""
+        d = {i: i for i in range(100)}
+        done = False
+
+        def writer_func():
+            nonlocal done
+            for i in range(100, 10_000):
+                d[i] = i
+                del d[i - 100]
+            done = True
+
+        def reader_func():
+            while not done:
+                try:
+                    for k in reversed(d):
+                        self.assertIsInstance(k, int)
+                    for k, v in reversed(d.items()):
+                        self.assertEqual(k, v)
+                except RuntimeError:
+                    # dictionary changed size during iteration
+                    pass
+
+        writer = Thread(target=writer_func)
+        readers = [Thread(target=reader_func) for _ in range(4)]
+        for reader in readers:
+            reader.start()
+        writer.start()
+        writer.join()
+        for reader in readers:
+            reader.join()
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -96,6 +96,30 @@ def reader_func():
 
         self.run_one(writer_func, reader_func)
 
+    def test_attr_cache_replaced_value(self):
+        # Every write frees the previous value, which readers may still
+        # find in their own thread's cache.
+        class Box:
+            def __init__(self, n):
+                self.n = n
+
+        class C:
+            x = Box(0)
+
+        DONE = False
+        def writer_func():
+            for i in range(3000):
+                getattr(C, 'x')
+                C.x = Box(i)
+            nonlocal DONE
+            DONE = True
+
+        def reader_func():
+            while not DONE:
+                self.assertIs(type(getattr(C, 'x')), Box)
+
+        self.run_one(writer_func, reader_func)
+
     def test___class___modification(self):
         loops = 200
 
@@ -692,7 +692,7 @@ def test_not_shareable(self):
         interp = interpreters.create()
         # XXX TypeError?
         with self.assertRaises(ValueError):
-            interp.prepare_main(spam={'spam': 'eggs', 'foo': 'bar'})
+            interp.prepare_main(spam={'eggs', 'ham'})
 
         # Make sure neither was actually bound.
         with self.assertRaises(ExecutionFailed):
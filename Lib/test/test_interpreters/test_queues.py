@@ -287,6 +287,9 @@ def test_put_syncobj(self):
             'spam',
             b'spam',
             (0, 'a'),
+            [0, 'a'],
+            {'a': 13, 'b': [17, 19]},
+            frozenset({0, 'a'}),
         ]:
             with self.subTest(repr(obj)):
                 queue = queues.create()
@@ -300,8 +303,8 @@ def test_put_syncobj(self):
                 self.assertEqual(obj2, obj)
 
         for obj in [
-            [1, 2, 3],
-            {'a': 13, 'b': 17},
+            {1, 2, 3},
+            [1, object()],
         ]:
             with self.subTest(repr(obj)):
                 queue = queues.create()
@@ -316,9 +319,10 @@ def test_put_not_syncobj(self):
             'spam',
             b'spam',
             (0, 'a'),
-            # not shareable
             [1, 2, 3],
             {'a': 13, 'b': 17},
+            # not shareable
+            {1, 2, 3},
         ]:
             with self.subTest(repr(obj)):
                 queue = queues.create()
@@ -352,7 +356,7 @@ def test_put_get_default_syncobj(self):
                 actual = [get() for _ in range(20)]
                 self.assertEqual(actual, expected)
 
-        obj = [1, 2, 3]  # lists are not shareable
+        obj = {1, 2, 3}  # sets are not shareable
         with self.assertRaises(interpreters.NotShareableError):
             queue.put(obj)
 
@@ -368,7 +372,7 @@ def test_put_get_default_not_syncobj(self):
                 actual = [get() for _ in range(20)]
                 self.assertEqual(actual, expected)
 
-                obj = [1, 2, 3]  # lists are not shareable
+                obj = {1, 2, 3}  # sets are not shareable
                 queue.put(obj)
                 obj2 = get()
                 self.assertEqual(obj, obj2)
@@ -428,6 +432,39 @@ def test_put_get_different_interpreters(self):
                 self.assertEqual(obj2, b'eggs')
                 self.assertNotEqual(id(obj2), int(out))
 
+    def test_put_get_container(self):
+        queue = queues.create()
+        interp = interpreters.create()
+        interp.exec(dedent(f"""
+            from test.support.interpreters import queues
+            queue = queues.Queue({queue.id})
+            obj = {{'spam': [1, 2.0, b'eggs'], 'ham': (None, True)}}
+            queue.put(obj, syncobj=True)
+            # The receiver gets a copy.
+            obj['spam'].append(3)
+            """))
+        # The copy is independent of the interpreter which created it.
+        interp.close()
+
+        obj = queue.get_nowait()
+        self.assertEqual(obj, {'spam': [1, 2.0, b'eggs'], 'ham': (None, True)})
+
+    def test_put_get_shared_buffer(self):
+        queue = queues.create()
+        interp = interpreters.create()
+        interp.exec(dedent(f"""
+            from test.support import interpreters
+            from test.support.interpreters import queues
+            queue = queues.Queue({queue.id})
+            queue.put(interpreters.SharedBuffer(b'spam' * 1000), syncobj=True)
+            """))
+        # The buffer is independent of the interpreter which created it.
+        interp.close()
+
+        buf = queue.get_nowait()
+        self.assertIsInstance(buf, interpreters.SharedBuffer)
+        self.assertEqual(bytes(buf), b'spam' * 1000)
+
     def test_put_cleared_with_subinterpreter(self):
         def common(queue, unbound=None, presize=0):
             if not unbound:
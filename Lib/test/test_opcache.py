@@ -58,7 +58,7 @@ def f(self):
         self.assertEqual(calls, [(d, D)])
 
 
-class TestLoadAttrCache(unittest.TestCase):
+class TestLoadAttrCache(TestBase):
     def test_descriptor_added_after_optimization(self):
         class Descriptor:
             pass
@@ -301,6 +301,65 @@ def f(o):
             with self.assertRaises(TypeError):
                 f(o)
 
+    @requires_specialization
+    def test_getattr_fallback(self):
+        class Class:
+            def __getattr__(self, name):
+                return name.upper()
+
+        def f(o):
+            return o.missing
+
+        o = Class()
+        for _ in range(1025):
+            self.assertEqual(f(o), "MISSING")
+        self.assert_specialized(f, "LOAD_ATTR_GETATTR_FALLBACK")
+
+        def raising(self, name):
+            raise AttributeError(name)
+
+        Class.__getattr__ = raising
+        for _ in range(1025):
+            with self.assertRaises(AttributeError):
+                f(o)
+
+        Class.__getattr__ = lambda self, name: name
+        o.missing = 42
+        for _ in range(1025):
+            self.assertEqual(f(o), 42)
+        self.assertEqual(f(Class()), "missing")
+
+    @requires_specialization
+    def test_descriptor_get(self):
+        class Descriptor:
+            def __get__(self, instance, owner):
+                return (self, instance, owner)
+
+        class Class:
+            d = Descriptor()
+
+        def f(o):
+            return o.d
+
+        o = Class()
+        for _ in range(1025):
+            self.assertEqual(f(o), (Class.__dict__["d"], o, Class))
+        self.assert_specialized(f, "LOAD_ATTR_DESCRIPTOR_GET")
+
+        Descriptor.__get__ = lambda self, instance, owner: "changed"
+        for _ in range(1025):
+            self.assertEqual(f(o), "changed")
+
+        # A non-data descriptor is shadowed by the instance...
+        o.d = 42
+        for _ in range(1025):
+            self.assertEqual(f(o), 42)
+
+        # ...but a data descriptor is not.
+        Descriptor.__set__ = lambda self, instance, value: None
+        for _ in range(1025):
+            self.assertEqual(f(o), "changed")
+
 
 class TestLoadMethodCache(unittest.TestCase):
     def test_descriptor_added_after_optimization(self):
@@ -537,6 +596,82 @@ def count_args(self, *args):
         MyClass.__init__.__code__ = count_args.__code__
         instantiate()
 
+    @disabling_optimizer
+    @requires_specialization
+    def test_call_kw_builtin_fast(self):
+        def f(x):
+            return sorted(x, reverse=True)
+
+        for _ in range(1025):
+            self.assertEqual(f([1, 3, 2]), [3, 2, 1])
+        self.assert_specialized(f, "CALL_KW_BUILTIN_FAST")
+        with self.assertRaises(TypeError):
+            f(None)
+
+    @disabling_optimizer
+    @requires_specialization
+    def test_call_kw_method_descriptor_fast(self):
+        def f(meth, s):
+            return meth(s, sep=",")
+
+        for _ in range(1025):
+            self.assertEqual(f(str.split, "a,b"), ["a", "b"])
+        self.assert_specialized(f, "CALL_KW_METHOD_DESCRIPTOR_FAST")
+        # A different self type or callable takes the generic path:
+        with self.assertRaises(TypeError):
+            f(str.split, b"a,b")
+        class S(str):
+            pass
+        self.assertEqual(f(str.split, S("a,b")), ["a", "b"])
+        self.assertEqual(f(str.rsplit, "a,b"), ["a", "b"])
+
+
+@requires_specialization
+class TestBinaryOpCache(TestBase):
+    @disabling_optimizer
+    def test_mixed_int_float(self):
+        def f(a, b):
+            return (a + b, a - b, a * b)
+
+        for _ in range(1025):
+            self.assertEqual(f(2, 0.5), (2.5, 1.5, 1.0))
+            self.assertEqual(f(0.5, 2), (2.5, -1.5, 1.0))
+        self.assert_specialized(f, "BINARY_OP_MIXED_INT_FLOAT")
+        self.assertEqual(f(2, 3), (5, -1, 6))
+        with self.assertRaises(OverflowError):
+            f(1 << 2000, 0.5)
+        with self.assertRaises(OverflowError):
+            f(0.5, 1 << 2000)
+
+    @disabling_optimizer
+    def test_extend_list(self):
+        def f(a, b):
+            a += b
+            return a
+
+        for _ in range(1025):
+            a = [1]
+            self.assertIs(f(a, (2,)), a)
+            self.assertEqual(a, [1, 2])
+        self.assert_specialized(f, "BINARY_OP_EXTEND_LIST")
+        a = [1]
+        self.assertIs(f(a, a), a)
+        self.assertEqual(a, [1, 1])
+        self.assertEqual(f((1,), (2,)), (1, 2))
+
+    @disabling_optimizer
+    def test_remainder_unicode(self):
+        def f(fmt, args):
+            return fmt % args
+
+        for _ in range(1025):
+            self.assertEqual(f("%s-%d", ("a", 1)), "a-1")
+        self.assert_specialized(f, "BINARY_OP_REMAINDER_UNICODE")
+        self.assertEqual(f("%s", "a"), "a")
+        self.assertEqual(f(7, 4), 3)
+        with self.assertRaises(TypeError):
+            f("%d", ("a",))
+
 
 @threading_helper.requires_working_threading()
 @requires_specialization
@@ -1009,6 +1009,23 @@ class C:
             gc_collect()  # For PyPy or other GCs.
             self.assertIsNone(wr())
 
+    def test_many_items(self):
+        # The C implementation stores the items in chunks
+        q = self.q
+        N = 1000
+        for i in range(N):
+            q.put(i)
+        self.assertEqual(q.qsize(), N)
+        for i in range(N // 2):
+            self.assertEqual(q.get(), i)
+        for i in range(N, 2 * N):
+            q.put_nowait(i)
+        self.assertEqual(q.qsize(), N + N // 2)
+        for i in range(N // 2, 2 * N):
+            self.assertEqual(q.get_nowait(), i)
+        self.assertTrue(q.empty())
+        self.assertEqual(q.qsize(), 0)
+
 
 class PySimpleQueueTest(BaseSimpleQueueTest, unittest.TestCase):
 
@@ -1031,6 +1048,17 @@ def test_is_default(self):
         self.assertIs(self.type2test, self.queue.SimpleQueue)
         self.assertIs(self.type2test, self.queue.SimpleQueue)
 
+    def test_gc(self):
+        # The items of a queue are visited by the garbage collector
+        q = self.q
+        for i in range(100):
+            q.put(i)
+        q.put(q)
+        wr = weakref.ref(q)
+        del q, self.q
+        gc_collect()
+        self.assertIsNone(wr())
+
     def test_reentrancy(self):
         # bpo-14976: put() may be called reentrantly in an asynchronous
         # callback.
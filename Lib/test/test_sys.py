@@ -24,6 +24,7 @@
 import textwrap
 import unittest
 import warnings
+import weakref
 
 
 def requires_subinterpreters(meth):
@@ -731,6 +732,103 @@ def __hash__(self):
         if has_is_interned:
             self.assertIs(sys._is_interned(S("abc")), False)
 
+    @support.cpython_only
+    def test_defer_refcount(self):
+        self.assertRaises(TypeError, sys._defer_refcount)
+        d = {'a': 1}
+        lst = [1, 2, 3]
+        if support.Py_GIL_DISABLED:
+            self.assertIs(sys._defer_refcount(d), True)
+            self.assertIs(sys._defer_refcount(d), False)
+            self.assertIs(sys._defer_refcount(lst), True)
+        else:
+            self.assertIs(sys._defer_refcount(d), False)
+            self.assertIs(sys._defer_refcount(lst), False)
+        # Objects that are not tracked by the GC are never deferred
+        self.assertIs(sys._defer_refcount(12345678901234567890), False)
+        self.assertIs(sys._defer_refcount("unique string " + str(id(d))),
+                      False)
+        self.assertIs(sys._defer_refcount(None), False)
+
+        # The objects keep working, and are freed by the GC once unreachable
+        d['b'] = lst
+        lst.append(d)
+        self.assertEqual(d['b'][:3], [1, 2, 3])
+
+        class C:
+            pass
+        obj = C()
+        obj.attr = d
+        self.assertIs(sys._defer_refcount(obj), support.Py_GIL_DISABLED)
+        ref = weakref.ref(obj)
+        del d, lst, obj
+        gc.collect()
+        self.assertIsNone(ref())
+
+    @support.cpython_only
+    def test_freelist_stats(self):
+        stats = sys._freelist_stats()
+        self.assertIn('floats', stats)
+        self.assertIn('tuples[1]', stats)
+        self.assertIn('tuples[20]', stats)
+        for name, fl in stats.items():
+            with self.subTest(name=name):
+                self.assertEqual(set(fl), {'size', 'capacity', 'hits',
+                                           'misses', 'overflows', 'bytes'})
+                self.assertLessEqual(fl['size'], fl['capacity'])
+                if fl['size'] == 0:
+                    self.assertEqual(fl['bytes'], 0)
+
+        def churn():
+            for _ in range(20):
+                xs = [float(i) for i in range(1000)]
+                del xs
+        before = sys._freelist_stats()['floats']
+        churn()
+        after = sys._freelist_stats()['floats']
+        self.assertGreater(after['hits'], before['hits'])
+        self.assertGreater(after['overflows'], before['overflows'])
+        self.assertEqual(after['bytes'], after['size'] * sys.getsizeof(1.0))
+        if support.Py_GIL_DISABLED:
+            # The free list grew to fit more of the churned floats
+            self.assertGreater(after['capacity'], 100)
+
+    @support.cpython_only
+    def test_qsbr_stats(self):
+        stats = sys._get_qsbr_stats()
+        self.assertEqual(set(stats),
+                         {'backlog', 'reclaimed', 'forced_reclaims',
+                          'memory_limit'})
+        self.assertRaises(ValueError, sys._set_qsbr_memory_limit, -1)
+        old_limit = stats['memory_limit']
+        self.addCleanup(sys._set_qsbr_memory_limit, old_limit)
+        sys._set_qsbr_memory_limit(1 << 20)
+        self.assertEqual(sys._get_qsbr_stats()['memory_limit'], 1 << 20)
+
+    @support.cpython_only
+    @unittest.skipUnless(support.Py_GIL_DISABLED, 'need Py_GIL_DISABLED')
+    @threading_helper.requires_working_threading()
+    def test_qsbr_reclaim(self):
+        import threading
+        # Resizing a dict shared by several threads delays freeing the old
+        # keys until all threads have passed a quiescent state
+        shared = {}
+        def work():
+            for i in range(10_000):
+                shared[i] = i
+                if len(shared) > 2_000:
+                    shared.clear()
+
+        before = sys._get_qsbr_stats()['reclaimed']
+        threads = [threading.Thread(target=work) for _ in range(4)]
+        with threading_helper.start_threads(threads):
+            pass
+        # A collection stops the world and frees everything pending
+        gc.collect()
+        stats = sys._get_qsbr_stats()
+        self.assertEqual(stats['backlog'], 0)
+        self.assertGreater(stats['reclaimed'], before)
+
     @support.cpython_only
     @requires_subinterpreters
     def test_subinterp_intern_dynamically_allocated(self):
@@ -1715,7 +1813,7 @@ def delx(self): del self.__x
                   '10P'                 # PySequenceMethods
                   '2P'                  # PyBufferProcs
                   '7P'
-                  '1PIP'                # Specializer cache
+                  '1PIPPIPI'            # Specializer cache
                   + typeid              # heap type id (free-threaded only)
                   )
         class newstyleclass(object): pass
@@ -331,6 +331,8 @@ def wrapped(*args, **kwargs):
 NoneType = type(None)
 NotImplementedType = type(NotImplemented)
 
+from _collections import frozendict
+
 def __getattr__(name):
     if name == 'CapsuleType':
         import _socket
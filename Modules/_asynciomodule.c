@@ -6,6 +6,7 @@
 #include "pycore_critical_section.h"  // Py_BEGIN_CRITICAL_SECTION_MUT()
 #include "pycore_dict.h"          // _PyDict_GetItem_KnownHash()
 #include "pycore_freelist.h"      // _Py_FREELIST_POP()
+#include "pycore_list.h"          // _PyList_AppendTakeRef()
 #include "pycore_modsupport.h"    // _PyArg_CheckPositional()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "pycore_object.h"        // _Py_SetImmortalUntracked
@@ -70,6 +71,47 @@ typedef struct {
     PyObject *sw_arg;
 } TaskStepMethWrapper;
 
+typedef struct {
+    PyObject_HEAD
+    PyObject *h_callback;
+    PyObject *h_args;
+    PyObject *h_loop;
+    PyObject *h_context;
+    PyObject *h_source_tb;
+    PyObject *h_repr;
+    char h_cancelled;
+} HandleObj;
+
+typedef struct {
+    HandleObj th_base;
+    PyObject *th_when;
+    char th_scheduled;
+} TimerHandleObj;
+
+typedef struct {
+    FutureObj_HEAD(gf)
+    unsigned gf_return_exceptions: 1;
+    unsigned gf_cancel_requested: 1;
+    Py_ssize_t gf_nfuts;
+    Py_ssize_t gf_nfinished;
+    PyObject *gf_children;
+} GatheringFutureObj;
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *tg_loop;
+    PyObject *tg_parent_task;
+    PyObject *tg_tasks;
+    PyObject *tg_errors;
+    PyObject *tg_base_error;
+    PyObject *tg_on_completed_fut;
+    PyObject *tg_on_task_done;
+    char tg_entered;
+    char tg_exiting;
+    char tg_aborting;
+    char tg_parent_cancel_requested;
+} TaskGroupObj;
+
 
 #define Future_CheckExact(state, obj) Py_IS_TYPE(obj, state->FutureType)
 #define Task_CheckExact(state, obj) Py_IS_TYPE(obj, state->TaskType)
@@ -77,6 +119,12 @@ typedef struct {
 #define Future_Check(state, obj) PyObject_TypeCheck(obj, state->FutureType)
 #define Task_Check(state, obj) PyObject_TypeCheck(obj, state->TaskType)
 
+#define Handle_CheckExact(state, obj) Py_IS_TYPE(obj, state->HandleType)
+#define TimerHandle_CheckExact(state, obj) \
+    Py_IS_TYPE(obj, state->TimerHandleType)
+#define TimerHandle_Check(state, obj) \
+    PyObject_TypeCheck(obj, state->TimerHandleType)
+
 #ifdef Py_GIL_DISABLED
 #   define ASYNCIO_STATE_LOCK(state) Py_BEGIN_CRITICAL_SECTION_MUT(&state->mutex)
 #   define ASYNCIO_STATE_UNLOCK(state) Py_END_CRITICAL_SECTION()
@@ -96,9 +144,18 @@ typedef struct {
     PyTypeObject *TaskStepMethWrapper_Type;
     PyTypeObject *FutureType;
     PyTypeObject *TaskType;
+    PyTypeObject *HandleType;
+    PyTypeObject *TimerHandleType;
+    PyTypeObject *GatheringFutureType;
+    PyTypeObject *TaskGroupBaseType;
 
     PyObject *asyncio_mod;
     PyObject *context_kwname;
+    PyObject *debug_kwname;
+    PyObject *loop_kwname;
+    PyObject *msg_kwname;
+    PyObject *name_kwname;
+    PyObject *name_context_kwnames;
 
     /* Dictionary containing tasks that are currently active in
        all running event loops.  {EventLoop: Task} */
@@ -132,9 +189,16 @@ typedef struct {
     /* Imports from asyncio.coroutines. */
     PyObject *asyncio_iscoroutine_func;
 
+    /* Imports from asyncio.format_helpers. */
+    PyObject *asyncio_extract_stack_func;
+    PyObject *asyncio_format_callback_source_func;
+
     /* Imports from traceback. */
     PyObject *traceback_extract_stack;
 
+    /* Imports from heapq. */
+    PyObject *heapq_heappop;
+
     /* Counter for autogenerated Task names */
     uint64_t task_name_counter;
 
@@ -3251,197 +3315,1994 @@ task_wakeup(TaskObj *task, PyObject *o)
 }
 
 
-/*********************** Functions **************************/
+/*********************** Gather **************************/
 
 
 /*[clinic input]
-_asyncio._get_running_loop
-
-Return the running event loop or None.
+class _asyncio._GatheringFuture "GatheringFutureObj *" "&GatheringFuture_Type"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=d57e08759d60c718]*/
 
-This is a low-level function intended to be used by event loops.
-This function is thread-specific.
 
-[clinic start generated code]*/
+/* Fast paths for the futures and tasks implemented in this module.  Other
+   futures, including subclasses which may override the methods, are
+   handled by calling their methods. */
 
-static PyObject *
-_asyncio__get_running_loop_impl(PyObject *module)
-/*[clinic end generated code: output=b4390af721411a0a input=0a21627e25a4bd43]*/
+static int
+future_done_any(asyncio_state *state, PyObject *fut)
 {
-    _PyThreadStateImpl *ts = (_PyThreadStateImpl *)_PyThreadState_GET();
-    PyObject *loop = Py_XNewRef(ts->asyncio_running_loop);
-    if (loop == NULL) {
-        /* There's no currently running event loop */
-        Py_RETURN_NONE;
+    if (Future_CheckExact(state, fut) || Task_CheckExact(state, fut)) {
+        FutureObj *f = (FutureObj *)fut;
+        return future_is_alive(f) && f->fut_state != STATE_PENDING;
     }
-    return loop;
+    PyObject *res = PyObject_CallMethodNoArgs(fut, &_Py_ID(done));
+    if (res == NULL) {
+        return -1;
+    }
+    int is_true = PyObject_IsTrue(res);
+    Py_DECREF(res);
+    return is_true;
 }
 
-/*[clinic input]
-_asyncio._set_running_loop
-    loop: 'O'
-    /
-
-Set the running event loop.
-
-This is a low-level function intended to be used by event loops.
-This function is thread-specific.
-[clinic start generated code]*/
+static int
+future_cancelled_any(asyncio_state *state, PyObject *fut)
+{
+    if (Future_CheckExact(state, fut) || Task_CheckExact(state, fut)) {
+        FutureObj *f = (FutureObj *)fut;
+        return future_is_alive(f) && f->fut_state == STATE_CANCELLED;
+    }
+    PyObject *res = PyObject_CallMethodNoArgs(fut, &_Py_ID(cancelled));
+    if (res == NULL) {
+        return -1;
+    }
+    int is_true = PyObject_IsTrue(res);
+    Py_DECREF(res);
+    return is_true;
+}
 
+/* Return the exception of a done future, or None. */
 static PyObject *
-_asyncio__set_running_loop(PyObject *module, PyObject *loop)
-/*[clinic end generated code: output=ae56bf7a28ca189a input=4c9720233d606604]*/
+future_exception_any(asyncio_state *state, PyObject *fut)
 {
-    _PyThreadStateImpl *ts = (_PyThreadStateImpl *)_PyThreadState_GET();
-    if (loop == Py_None) {
-        loop = NULL;
+    if (Future_CheckExact(state, fut) || Task_CheckExact(state, fut)) {
+        FutureObj *f = (FutureObj *)fut;
+        if (future_is_alive(f) && f->fut_state == STATE_FINISHED) {
+            if (f->fut_exception == NULL) {
+                Py_RETURN_NONE;
+            }
+            f->fut_log_tb = 0;
+            return Py_NewRef(f->fut_exception);
+        }
     }
-    Py_XSETREF(ts->asyncio_running_loop, Py_XNewRef(loop));
-    Py_RETURN_NONE;
+    return PyObject_CallMethodNoArgs(fut, &_Py_ID(exception));
 }
 
-/*[clinic input]
-_asyncio.get_event_loop
-
-Return an asyncio event loop.
-
-When called from a coroutine or a callback (e.g. scheduled with
-call_soon or similar API), this function will always return the
-running event loop.
-
-If there is no running event loop set, the function will return
-the result of `get_event_loop_policy().get_event_loop()` call.
-[clinic start generated code]*/
-
 static PyObject *
-_asyncio_get_event_loop_impl(PyObject *module)
-/*[clinic end generated code: output=2a2d8b2f824c648b input=9364bf2916c8655d]*/
+future_result_any(asyncio_state *state, PyObject *fut)
 {
-    asyncio_state *state = get_asyncio_state(module);
-    return get_event_loop(state);
+    if (Future_CheckExact(state, fut) || Task_CheckExact(state, fut)) {
+        FutureObj *f = (FutureObj *)fut;
+        if (future_is_alive(f) && f->fut_state == STATE_FINISHED
+            && f->fut_exception == NULL)
+        {
+            return Py_NewRef(f->fut_result);
+        }
+    }
+    return PyObject_CallMethodNoArgs(fut, &_Py_ID(result));
 }
 
-/*[clinic input]
-_asyncio.get_running_loop
-
-Return the running event loop.  Raise a RuntimeError if there is none.
-
-This function is thread-specific.
-[clinic start generated code]*/
-
 static PyObject *
-_asyncio_get_running_loop_impl(PyObject *module)
-/*[clinic end generated code: output=c247b5f9e529530e input=2a3bf02ba39f173d]*/
+future_make_cancelled_error_any(asyncio_state *state, PyObject *fut)
 {
-    PyObject *loop;
-    _PyThreadStateImpl *ts = (_PyThreadStateImpl *)_PyThreadState_GET();
-    loop = Py_XNewRef(ts->asyncio_running_loop);
-    if (loop == NULL) {
-        /* There's no currently running event loop */
-        PyErr_SetString(
-            PyExc_RuntimeError, "no running event loop");
-        return NULL;
+    if (Future_CheckExact(state, fut) || Task_CheckExact(state, fut)) {
+        return create_cancelled_error(state, (FutureObj *)fut);
     }
-    return loop;
+    return PyObject_CallMethodNoArgs(fut, &_Py_ID(_make_cancelled_error));
 }
 
-/*[clinic input]
-_asyncio._register_task
-
-    task: object
-
-Register a new task in asyncio as executed by loop.
-
-Returns None.
-[clinic start generated code]*/
-
-static PyObject *
-_asyncio__register_task_impl(PyObject *module, PyObject *task)
-/*[clinic end generated code: output=8672dadd69a7d4e2 input=21075aaea14dfbad]*/
+/* Add fn to the done callbacks of fut, running it in ctx. */
+static int
+future_add_done_callback_any(asyncio_state *state, PyObject *fut,
+                             PyObject *fn, PyObject *ctx)
 {
-    asyncio_state *state = get_asyncio_state(module);
-    if (Task_Check(state, task)) {
-        // task is an asyncio.Task instance or subclass, use efficient
-        // linked-list implementation.
-        register_task(state, (TaskObj *)task);
-        Py_RETURN_NONE;
+    PyObject *res;
+    if (Future_CheckExact(state, fut) || Task_CheckExact(state, fut)) {
+        res = future_add_done_callback(state, (FutureObj *)fut, fn, ctx);
+    }
+    else {
+        PyObject *stack[] = {fut, fn, ctx};
+        size_t nargsf = 2 | PY_VECTORCALL_ARGUMENTS_OFFSET;
+        res = PyObject_VectorcallMethod(&_Py_ID(add_done_callback), stack,
+                                        nargsf, state->context_kwname);
     }
-    // As task does not inherit from asyncio.Task, fallback to less efficient
-    // weakset implementation.
-    PyObject *res = PyObject_CallMethodOneArg(state->non_asyncio_tasks,
-                                              &_Py_ID(add), task);
     if (res == NULL) {
-        return NULL;
+        return -1;
     }
     Py_DECREF(res);
-    Py_RETURN_NONE;
+    return 0;
 }
 
-/*[clinic input]
-_asyncio._register_eager_task
-
-    task: object
-
-Register a new task in asyncio as executed by loop.
-
-Returns None.
-[clinic start generated code]*/
-
-static PyObject *
-_asyncio__register_eager_task_impl(PyObject *module, PyObject *task)
-/*[clinic end generated code: output=dfe1d45367c73f1a input=237f684683398c51]*/
+static int
+future_set_result_any(asyncio_state *state, PyObject *fut, PyObject *result)
 {
-    asyncio_state *state = get_asyncio_state(module);
-    if (register_eager_task(state, task) < 0) {
-        return NULL;
+    PyObject *res;
+    if (Future_CheckExact(state, fut) || Task_CheckExact(state, fut)) {
+        res = future_set_result(state, (FutureObj *)fut, result);
     }
-    Py_RETURN_NONE;
+    else {
+        res = PyObject_CallMethodOneArg(fut, &_Py_ID(set_result), result);
+    }
+    if (res == NULL) {
+        return -1;
+    }
+    Py_DECREF(res);
+    return 0;
 }
 
 
-/*[clinic input]
-_asyncio._unregister_task
-
-    task: object
+/* Implementation of asyncio.tasks.ensure_future() for gather(): loop is
+   NULL until the first child is known. */
+static PyObject *
+gather_ensure_future(asyncio_state *state, PyObject *arg, PyObject *loop)
+{
+    if (Future_Check(state, arg)) {
+        if (loop != NULL) {
+            PyObject *fut_loop = get_future_loop(state, arg);
+            if (fut_loop == NULL) {
+                return NULL;
+            }
+            Py_DECREF(fut_loop);
+            if (fut_loop != loop) {
+                PyErr_SetString(PyExc_ValueError,
+                                "The future belongs to a different loop than "
+                                "the one specified as the loop argument");
+                return NULL;
+            }
+        }
+        return Py_NewRef(arg);
+    }
 
-Unregister a task.
+    int is_coro = is_coroutine(state, arg);
+    if (is_coro < 0) {
+        return NULL;
+    }
+    if (!is_coro) {
+        /* Other futures and awaitables */
+        PyObject *ensure_future = PyObject_GetAttr(state->asyncio_mod,
+                                                   &_Py_ID(ensure_future));
+        if (ensure_future == NULL) {
+            return NULL;
+        }
+        PyObject *fut;
+        if (loop == NULL) {
+            fut = PyObject_CallOneArg(ensure_future, arg);
+        }
+        else {
+            PyObject *stack[] = {arg, loop};
+            fut = PyObject_Vectorcall(ensure_future, stack, 1,
+                                      state->loop_kwname);
+        }
+        Py_DECREF(ensure_future);
+        return fut;
+    }
 
-Returns None.
-[clinic start generated code]*/
+    if (loop == NULL) {
+        loop = get_event_loop(state);
+        if (loop == NULL) {
+            return NULL;
+        }
+    }
+    else {
+        Py_INCREF(loop);
+    }
+    PyObject *task = PyObject_CallMethodOneArg(loop, &_Py_ID(create_task),
+                                               arg);
+    Py_DECREF(loop);
+    if (task == NULL && PyErr_ExceptionMatches(PyExc_RuntimeError)) {
+        PyObject *exc = PyErr_GetRaisedException();
+        PyObject *res = PyObject_CallMethodNoArgs(arg, &_Py_ID(close));
+        if (res == NULL) {
+            _PyErr_ChainExceptions1(exc);
+        }
+        else {
+            Py_DECREF(res);
+            PyErr_SetRaisedException(exc);
+        }
+    }
+    return task;
+}
 
-static PyObject *
-_asyncio__unregister_task_impl(PyObject *module, PyObject *task)
-/*[clinic end generated code: output=6e5585706d568a46 input=28fb98c3975f7bdc]*/
+static int
+gathering_future_set_exception(asyncio_state *state, GatheringFutureObj *outer,
+                               PyObject *exc)
 {
-    asyncio_state *state = get_asyncio_state(module);
-    if (Task_Check(state, task)) {
-        unregister_task(state, (TaskObj *)task);
-        Py_RETURN_NONE;
+    if (exc == NULL) {
+        return -1;
     }
-    PyObject *res = PyObject_CallMethodOneArg(state->non_asyncio_tasks,
-                                              &_Py_ID(discard), task);
+    PyObject *res = future_set_exception(state, (FutureObj *)outer, exc);
+    Py_DECREF(exc);
     if (res == NULL) {
-        return NULL;
+        return -1;
     }
     Py_DECREF(res);
-    Py_RETURN_NONE;
+    return 0;
 }
 
-/*[clinic input]
-_asyncio._unregister_eager_task
+/* All the children are done: set the list of their results. */
+static int
+gathering_future_finish(asyncio_state *state, GatheringFutureObj *outer)
+{
+    PyObject *children = Py_NewRef(outer->gf_children);
+    Py_ssize_t n = PyList_GET_SIZE(children);
+    PyObject *fut = NULL;
+    PyObject *results = PyList_New(n);
+    if (results == NULL) {
+        goto error;
+    }
 
-    task: object
+    for (Py_ssize_t i = 0; i < n; i++) {
+        PyObject *res;
+        fut = PyList_GET_ITEM(children, i);
+        int cancelled = future_cancelled_any(state, fut);
+        if (cancelled < 0) {
+            goto error;
+        }
+        if (cancelled) {
+            /* Since the exception is added to the results instead of
+               being raised, don't call _make_cancelled_error() which
+               sets __context__. */
+            PyObject *msg;
+            if (Future_CheckExact(state, fut) || Task_CheckExact(state, fut)) {
+                msg = Py_XNewRef(((FutureObj *)fut)->fut_cancel_msg);
+            }
+            else {
+                msg = PyObject_GetAttr(fut, &_Py_ID(_cancel_message));
+                if (msg == NULL) {
+                    goto error;
+                }
+            }
+            if (msg == NULL || msg == Py_None) {
+                Py_XSETREF(msg, Py_GetConstant(Py_CONSTANT_EMPTY_STR));
+            }
+            res = PyObject_CallOneArg(state->asyncio_CancelledError, msg);
+            Py_DECREF(msg);
+        }
+        else {
+            res = future_exception_any(state, fut);
+            if (res == Py_None) {
+                Py_DECREF(res);
+                res = future_result_any(state, fut);
+            }
+        }
+        if (res == NULL) {
+            goto error;
+        }
+        PyList_SET_ITEM(results, i, res);
+    }
 
-Unregister a task.
+    int err;
+    if (outer->gf_cancel_requested) {
+        /* If gather is being cancelled we must propagate the cancellation
+           regardless of return_exceptions.  See issue 32684. */
+        err = gathering_future_set_exception(
+            state, outer, future_make_cancelled_error_any(state, fut));
+    }
+    else {
+        PyObject *res = future_set_result(state, (FutureObj *)outer, results);
+        err = res == NULL ? -1 : 0;
+        Py_XDECREF(res);
+    }
+    Py_DECREF(results);
+    Py_DECREF(children);
+    return err;
 
-Returns None.
-[clinic start generated code]*/
+error:
+    Py_XDECREF(results);
+    Py_DECREF(children);
+    return -1;
+}
 
+/* Done callback of the children of a gather(). */
 static PyObject *
-_asyncio__unregister_eager_task_impl(PyObject *module, PyObject *task)
-/*[clinic end generated code: output=a426922bd07f23d1 input=9d07401ef14ee048]*/
+gathering_future_child_done(PyObject *self, PyObject *fut)
 {
-    asyncio_state *state = get_asyncio_state(module);
+    GatheringFutureObj *outer = (GatheringFutureObj *)self;
+    asyncio_state *state = get_asyncio_state_by_def(self);
+
+    outer->gf_nfinished++;
+
+    /* The outer future is not initialized if gather() failed. */
+    if (!future_is_alive((FutureObj *)outer)
+        || outer->gf_state != STATE_PENDING)
+    {
+        int cancelled = future_cancelled_any(state, fut);
+        if (cancelled < 0) {
+            return NULL;
+        }
+        if (!cancelled) {
+            /* Mark exception retrieved. */
+            PyObject *exc = future_exception_any(state, fut);
+            if (exc == NULL) {
+                return NULL;
+            }
+            Py_DECREF(exc);
+        }
+        Py_RETURN_NONE;
+    }
+
+    if (!outer->gf_return_exceptions) {
+        int cancelled = future_cancelled_any(state, fut);
+        if (cancelled < 0) {
+            return NULL;
+        }
+        if (cancelled) {
+            /* fut.exception() would raise the CancelledError instead of
+               returning it. */
+            if (gathering_future_set_exception(
+                    state, outer, future_make_cancelled_error_any(state, fut)) < 0)
+            {
+                return NULL;
+            }
+            Py_RETURN_NONE;
+        }
+        PyObject *exc = future_exception_any(state, fut);
+        if (exc == NULL) {
+            return NULL;
+        }
+        if (exc != Py_None) {
+            if (gathering_future_set_exception(state, outer, exc) < 0) {
+                return NULL;
+            }
+            Py_RETURN_NONE;
+        }
+        Py_DECREF(exc);
+    }
+
+    if (outer->gf_nfinished == outer->gf_nfuts) {
+        if (gathering_future_finish(state, outer) < 0) {
+            return NULL;
+        }
+    }
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef gathering_future_child_done_def = {
+    "_done_callback", gathering_future_child_done, METH_O, NULL
+};
+
+/*[clinic input]
+_asyncio._GatheringFuture.cancel
+
+    msg: object = None
+
+Cancel the children which are not done yet.
+
+Unlike Future.cancel(), the future is not marked as cancelled: it is
+done when all the children are done.  Return True if a child was
+cancelled.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__GatheringFuture_cancel_impl(GatheringFutureObj *self,
+                                      PyObject *msg)
+/*[clinic end generated code: output=41b11b1a203dc649 input=d5ecacf1854b4610]*/
+{
+    asyncio_state *state = get_asyncio_state_by_def((PyObject *)self);
+    if (!future_is_alive((FutureObj *)self)
+        || self->gf_state != STATE_PENDING)
+    {
+        Py_RETURN_FALSE;
+    }
+
+    int ret = 0;
+    PyObject *children = Py_NewRef(self->gf_children);
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(children); i++) {
+        PyObject *stack[] = {PyList_GET_ITEM(children, i), msg};
+        size_t nargsf = 1 | PY_VECTORCALL_ARGUMENTS_OFFSET;
+        PyObject *res = PyObject_VectorcallMethod(&_Py_ID(cancel), stack,
+                                                  nargsf, state->msg_kwname);
+        if (res == NULL) {
+            Py_DECREF(children);
+            return NULL;
+        }
+        int is_true = PyObject_IsTrue(res);
+        Py_DECREF(res);
+        if (is_true < 0) {
+            Py_DECREF(children);
+            return NULL;
+        }
+        ret |= is_true;
+    }
+    Py_DECREF(children);
+
+    if (ret) {
+        /* If any child tasks were actually cancelled, we should propagate
+           the cancellation request regardless of return_exceptions.
+           See issue 32684. */
+        self->gf_cancel_requested = 1;
+    }
+    return PyBool_FromLong(ret);
+}
+
+static PyObject *
+GatheringFutureObj_get_cancel_requested(GatheringFutureObj *fut,
+                                        void *Py_UNUSED(ignored))
+{
+    return PyBool_FromLong(fut->gf_cancel_requested);
+}
+
+static int
+GatheringFutureObj_set_cancel_requested(GatheringFutureObj *fut,
+                                        PyObject *val,
+                                        void *Py_UNUSED(ignored))
+{
+    if (val == NULL) {
+        PyErr_SetString(PyExc_AttributeError, "cannot delete attribute");
+        return -1;
+    }
+    int is_true = PyObject_IsTrue(val);
+    if (is_true < 0) {
+        return -1;
+    }
+    fut->gf_cancel_requested = is_true;
+    return 0;
+}
+
+static int
+GatheringFutureObj_clear(GatheringFutureObj *fut)
+{
+    Py_CLEAR(fut->gf_children);
+    return FutureObj_clear((FutureObj *)fut);
+}
+
+static int
+GatheringFutureObj_traverse(GatheringFutureObj *fut, visitproc visit,
+                            void *arg)
+{
+    Py_VISIT(fut->gf_children);
+    return FutureObj_traverse((FutureObj *)fut, visit, arg);
+}
+
+static void
+GatheringFutureObj_dealloc(PyObject *self)
+{
+    if (PyObject_CallFinalizerFromDealloc(self) < 0) {
+        // resurrected.
+        return;
+    }
+
+    PyTypeObject *tp = Py_TYPE(self);
+    PyObject_GC_UnTrack(self);
+
+    PyObject_ClearWeakRefs(self);
+
+    (void)GatheringFutureObj_clear((GatheringFutureObj *)self);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+static PyMethodDef GatheringFutureType_methods[] = {
+    _ASYNCIO__GATHERINGFUTURE_CANCEL_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyMemberDef GatheringFutureType_members[] = {
+    {"_children", _Py_T_OBJECT, offsetof(GatheringFutureObj, gf_children),
+     Py_READONLY},
+    {NULL},
+};
+
+static PyGetSetDef GatheringFutureType_getsetlist[] = {
+    {"_cancel_requested",
+     (getter)GatheringFutureObj_get_cancel_requested,
+     (setter)GatheringFutureObj_set_cancel_requested, NULL},
+    {NULL} /* Sentinel */
+};
+
+PyDoc_STRVAR(GatheringFuture_doc,
+"Helper for gather().\n\
+\n\
+This overrides cancel() to cancel all the children and act more\n\
+like Task.cancel(), which doesn't immediately mark itself as\n\
+cancelled.");
+
+static PyType_Slot GatheringFuture_slots[] = {
+    {Py_tp_dealloc, GatheringFutureObj_dealloc},
+    {Py_tp_doc, (void *)GatheringFuture_doc},
+    {Py_tp_traverse, (traverseproc)GatheringFutureObj_traverse},
+    {Py_tp_clear, (inquiry)GatheringFutureObj_clear},
+    {Py_tp_methods, GatheringFutureType_methods},
+    {Py_tp_members, GatheringFutureType_members},
+    {Py_tp_getset, GatheringFutureType_getsetlist},
+    {0, NULL},
+};
+
+static PyType_Spec GatheringFuture_spec = {
+    .name = "_asyncio._GatheringFuture",
+    .basicsize = sizeof(GatheringFutureObj),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
+              Py_TPFLAGS_IMMUTABLETYPE | Py_TPFLAGS_DISALLOW_INSTANTIATION |
+              Py_TPFLAGS_MANAGED_DICT | Py_TPFLAGS_MANAGED_WEAKREF),
+    .slots = GatheringFuture_slots,
+};
+
+
+/*[clinic input]
+_asyncio.gather
+
+    *coros_or_futures: object
+    return_exceptions: bool = False
+
+Return a future aggregating results from the given coroutines/futures.
+
+Coroutines will be wrapped in a future and scheduled in the event
+loop. They will not necessarily be scheduled in the same order as
+passed in.
+
+All futures must share the same event loop.  If all the tasks are
+done successfully, the returned future's result is the list of
+results (in the order of the original sequence, not necessarily
+the order of results arrival).  If *return_exceptions* is True,
+exceptions in the tasks are treated the same as successful
+results, and gathered in the result list; otherwise, the first
+raised exception will be immediately propagated to the returned
+future.
+
+Cancellation: if the outer Future is cancelled, all children (that
+have not completed yet) are also cancelled.  If any child is
+cancelled, this is treated as if it raised CancelledError --
+the outer Future is *not* cancelled in this case.  (This is to
+prevent the cancellation of one child to cause other children to
+be cancelled.)
+
+If *return_exceptions* is False, cancelling gather() after it
+has been marked done won't cancel any submitted awaitables.
+For instance, gather can be marked done after propagating an
+exception to the caller, therefore, calling ``gather.cancel()``
+after catching an exception (raised by one of the awaitables) from
+gather won't cancel any other awaitables.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_gather_impl(PyObject *module, PyObject *coros_or_futures,
+                     int return_exceptions)
+/*[clinic end generated code: output=972e28409f641185 input=a022bbb5bdb714b4]*/
+{
+    asyncio_state *state = get_asyncio_state(module);
+    Py_ssize_t nargs = PyTuple_GET_SIZE(coros_or_futures);
+
+    if (nargs == 0) {
+        PyObject *loop = get_event_loop(state);
+        if (loop == NULL) {
+            return NULL;
+        }
+        PyObject *outer = PyObject_CallMethodNoArgs(loop,
+                                                    &_Py_ID(create_future));
+        Py_DECREF(loop);
+        if (outer == NULL) {
+            return NULL;
+        }
+        PyObject *results = PyList_New(0);
+        if (results == NULL || future_set_result_any(state, outer, results) < 0) {
+            Py_XDECREF(results);
+            Py_DECREF(outer);
+            return NULL;
+        }
+        Py_DECREF(results);
+        return outer;
+    }
+
+    /* The outer future is created first so that the done callback can
+       reference it, but it is initialized once the loop is known: the
+       callback ignores it until then. */
+    PyTypeObject *tp = state->GatheringFutureType;
+    GatheringFutureObj *outer = (GatheringFutureObj *)tp->tp_alloc(tp, 0);
+    if (outer == NULL) {
+        return NULL;
+    }
+    outer->gf_return_exceptions = return_exceptions;
+
+    PyObject *loop = NULL;
+    PyObject *ctx = NULL;
+    PyObject *arg_to_fut = NULL;
+    PyObject *done_futs = NULL;
+    PyObject *done_callback = NULL;
+    PyObject *children = PyList_New(nargs);
+    if (children == NULL) {
+        goto error;
+    }
+    done_callback = PyCFunction_New(&gathering_future_child_done_def,
+                                    (PyObject *)outer);
+    if (done_callback == NULL) {
+        goto error;
+    }
+    /* The callback does not use context variables: all the children can
+       share the same copy of the context. */
+    ctx = PyContext_CopyCurrent();
+    if (ctx == NULL) {
+        goto error;
+    }
+    arg_to_fut = PyDict_New();
+    if (arg_to_fut == NULL) {
+        goto error;
+    }
+    done_futs = PyList_New(0);
+    if (done_futs == NULL) {
+        goto error;
+    }
+
+    for (Py_ssize_t i = 0; i < nargs; i++) {
+        PyObject *arg = PyTuple_GET_ITEM(coros_or_futures, i);
+        PyObject *fut;
+        int found = PyDict_GetItemRef(arg_to_fut, arg, &fut);
+        if (found < 0) {
+            goto error;
+        }
+        if (!found) {
+            fut = gather_ensure_future(state, arg, loop);
+            if (fut == NULL) {
+                goto error;
+            }
+            PyList_SET_ITEM(children, i, fut);
+            if (loop == NULL) {
+                loop = get_future_loop(state, fut);
+                if (loop == NULL) {
+                    goto error;
+                }
+            }
+            if (fut != arg) {
+                /* 'arg' was not a Future, therefore, 'fut' is a new Future
+                   created specifically for 'arg'.  Since the caller can't
+                   control it, disable the "destroy pending task" warning. */
+                if (Task_Check(state, fut)) {
+                    ((TaskObj *)fut)->task_log_destroy_pending = 0;
+                }
+                else if (PyObject_SetAttr(fut, &_Py_ID(_log_destroy_pending),
+                                          Py_False) < 0)
+                {
+                    goto error;
+                }
+            }
+
+            outer->gf_nfuts++;
+            if (PyDict_SetItem(arg_to_fut, arg, fut) < 0) {
+                goto error;
+            }
+            int done = future_done_any(state, fut);
+            if (done < 0) {
+                goto error;
+            }
+            if (done) {
+                if (PyList_Append(done_futs, fut) < 0) {
+                    goto error;
+                }
+            }
+            else if (future_add_done_callback_any(state, fut, done_callback,
+                                                  ctx) < 0)
+            {
+                goto error;
+            }
+        }
+        else {
+            /* There's a duplicate Future object in coros_or_futures. */
+            PyList_SET_ITEM(children, i, fut);
+        }
+    }
+
+    if (future_init((FutureObj *)outer, loop) < 0) {
+        goto error;
+    }
+    outer->gf_children = children;
+    children = NULL;
+
+    /* Run the done callbacks of the children which are already done, for
+       example tasks which completed eagerly, without going through the
+       event loop.  If all the children are done, this completes the
+       outer future before returning it. */
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(done_futs); i++) {
+        PyObject *res = gathering_future_child_done(
+            (PyObject *)outer, PyList_GET_ITEM(done_futs, i));
+        if (res == NULL) {
+            goto error;
+        }
+        Py_DECREF(res);
+    }
+
+    Py_DECREF(loop);
+    Py_DECREF(ctx);
+    Py_DECREF(arg_to_fut);
+    Py_DECREF(done_futs);
+    Py_DECREF(done_callback);
+    return (PyObject *)outer;
+
+error:
+    Py_XDECREF(loop);
+    Py_XDECREF(ctx);
+    Py_XDECREF(arg_to_fut);
+    Py_XDECREF(done_futs);
+    Py_XDECREF(done_callback);
+    Py_XDECREF(children);
+    Py_DECREF(outer);
+    return NULL;
+}
+
+
+/*********************** TaskGroup **************************/
+
+
+/*[clinic input]
+class _asyncio._TaskGroupBase "TaskGroupObj *" "&TaskGroupBase_Type"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=ef6aae9c88b99d66]*/
+
+
+static int
+taskgroup_ensure_initialized(TaskGroupObj *self)
+{
+    if (self->tg_loop == NULL || self->tg_parent_task == NULL
+        || self->tg_tasks == NULL || self->tg_errors == NULL
+        || self->tg_base_error == NULL || self->tg_on_completed_fut == NULL)
+    {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "TaskGroup object is not initialized.");
+        return -1;
+    }
+    if (!PyAnySet_Check(self->tg_tasks)) {
+        PyErr_Format(PyExc_TypeError, "TaskGroup._tasks must be a set, not %T",
+                     self->tg_tasks);
+        return -1;
+    }
+    return 0;
+}
+
+/* Close the coroutine which will not be run and raise RuntimeError. */
+static PyObject *
+taskgroup_reject_coro(TaskGroupObj *self, PyObject *coro, const char *format)
+{
+    PyObject *res = PyObject_CallMethodNoArgs(coro, &_Py_ID(close));
+    if (res == NULL) {
+        return NULL;
+    }
+    Py_DECREF(res);
+    PyErr_Format(PyExc_RuntimeError, format, (PyObject *)self);
+    return NULL;
+}
+
+static PyObject *
+taskgroup_on_task_done(asyncio_state *state, TaskGroupObj *self,
+                       PyObject *task)
+{
+    if (taskgroup_ensure_initialized(self) < 0) {
+        return NULL;
+    }
+    if (PySet_Discard(self->tg_tasks, task) < 0) {
+        return NULL;
+    }
+
+    if (self->tg_on_completed_fut != Py_None
+        && PySet_GET_SIZE(self->tg_tasks) == 0)
+    {
+        PyObject *fut = Py_NewRef(self->tg_on_completed_fut);
+        int done = future_done_any(state, fut);
+        if (done == 0) {
+            done = future_set_result_any(state, fut, Py_True);
+        }
+        Py_DECREF(fut);
+        if (done < 0) {
+            return NULL;
+        }
+    }
+
+    int cancelled = future_cancelled_any(state, task);
+    if (cancelled < 0) {
+        return NULL;
+    }
+    if (cancelled) {
+        Py_RETURN_NONE;
+    }
+
+    PyObject *exc = future_exception_any(state, task);
+    if (exc == NULL) {
+        return NULL;
+    }
+    if (exc == Py_None) {
+        return exc;
+    }
+
+    PyObject *res = NULL;
+    PyObject *parent_task = NULL;
+    int err;
+    if (PyList_CheckExact(self->tg_errors)) {
+        err = PyList_Append(self->tg_errors, exc);
+    }
+    else {
+        PyObject *r = PyObject_CallMethodOneArg(self->tg_errors,
+                                                &_Py_ID(append), exc);
+        err = r == NULL ? -1 : 0;
+        Py_XDECREF(r);
+    }
+    if (err < 0) {
+        goto finally;
+    }
+    if (self->tg_base_error == Py_None
+        && (PyErr_GivenExceptionMatches(exc, PyExc_SystemExit)
+            || PyErr_GivenExceptionMatches(exc, PyExc_KeyboardInterrupt)))
+    {
+        Py_XSETREF(self->tg_base_error, Py_NewRef(exc));
+    }
+
+    parent_task = Py_NewRef(self->tg_parent_task);
+    int parent_done = future_done_any(state, parent_task);
+    if (parent_done < 0) {
+        goto finally;
+    }
+    if (parent_done) {
+        /* Not sure if this case is possible, but we want to handle it
+           anyways. */
+        PyObject *context = Py_BuildValue(
+            "{sNsOsO}",
+            "message", PyUnicode_FromFormat(
+                "Task %R has errored out but its parent task %S is already "
+                "completed", task, parent_task),
+            "exception", exc,
+            "task", task);
+        if (context == NULL) {
+            goto finally;
+        }
+        res = PyObject_CallMethodOneArg(self->tg_loop,
+                                        &_Py_ID(call_exception_handler),
+                                        context);
+        Py_DECREF(context);
+        if (res != NULL) {
+            Py_SETREF(res, Py_NewRef(Py_None));
+        }
+        goto finally;
+    }
+
+    if (!self->tg_aborting && !self->tg_parent_cancel_requested) {
+        /* If the parent task is not being cancelled, cancel it to abort
+           whatever is being run right now in the TaskGroup, and mark it as
+           "not cancelled" later in __aexit__. */
+        PyObject *r = PyObject_CallMethodNoArgs((PyObject *)self,
+                                                &_Py_ID(_abort));
+        if (r == NULL) {
+            goto finally;
+        }
+        Py_DECREF(r);
+        self->tg_parent_cancel_requested = 1;
+        r = PyObject_CallMethodNoArgs(parent_task, &_Py_ID(cancel));
+        if (r == NULL) {
+            goto finally;
+        }
+        Py_DECREF(r);
+    }
+    res = Py_NewRef(Py_None);
+
+finally:
+    Py_XDECREF(parent_task);
+    Py_DECREF(exc);
+    return res;
+}
+
+/*[clinic input]
+_asyncio._TaskGroupBase.create_task
+
+    coro: object
+    *
+    name: object = None
+    context: object = None
+
+Create a new task in this group and return it.
+
+Similar to `asyncio.create_task`.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__TaskGroupBase_create_task_impl(TaskGroupObj *self, PyObject *coro,
+                                         PyObject *name, PyObject *context)
+/*[clinic end generated code: output=c9e7728073249f04 input=356960669233dd05]*/
+{
+    asyncio_state *state = get_asyncio_state_by_def((PyObject *)self);
+
+    if (taskgroup_ensure_initialized(self) < 0) {
+        return NULL;
+    }
+    if (!self->tg_entered) {
+        return taskgroup_reject_coro(self, coro,
+                                     "TaskGroup %R has not been entered");
+    }
+    if (self->tg_exiting && PySet_GET_SIZE(self->tg_tasks) == 0) {
+        return taskgroup_reject_coro(self, coro, "TaskGroup %R is finished");
+    }
+    if (self->tg_aborting) {
+        return taskgroup_reject_coro(self, coro,
+                                     "TaskGroup %R is shutting down");
+    }
+
+    PyObject *task;
+    PyObject *stack[] = {self->tg_loop, coro, name, context};
+    size_t nargsf = 2 | PY_VECTORCALL_ARGUMENTS_OFFSET;
+    if (context == Py_None) {
+        task = PyObject_VectorcallMethod(&_Py_ID(create_task), stack, nargsf,
+                                         state->name_kwname);
+    }
+    else {
+        task = PyObject_VectorcallMethod(&_Py_ID(create_task), stack, nargsf,
+                                         state->name_context_kwnames);
+    }
+    if (task == NULL) {
+        return NULL;
+    }
+
+    /* Immediately call the done callback if the task is already done
+       (e.g. if the coro was able to complete eagerly), and skip
+       scheduling a done callback. */
+    int done = future_done_any(state, task);
+    if (done < 0) {
+        goto error;
+    }
+    if (done) {
+        PyObject *res = taskgroup_on_task_done(state, self, task);
+        if (res == NULL) {
+            goto error;
+        }
+        Py_DECREF(res);
+        return task;
+    }
+
+    if (PySet_Add(self->tg_tasks, task) < 0) {
+        goto error;
+    }
+    if (self->tg_on_task_done == NULL) {
+        self->tg_on_task_done = PyObject_GetAttr((PyObject *)self,
+                                                 &_Py_ID(_on_task_done));
+        if (self->tg_on_task_done == NULL) {
+            goto error;
+        }
+    }
+    PyObject *ctx = PyContext_CopyCurrent();
+    if (ctx == NULL) {
+        goto error;
+    }
+    int err = future_add_done_callback_any(state, task, self->tg_on_task_done,
+                                           ctx);
+    Py_DECREF(ctx);
+    if (err < 0) {
+        goto error;
+    }
+    return task;
+
+error:
+    Py_DECREF(task);
+    return NULL;
+}
+
+/*[clinic input]
+_asyncio._TaskGroupBase._on_task_done
+
+    task: object
+    /
+
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__TaskGroupBase__on_task_done(TaskGroupObj *self, PyObject *task)
+/*[clinic end generated code: output=d884de25fcaef1d1 input=85fe648b8f8e35b8]*/
+{
+    asyncio_state *state = get_asyncio_state_by_def((PyObject *)self);
+    return taskgroup_on_task_done(state, self, task);
+}
+
+static int
+TaskGroupObj_clear(TaskGroupObj *self)
+{
+    Py_CLEAR(self->tg_loop);
+    Py_CLEAR(self->tg_parent_task);
+    Py_CLEAR(self->tg_tasks);
+    Py_CLEAR(self->tg_errors);
+    Py_CLEAR(self->tg_base_error);
+    Py_CLEAR(self->tg_on_completed_fut);
+    Py_CLEAR(self->tg_on_task_done);
+    return 0;
+}
+
+static int
+TaskGroupObj_traverse(TaskGroupObj *self, visitproc visit, void *arg)
+{
+    Py_VISIT(Py_TYPE(self));
+    Py_VISIT(self->tg_loop);
+    Py_VISIT(self->tg_parent_task);
+    Py_VISIT(self->tg_tasks);
+    Py_VISIT(self->tg_errors);
+    Py_VISIT(self->tg_base_error);
+    Py_VISIT(self->tg_on_completed_fut);
+    Py_VISIT(self->tg_on_task_done);
+    return 0;
+}
+
+static void
+TaskGroupObj_dealloc(PyObject *self)
+{
+    PyTypeObject *tp = Py_TYPE(self);
+    PyObject_GC_UnTrack(self);
+    (void)TaskGroupObj_clear((TaskGroupObj *)self);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+static PyMethodDef TaskGroupBaseType_methods[] = {
+    _ASYNCIO__TASKGROUPBASE_CREATE_TASK_METHODDEF
+    _ASYNCIO__TASKGROUPBASE__ON_TASK_DONE_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+#define TASKGROUP_MEMBER(name, type, field) \
+    {name, type, offsetof(TaskGroupObj, field), 0, NULL}
+
+static PyMemberDef TaskGroupBaseType_members[] = {
+    TASKGROUP_MEMBER("_loop", Py_T_OBJECT_EX, tg_loop),
+    TASKGROUP_MEMBER("_parent_task", Py_T_OBJECT_EX, tg_parent_task),
+    TASKGROUP_MEMBER("_tasks", Py_T_OBJECT_EX, tg_tasks),
+    TASKGROUP_MEMBER("_errors", Py_T_OBJECT_EX, tg_errors),
+    TASKGROUP_MEMBER("_base_error", Py_T_OBJECT_EX, tg_base_error),
+    TASKGROUP_MEMBER("_on_completed_fut", Py_T_OBJECT_EX, tg_on_completed_fut),
+    TASKGROUP_MEMBER("_entered", Py_T_BOOL, tg_entered),
+    TASKGROUP_MEMBER("_exiting", Py_T_BOOL, tg_exiting),
+    TASKGROUP_MEMBER("_aborting", Py_T_BOOL, tg_aborting),
+    TASKGROUP_MEMBER("_parent_cancel_requested", Py_T_BOOL,
+                     tg_parent_cancel_requested),
+    {NULL},
+};
+
+#undef TASKGROUP_MEMBER
+
+PyDoc_STRVAR(TaskGroupBase_doc,
+"Base class of asyncio.TaskGroup implementing the bookkeeping of\n\
+the tasks of the group.");
+
+static PyType_Slot TaskGroupBase_slots[] = {
+    {Py_tp_dealloc, TaskGroupObj_dealloc},
+    {Py_tp_doc, (void *)TaskGroupBase_doc},
+    {Py_tp_traverse, (traverseproc)TaskGroupObj_traverse},
+    {Py_tp_clear, (inquiry)TaskGroupObj_clear},
+    {Py_tp_methods, TaskGroupBaseType_methods},
+    {Py_tp_members, TaskGroupBaseType_members},
+    {Py_tp_new, PyType_GenericNew},
+    {0, NULL},
+};
+
+static PyType_Spec TaskGroupBase_spec = {
+    .name = "_asyncio._TaskGroupBase",
+    .basicsize = sizeof(TaskGroupObj),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_BASETYPE |
+              Py_TPFLAGS_IMMUTABLETYPE),
+    .slots = TaskGroupBase_slots,
+};
+
+
+/*********************** Handle **************************/
+
+
+/*[clinic input]
+class _asyncio.Handle "HandleObj *" "&Handle_Type"
+class _asyncio.TimerHandle "TimerHandleObj *" "&TimerHandle_Type"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=2f75c1edc95be7b0]*/
+
+
+static int
+loop_get_debug(PyObject *loop)
+{
+    PyObject *res = PyObject_CallMethodNoArgs(loop, &_Py_ID(get_debug));
+    if (res == NULL) {
+        return -1;
+    }
+    int is_true = PyObject_IsTrue(res);
+    Py_DECREF(res);
+    return is_true;
+}
+
+/* Return a new reference to a handle attribute, or to None if it was
+   deleted. */
+static inline PyObject *
+handle_get_attr(PyObject *attr)
+{
+    return Py_NewRef(attr != NULL ? attr : Py_None);
+}
+
+static int
+handle_init(asyncio_state *state, HandleObj *self, PyObject *callback,
+            PyObject *args, PyObject *loop, PyObject *context)
+{
+    if (context == Py_None) {
+        context = PyContext_CopyCurrent();
+        if (context == NULL) {
+            return -1;
+        }
+    }
+    else {
+        Py_INCREF(context);
+    }
+    Py_XSETREF(self->h_context, context);
+    Py_XSETREF(self->h_loop, Py_NewRef(loop));
+    Py_XSETREF(self->h_callback, Py_NewRef(callback));
+    Py_XSETREF(self->h_args, Py_NewRef(args));
+    Py_XSETREF(self->h_repr, Py_NewRef(Py_None));
+    self->h_cancelled = 0;
+
+    int debug = loop_get_debug(loop);
+    if (debug < 0) {
+        return -1;
+    }
+    PyObject *source_tb;
+    if (debug) {
+        /* extract_stack() starts from the frame of our caller, which is
+           the frame Handle.__init__() would use with sys._getframe(1). */
+        source_tb = PyObject_CallNoArgs(state->asyncio_extract_stack_func);
+        if (source_tb == NULL) {
+            return -1;
+        }
+    }
+    else {
+        source_tb = Py_NewRef(Py_None);
+    }
+    Py_XSETREF(self->h_source_tb, source_tb);
+    return 0;
+}
+
+static int
+handle_call_exception_handler(asyncio_state *state, HandleObj *self)
+{
+    /* Implementation of the "except BaseException" clause of
+       Handle._run(): pass the exception to the loop exception handler. */
+    PyObject *exc = PyErr_GetRaisedException();
+    PyObject *callback, *args, *loop, *source_tb;
+    PyObject *cb = NULL, *message = NULL, *context = NULL, *res = NULL;
+    int ret = -1;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    callback = handle_get_attr(self->h_callback);
+    args = handle_get_attr(self->h_args);
+    loop = handle_get_attr(self->h_loop);
+    source_tb = handle_get_attr(self->h_source_tb);
+    Py_END_CRITICAL_SECTION();
+
+    int debug = loop_get_debug(loop);
+    if (debug < 0) {
+        goto finally;
+    }
+    PyObject *stack[3] = {callback, args, debug ? Py_True : Py_False};
+    cb = PyObject_Vectorcall(state->asyncio_format_callback_source_func,
+                             stack, 2, state->debug_kwname);
+    if (cb == NULL) {
+        goto finally;
+    }
+    message = PyUnicode_FromFormat("Exception in callback %S", cb);
+    if (message == NULL) {
+        goto finally;
+    }
+    context = PyDict_New();
+    if (context == NULL) {
+        goto finally;
+    }
+    if (PyDict_SetItem(context, &_Py_ID(message), message) < 0 ||
+        PyDict_SetItem(context, &_Py_ID(exception), exc) < 0 ||
+        PyDict_SetItem(context, &_Py_ID(handle), (PyObject *)self) < 0) {
+        goto finally;
+    }
+    int has_tb = PyObject_IsTrue(source_tb);
+    if (has_tb < 0) {
+        goto finally;
+    }
+    if (has_tb &&
+        PyDict_SetItem(context, &_Py_ID(source_traceback), source_tb) < 0) {
+        goto finally;
+    }
+    res = PyObject_CallMethodOneArg(loop, &_Py_ID(call_exception_handler),
+                                    context);
+    if (res == NULL) {
+        goto finally;
+    }
+    ret = 0;
+
+finally:
+    Py_DECREF(exc);
+    Py_DECREF(callback);
+    Py_DECREF(args);
+    Py_DECREF(loop);
+    Py_DECREF(source_tb);
+    Py_XDECREF(cb);
+    Py_XDECREF(message);
+    Py_XDECREF(context);
+    Py_XDECREF(res);
+    return ret;
+}
+
+static int
+handle_run(asyncio_state *state, HandleObj *self)
+{
+    /* Implementation of Handle._run(): call the callback in the handle
+       context.  Exceptions other than SystemExit and KeyboardInterrupt
+       are passed to the loop exception handler. */
+    PyObject *callback, *args, *context, *res = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    callback = handle_get_attr(self->h_callback);
+    args = handle_get_attr(self->h_args);
+    context = handle_get_attr(self->h_context);
+    Py_END_CRITICAL_SECTION();
+
+    if (!PyContext_CheckExact(context)) {
+        PyErr_Format(PyExc_TypeError,
+                     "handle context must be a Context, not %T", context);
+    }
+    else if (PyContext_Enter(context) == 0) {
+        if (PyTuple_CheckExact(args)) {
+            res = PyObject_Call(callback, args, NULL);
+        }
+        else {
+            PyObject *tuple = PySequence_Tuple(args);
+            if (tuple != NULL) {
+                res = PyObject_Call(callback, tuple, NULL);
+                Py_DECREF(tuple);
+            }
+        }
+        if (PyContext_Exit(context) < 0) {
+            Py_CLEAR(res);
+        }
+    }
+    Py_DECREF(callback);
+    Py_DECREF(args);
+    Py_DECREF(context);
+
+    if (res != NULL) {
+        Py_DECREF(res);
+        return 0;
+    }
+    if (PyErr_ExceptionMatches(PyExc_SystemExit) ||
+        PyErr_ExceptionMatches(PyExc_KeyboardInterrupt)) {
+        return -1;
+    }
+    return handle_call_exception_handler(state, self);
+}
+
+static int
+handle_cancel(HandleObj *self)
+{
+    if (self->h_cancelled) {
+        return 0;
+    }
+    self->h_cancelled = 1;
+    int debug = loop_get_debug(self->h_loop != NULL ? self->h_loop : Py_None);
+    if (debug < 0) {
+        return -1;
+    }
+    if (debug) {
+        /* Keep a representation in debug mode to keep callback and
+           parameters.  For example, to log the warning
+           "Executing <Handle...> took 2.5 second" */
+        PyObject *repr = PyObject_Repr((PyObject *)self);
+        if (repr == NULL) {
+            return -1;
+        }
+        Py_XSETREF(self->h_repr, repr);
+    }
+    Py_XSETREF(self->h_callback, Py_NewRef(Py_None));
+    Py_XSETREF(self->h_args, Py_NewRef(Py_None));
+    return 0;
+}
+
+/*[clinic input]
+_asyncio.Handle.__init__
+
+    callback: object
+    args: object
+    loop: object
+    context: object = None
+
+Object returned by callback registration methods.
+[clinic start generated code]*/
+
+static int
+_asyncio_Handle___init___impl(HandleObj *self, PyObject *callback,
+                              PyObject *args, PyObject *loop,
+                              PyObject *context)
+/*[clinic end generated code: output=40a28e55725495e2 input=c0d847a7bc9e878f]*/
+{
+    asyncio_state *state = get_asyncio_state_by_def((PyObject *)self);
+    return handle_init(state, self, callback, args, loop, context);
+}
+
+/*[clinic input]
+@critical_section
+_asyncio.Handle._repr_info
+
+Return the list of strings shown by repr().
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle__repr_info_impl(HandleObj *self)
+/*[clinic end generated code: output=7838b12075048d03 input=e21bdd3a2475f25c]*/
+{
+    asyncio_state *state = get_asyncio_state_by_def((PyObject *)self);
+    PyObject *info = PyList_New(0);
+    if (info == NULL) {
+        return NULL;
+    }
+    PyObject *item = PyType_GetName(Py_TYPE(self));
+    if (item == NULL || _PyList_AppendTakeRef((PyListObject *)info, item) < 0) {
+        goto error;
+    }
+    if (self->h_cancelled) {
+        item = PyUnicode_FromString("cancelled");
+        if (item == NULL ||
+            _PyList_AppendTakeRef((PyListObject *)info, item) < 0) {
+            goto error;
+        }
+    }
+    if (self->h_callback != NULL && self->h_callback != Py_None) {
+        int debug = loop_get_debug(
+            self->h_loop != NULL ? self->h_loop : Py_None);
+        if (debug < 0) {
+            goto error;
+        }
+        PyObject *args = handle_get_attr(self->h_args);
+        PyObject *stack[3] = {self->h_callback, args,
+                              debug ? Py_True : Py_False};
+        item = PyObject_Vectorcall(state->asyncio_format_callback_source_func,
+                                   stack, 2, state->debug_kwname);
+        Py_DECREF(args);
+        if (item == NULL ||
+            _PyList_AppendTakeRef((PyListObject *)info, item) < 0) {
+            goto error;
+        }
+    }
+    if (self->h_source_tb != NULL) {
+        int has_tb = PyObject_IsTrue(self->h_source_tb);
+        if (has_tb < 0) {
+            goto error;
+        }
+        if (has_tb) {
+            PyObject *frame = PySequence_GetItem(self->h_source_tb, -1);
+            if (frame == NULL) {
+                goto error;
+            }
+            PyObject *filename = PySequence_GetItem(frame, 0);
+            PyObject *lineno = NULL;
+            if (filename != NULL) {
+                lineno = PySequence_GetItem(frame, 1);
+            }
+            Py_DECREF(frame);
+            item = NULL;
+            if (lineno != NULL) {
+                item = PyUnicode_FromFormat("created at %S:%S",
+                                            filename, lineno);
+            }
+            Py_XDECREF(filename);
+            Py_XDECREF(lineno);
+            if (item == NULL ||
+                _PyList_AppendTakeRef((PyListObject *)info, item) < 0) {
+                goto error;
+            }
+        }
+    }
+    return info;
+
+error:
+    Py_DECREF(info);
+    return NULL;
+}
+
+/*[clinic input]
+_asyncio.Handle.get_context
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle_get_context_impl(HandleObj *self)
+/*[clinic end generated code: output=533e37d94822a513 input=4f74b0143c38809e]*/
+{
+    return handle_get_attr(self->h_context);
+}
+
+/*[clinic input]
+@critical_section
+_asyncio.Handle.cancel
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle_cancel_impl(HandleObj *self)
+/*[clinic end generated code: output=ddb39234782aab82 input=76c7e99122ab9cbb]*/
+{
+    if (handle_cancel(self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio.Handle.cancelled
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle_cancelled_impl(HandleObj *self)
+/*[clinic end generated code: output=0f4ad57f569e9f24 input=14a55098bea1b40a]*/
+{
+    return PyBool_FromLong(self->h_cancelled);
+}
+
+/*[clinic input]
+_asyncio.Handle._run
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle__run_impl(HandleObj *self)
+/*[clinic end generated code: output=1b186b710881500a input=94fc71ae0ddc7106]*/
+{
+    asyncio_state *state = get_asyncio_state_by_def((PyObject *)self);
+    if (handle_run(state, self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+HandleObj_repr(HandleObj *self)
+{
+    PyObject *repr = NULL;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    if (self->h_repr != NULL && self->h_repr != Py_None) {
+        repr = Py_NewRef(self->h_repr);
+    }
+    Py_END_CRITICAL_SECTION();
+    if (repr != NULL) {
+        return repr;
+    }
+
+    PyObject *info = PyObject_CallMethodNoArgs((PyObject *)self,
+                                               &_Py_ID(_repr_info));
+    if (info == NULL) {
+        return NULL;
+    }
+    PyObject *joined = PyUnicode_Join(_Py_LATIN1_CHR(' '), info);
+    Py_DECREF(info);
+    if (joined == NULL) {
+        return NULL;
+    }
+    repr = PyUnicode_FromFormat("<%U>", joined);
+    Py_DECREF(joined);
+    return repr;
+}
+
+static int
+HandleObj_traverse(HandleObj *self, visitproc visit, void *arg)
+{
+    Py_VISIT(Py_TYPE(self));
+    Py_VISIT(self->h_callback);
+    Py_VISIT(self->h_args);
+    Py_VISIT(self->h_loop);
+    Py_VISIT(self->h_context);
+    Py_VISIT(self->h_source_tb);
+    Py_VISIT(self->h_repr);
+    return 0;
+}
+
+static int
+HandleObj_clear(HandleObj *self)
+{
+    Py_CLEAR(self->h_callback);
+    Py_CLEAR(self->h_args);
+    Py_CLEAR(self->h_loop);
+    Py_CLEAR(self->h_context);
+    Py_CLEAR(self->h_source_tb);
+    Py_CLEAR(self->h_repr);
+    return 0;
+}
+
+static void
+HandleObj_dealloc(PyObject *self)
+{
+    PyTypeObject *tp = Py_TYPE(self);
+    PyObject_GC_UnTrack(self);
+    PyObject_ClearWeakRefs(self);
+    (void)tp->tp_clear(self);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+#define HANDLE_COMMON_MEMBERS                                               \
+    {"_callback", Py_T_OBJECT_EX, offsetof(HandleObj, h_callback), 0},      \
+    {"_args", Py_T_OBJECT_EX, offsetof(HandleObj, h_args), 0},              \
+    {"_loop", Py_T_OBJECT_EX, offsetof(HandleObj, h_loop), 0},              \
+    {"_context", Py_T_OBJECT_EX, offsetof(HandleObj, h_context), 0},        \
+    {"_source_traceback", Py_T_OBJECT_EX,                                   \
+                          offsetof(HandleObj, h_source_tb), 0},             \
+    {"_repr", Py_T_OBJECT_EX, offsetof(HandleObj, h_repr), 0},              \
+    {"_cancelled", Py_T_BOOL, offsetof(HandleObj, h_cancelled), 0},
+
+static PyMemberDef HandleType_members[] = {
+    HANDLE_COMMON_MEMBERS
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef HandleType_methods[] = {
+    _ASYNCIO_HANDLE__REPR_INFO_METHODDEF
+    _ASYNCIO_HANDLE_GET_CONTEXT_METHODDEF
+    _ASYNCIO_HANDLE_CANCEL_METHODDEF
+    _ASYNCIO_HANDLE_CANCELLED_METHODDEF
+    _ASYNCIO_HANDLE__RUN_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyType_Slot Handle_slots[] = {
+    {Py_tp_dealloc, HandleObj_dealloc},
+    {Py_tp_repr, (reprfunc)HandleObj_repr},
+    {Py_tp_doc, (void *)_asyncio_Handle___init____doc__},
+    {Py_tp_traverse, (traverseproc)HandleObj_traverse},
+    {Py_tp_clear, (inquiry)HandleObj_clear},
+    {Py_tp_methods, HandleType_methods},
+    {Py_tp_members, HandleType_members},
+    {Py_tp_init, (initproc)_asyncio_Handle___init__},
+    {Py_tp_new, PyType_GenericNew},
+    {0, NULL},
+};
+
+static PyType_Spec Handle_spec = {
+    .name = "_asyncio.Handle",
+    .basicsize = sizeof(HandleObj),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_BASETYPE |
+              Py_TPFLAGS_IMMUTABLETYPE | Py_TPFLAGS_MANAGED_WEAKREF),
+    .slots = Handle_slots,
+};
+
+
+/*[clinic input]
+_asyncio.TimerHandle.__init__
+
+    when: object
+    callback: object
+    args: object
+    loop: object
+    context: object = None
+
+Object returned by timed callback registration methods.
+[clinic start generated code]*/
+
+static int
+_asyncio_TimerHandle___init___impl(TimerHandleObj *self, PyObject *when,
+                                   PyObject *callback, PyObject *args,
+                                   PyObject *loop, PyObject *context)
+/*[clinic end generated code: output=0d98475472bfab93 input=ec6d223ba9888cec]*/
+{
+    asyncio_state *state = get_asyncio_state_by_def((PyObject *)self);
+    if (handle_init(state, (HandleObj *)self, callback, args, loop,
+                    context) < 0) {
+        return -1;
+    }
+    Py_XSETREF(self->th_when, Py_NewRef(when));
+    self->th_scheduled = 0;
+    return 0;
+}
+
+/*[clinic input]
+@critical_section
+_asyncio.TimerHandle._repr_info
+
+Return the list of strings shown by repr().
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_TimerHandle__repr_info_impl(TimerHandleObj *self)
+/*[clinic end generated code: output=40e332eea82788b7 input=3df31ed74f2dc278]*/
+{
+    PyObject *info = _asyncio_Handle__repr_info_impl((HandleObj *)self);
+    if (info == NULL) {
+        return NULL;
+    }
+    PyObject *when = handle_get_attr(self->th_when);
+    PyObject *item = PyUnicode_FromFormat("when=%S", when);
+    Py_DECREF(when);
+    if (item == NULL) {
+        Py_DECREF(info);
+        return NULL;
+    }
+    Py_ssize_t pos = self->th_base.h_cancelled ? 2 : 1;
+    int rc = PyList_Insert(info, pos, item);
+    Py_DECREF(item);
+    if (rc < 0) {
+        Py_DECREF(info);
+        return NULL;
+    }
+    return info;
+}
+
+/*[clinic input]
+@critical_section
+_asyncio.TimerHandle.cancel
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_TimerHandle_cancel_impl(TimerHandleObj *self)
+/*[clinic end generated code: output=315df6426e6662ff input=64794589a90b4d63]*/
+{
+    if (!self->th_base.h_cancelled) {
+        PyObject *loop = handle_get_attr(self->th_base.h_loop);
+        PyObject *res = PyObject_CallMethodOneArg(
+            loop, &_Py_ID(_timer_handle_cancelled), (PyObject *)self);
+        Py_DECREF(loop);
+        if (res == NULL) {
+            return NULL;
+        }
+        Py_DECREF(res);
+    }
+    if (handle_cancel((HandleObj *)self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio.TimerHandle.when
+
+Return a scheduled callback time.
+
+The time is an absolute timestamp, using the same time
+reference as loop.time().
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_TimerHandle_when_impl(TimerHandleObj *self)
+/*[clinic end generated code: output=cab0e5577e51b3af input=de801fd191075931]*/
+{
+    return handle_get_attr(self->th_when);
+}
+
+static Py_hash_t
+TimerHandleObj_hash(TimerHandleObj *self)
+{
+    PyObject *when = handle_get_attr(self->th_when);
+    Py_hash_t hash = PyObject_Hash(when);
+    Py_DECREF(when);
+    return hash;
+}
+
+static PyObject *
+timer_handle_eq(TimerHandleObj *self, TimerHandleObj *other)
+{
+    /* self._when == other._when and self._callback == other._callback and
+       self._args == other._args and self._cancelled == other._cancelled */
+    PyObject *pairs[3][2] = {
+        {self->th_when, other->th_when},
+        {self->th_base.h_callback, other->th_base.h_callback},
+        {self->th_base.h_args, other->th_base.h_args},
+    };
+    for (int i = 0; i < 3; i++) {
+        PyObject *a = handle_get_attr(pairs[i][0]);
+        PyObject *b = handle_get_attr(pairs[i][1]);
+        PyObject *res = PyObject_RichCompare(a, b, Py_EQ);
+        Py_DECREF(a);
+        Py_DECREF(b);
+        if (res == NULL) {
+            return NULL;
+        }
+        int is_true = PyObject_IsTrue(res);
+        if (is_true <= 0) {
+            if (is_true < 0) {
+                Py_CLEAR(res);
+            }
+            return res;
+        }
+        Py_DECREF(res);
+    }
+    return PyBool_FromLong(
+        self->th_base.h_cancelled == other->th_base.h_cancelled);
+}
+
+static PyObject *
+TimerHandleObj_richcompare(TimerHandleObj *self, PyObject *other, int op)
+{
+    if (!Py_IS_TYPE(other, Py_TYPE(self))) {
+        asyncio_state *state = get_asyncio_state_by_def((PyObject *)self);
+        if (!TimerHandle_Check(state, other)) {
+            Py_RETURN_NOTIMPLEMENTED;
+        }
+    }
+    TimerHandleObj *o = (TimerHandleObj *)other;
+    PyObject *res;
+    int is_true;
+
+    switch (op) {
+    case Py_LT:
+    case Py_GT:
+        if (self->th_when != NULL && o->th_when != NULL &&
+            PyFloat_CheckExact(self->th_when) &&
+            PyFloat_CheckExact(o->th_when)) {
+            /* Fast path for the heap of scheduled timers. */
+            double a = PyFloat_AS_DOUBLE(self->th_when);
+            double b = PyFloat_AS_DOUBLE(o->th_when);
+            return PyBool_FromLong(op == Py_LT ? a < b : a > b);
+        }
+        /* fall through */
+    case Py_LE:
+    case Py_GE: {
+        /* self._when < other._when or self.__eq__(other) */
+        PyObject *a = handle_get_attr(self->th_when);
+        PyObject *b = handle_get_attr(o->th_when);
+        res = PyObject_RichCompare(a, b, (op == Py_LT || op == Py_LE)
+                                         ? Py_LT : Py_GT);
+        Py_DECREF(a);
+        Py_DECREF(b);
+        if (res == NULL || op == Py_LT || op == Py_GT) {
+            return res;
+        }
+        is_true = PyObject_IsTrue(res);
+        if (is_true != 0) {
+            if (is_true < 0) {
+                Py_CLEAR(res);
+            }
+            return res;
+        }
+        Py_DECREF(res);
+        return timer_handle_eq(self, o);
+    }
+    case Py_EQ:
+        return timer_handle_eq(self, o);
+    case Py_NE:
+        res = timer_handle_eq(self, o);
+        if (res == NULL) {
+            return NULL;
+        }
+        is_true = PyObject_IsTrue(res);
+        Py_DECREF(res);
+        if (is_true < 0) {
+            return NULL;
+        }
+        return PyBool_FromLong(!is_true);
+    default:
+        Py_UNREACHABLE();
+    }
+}
+
+static int
+TimerHandleObj_traverse(TimerHandleObj *self, visitproc visit, void *arg)
+{
+    Py_VISIT(self->th_when);
+    return HandleObj_traverse((HandleObj *)self, visit, arg);
+}
+
+static int
+TimerHandleObj_clear(TimerHandleObj *self)
+{
+    Py_CLEAR(self->th_when);
+    return HandleObj_clear((HandleObj *)self);
+}
+
+static PyMemberDef TimerHandleType_members[] = {
+    HANDLE_COMMON_MEMBERS
+    {"_when", Py_T_OBJECT_EX, offsetof(TimerHandleObj, th_when), 0},
+    {"_scheduled", Py_T_BOOL, offsetof(TimerHandleObj, th_scheduled), 0},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef TimerHandleType_methods[] = {
+    _ASYNCIO_TIMERHANDLE__REPR_INFO_METHODDEF
+    _ASYNCIO_TIMERHANDLE_CANCEL_METHODDEF
+    _ASYNCIO_TIMERHANDLE_WHEN_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyType_Slot TimerHandle_slots[] = {
+    {Py_tp_dealloc, HandleObj_dealloc},
+    {Py_tp_doc, (void *)_asyncio_TimerHandle___init____doc__},
+    {Py_tp_hash, (hashfunc)TimerHandleObj_hash},
+    {Py_tp_richcompare, (richcmpfunc)TimerHandleObj_richcompare},
+    {Py_tp_traverse, (traverseproc)TimerHandleObj_traverse},
+    {Py_tp_clear, (inquiry)TimerHandleObj_clear},
+    {Py_tp_methods, TimerHandleType_methods},
+    {Py_tp_members, TimerHandleType_members},
+    {Py_tp_init, (initproc)_asyncio_TimerHandle___init__},
+    {0, NULL},
+};
+
+static PyType_Spec TimerHandle_spec = {
+    .name = "_asyncio.TimerHandle",
+    .basicsize = sizeof(TimerHandleObj),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_BASETYPE |
+              Py_TPFLAGS_IMMUTABLETYPE | Py_TPFLAGS_MANAGED_WEAKREF),
+    .slots = TimerHandle_slots,
+};
+
+
+/*********************** Functions **************************/
+
+
+/*[clinic input]
+_asyncio._get_running_loop
+
+Return the running event loop or None.
+
+This is a low-level function intended to be used by event loops.
+This function is thread-specific.
+
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__get_running_loop_impl(PyObject *module)
+/*[clinic end generated code: output=b4390af721411a0a input=0a21627e25a4bd43]*/
+{
+    _PyThreadStateImpl *ts = (_PyThreadStateImpl *)_PyThreadState_GET();
+    PyObject *loop = Py_XNewRef(ts->asyncio_running_loop);
+    if (loop == NULL) {
+        /* There's no currently running event loop */
+        Py_RETURN_NONE;
+    }
+    return loop;
+}
+
+/*[clinic input]
+_asyncio._set_running_loop
+    loop: 'O'
+    /
+
+Set the running event loop.
+
+This is a low-level function intended to be used by event loops.
+This function is thread-specific.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__set_running_loop(PyObject *module, PyObject *loop)
+/*[clinic end generated code: output=ae56bf7a28ca189a input=4c9720233d606604]*/
+{
+    _PyThreadStateImpl *ts = (_PyThreadStateImpl *)_PyThreadState_GET();
+    if (loop == Py_None) {
+        loop = NULL;
+    }
+    Py_XSETREF(ts->asyncio_running_loop, Py_XNewRef(loop));
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio.get_event_loop
+
+Return an asyncio event loop.
+
+When called from a coroutine or a callback (e.g. scheduled with
+call_soon or similar API), this function will always return the
+running event loop.
+
+If there is no running event loop set, the function will return
+the result of `get_event_loop_policy().get_event_loop()` call.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_get_event_loop_impl(PyObject *module)
+/*[clinic end generated code: output=2a2d8b2f824c648b input=9364bf2916c8655d]*/
+{
+    asyncio_state *state = get_asyncio_state(module);
+    return get_event_loop(state);
+}
+
+/*[clinic input]
+_asyncio.get_running_loop
+
+Return the running event loop.  Raise a RuntimeError if there is none.
+
+This function is thread-specific.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_get_running_loop_impl(PyObject *module)
+/*[clinic end generated code: output=c247b5f9e529530e input=2a3bf02ba39f173d]*/
+{
+    PyObject *loop;
+    _PyThreadStateImpl *ts = (_PyThreadStateImpl *)_PyThreadState_GET();
+    loop = Py_XNewRef(ts->asyncio_running_loop);
+    if (loop == NULL) {
+        /* There's no currently running event loop */
+        PyErr_SetString(
+            PyExc_RuntimeError, "no running event loop");
+        return NULL;
+    }
+    return loop;
+}
+
+/*[clinic input]
+_asyncio._register_task
+
+    task: object
+
+Register a new task in asyncio as executed by loop.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__register_task_impl(PyObject *module, PyObject *task)
+/*[clinic end generated code: output=8672dadd69a7d4e2 input=21075aaea14dfbad]*/
+{
+    asyncio_state *state = get_asyncio_state(module);
+    if (Task_Check(state, task)) {
+        // task is an asyncio.Task instance or subclass, use efficient
+        // linked-list implementation.
+        register_task(state, (TaskObj *)task);
+        Py_RETURN_NONE;
+    }
+    // As task does not inherit from asyncio.Task, fallback to less efficient
+    // weakset implementation.
+    PyObject *res = PyObject_CallMethodOneArg(state->non_asyncio_tasks,
+                                              &_Py_ID(add), task);
+    if (res == NULL) {
+        return NULL;
+    }
+    Py_DECREF(res);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio._register_eager_task
+
+    task: object
+
+Register a new task in asyncio as executed by loop.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__register_eager_task_impl(PyObject *module, PyObject *task)
+/*[clinic end generated code: output=dfe1d45367c73f1a input=237f684683398c51]*/
+{
+    asyncio_state *state = get_asyncio_state(module);
+    if (register_eager_task(state, task) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._unregister_task
+
+    task: object
+
+Unregister a task.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__unregister_task_impl(PyObject *module, PyObject *task)
+/*[clinic end generated code: output=6e5585706d568a46 input=28fb98c3975f7bdc]*/
+{
+    asyncio_state *state = get_asyncio_state(module);
+    if (Task_Check(state, task)) {
+        unregister_task(state, (TaskObj *)task);
+        Py_RETURN_NONE;
+    }
+    PyObject *res = PyObject_CallMethodOneArg(state->non_asyncio_tasks,
+                                              &_Py_ID(discard), task);
+    if (res == NULL) {
+        return NULL;
+    }
+    Py_DECREF(res);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio._unregister_eager_task
+
+    task: object
+
+Unregister a task.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__unregister_eager_task_impl(PyObject *module, PyObject *task)
+/*[clinic end generated code: output=a426922bd07f23d1 input=9d07401ef14ee048]*/
+{
+    asyncio_state *state = get_asyncio_state(module);
     if (unregister_eager_task(state, task) < 0) {
         return NULL;
     }
@@ -3579,6 +5440,147 @@ add_one_task(asyncio_state *state, PyObject *tasks, PyObject *task, PyObject *lo
     return 0;
 }
 
+/*[clinic input]
+_asyncio._pop_due_timers
+
+    scheduled: object(subclass_of='&PyList_Type')
+    ready: object
+    end_time: object
+    /
+
+Move the timer handles of the scheduled heap due before end_time to ready.
+
+This is a low-level function intended to be used by event loops.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__pop_due_timers_impl(PyObject *module, PyObject *scheduled,
+                              PyObject *ready, PyObject *end_time)
+/*[clinic end generated code: output=7b8c213cfae5f993 input=fe333bfe63998b10]*/
+{
+    asyncio_state *state = get_asyncio_state(module);
+
+    for (;;) {
+        PyObject *handle = PyList_GetItemRef(scheduled, 0);
+        if (handle == NULL) {
+            if (PyErr_ExceptionMatches(PyExc_IndexError)) {
+                /* The heap is empty. */
+                PyErr_Clear();
+                break;
+            }
+            return NULL;
+        }
+        PyObject *when;
+        if (TimerHandle_CheckExact(state, handle)) {
+            when = handle_get_attr(((TimerHandleObj *)handle)->th_when);
+        }
+        else {
+            when = PyObject_GetAttr(handle, &_Py_ID(_when));
+        }
+        Py_DECREF(handle);
+        if (when == NULL) {
+            return NULL;
+        }
+        int not_due;
+        if (PyFloat_CheckExact(when) && PyFloat_CheckExact(end_time)) {
+            not_due = PyFloat_AS_DOUBLE(when) >= PyFloat_AS_DOUBLE(end_time);
+        }
+        else {
+            not_due = PyObject_RichCompareBool(when, end_time, Py_GE);
+        }
+        Py_DECREF(when);
+        if (not_due != 0) {
+            if (not_due < 0) {
+                return NULL;
+            }
+            break;
+        }
+
+        handle = PyObject_CallOneArg(state->heapq_heappop, scheduled);
+        if (handle == NULL) {
+            return NULL;
+        }
+        if (TimerHandle_CheckExact(state, handle)) {
+            ((TimerHandleObj *)handle)->th_scheduled = 0;
+        }
+        else if (PyObject_SetAttr(handle, &_Py_ID(_scheduled), Py_False) < 0) {
+            Py_DECREF(handle);
+            return NULL;
+        }
+        PyObject *res = PyObject_CallMethodOneArg(ready, &_Py_ID(append),
+                                                  handle);
+        Py_DECREF(handle);
+        if (res == NULL) {
+            return NULL;
+        }
+        Py_DECREF(res);
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio._run_ready
+
+    ready: object
+    /
+
+Run the callbacks of the handles in the ready queue.
+
+Only the handles already in the queue are run: the ones added by the
+callbacks are left for the next call.  Cancelled handles are dropped.
+
+This is a low-level function intended to be used by event loops.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__run_ready(PyObject *module, PyObject *ready)
+/*[clinic end generated code: output=d903f222126af846 input=eaed90593e80e829]*/
+{
+    asyncio_state *state = get_asyncio_state(module);
+
+    Py_ssize_t ntodo = PyObject_Size(ready);
+    if (ntodo < 0) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < ntodo; i++) {
+        PyObject *handle = PyObject_CallMethodNoArgs(ready, &_Py_ID(popleft));
+        if (handle == NULL) {
+            return NULL;
+        }
+        int rc;
+        if (Handle_CheckExact(state, handle) ||
+            TimerHandle_CheckExact(state, handle)) {
+            HandleObj *h = (HandleObj *)handle;
+            rc = h->h_cancelled ? 0 : handle_run(state, h);
+        }
+        else {
+            /* Handle subclasses and third party handles. */
+            PyObject *cancelled = PyObject_GetAttr(handle,
+                                                   &_Py_ID(_cancelled));
+            rc = -1;
+            if (cancelled != NULL) {
+                int is_true = PyObject_IsTrue(cancelled);
+                Py_DECREF(cancelled);
+                if (is_true == 0) {
+                    PyObject *res = PyObject_CallMethodNoArgs(
+                        handle, &_Py_ID(_run));
+                    rc = res == NULL ? -1 : 0;
+                    Py_XDECREF(res);
+                }
+                else if (is_true > 0) {
+                    rc = 0;
+                }
+            }
+        }
+        Py_DECREF(handle);
+        if (rc < 0) {
+            return NULL;
+        }
+    }
+    Py_RETURN_NONE;
+}
+
+
 /*********************** Module **************************/
 
 /*[clinic input]
@@ -3682,9 +5684,16 @@ module_traverse(PyObject *mod, visitproc visit, void *arg)
     Py_VISIT(state->TaskStepMethWrapper_Type);
     Py_VISIT(state->FutureType);
     Py_VISIT(state->TaskType);
+    Py_VISIT(state->HandleType);
+    Py_VISIT(state->TimerHandleType);
+    Py_VISIT(state->GatheringFutureType);
+    Py_VISIT(state->TaskGroupBaseType);
 
     Py_VISIT(state->asyncio_mod);
     Py_VISIT(state->traceback_extract_stack);
+    Py_VISIT(state->heapq_heappop);
+    Py_VISIT(state->asyncio_extract_stack_func);
+    Py_VISIT(state->asyncio_format_callback_source_func);
     Py_VISIT(state->asyncio_future_repr_func);
     Py_VISIT(state->asyncio_get_event_loop_policy);
     Py_VISIT(state->asyncio_iscoroutine_func);
@@ -3700,6 +5709,11 @@ module_traverse(PyObject *mod, visitproc visit, void *arg)
     Py_VISIT(state->iscoroutine_typecache);
 
     Py_VISIT(state->context_kwname);
+    Py_VISIT(state->debug_kwname);
+    Py_VISIT(state->loop_kwname);
+    Py_VISIT(state->msg_kwname);
+    Py_VISIT(state->name_kwname);
+    Py_VISIT(state->name_context_kwnames);
 
     return 0;
 }
@@ -3713,9 +5727,16 @@ module_clear(PyObject *mod)
     Py_CLEAR(state->TaskStepMethWrapper_Type);
     Py_CLEAR(state->FutureType);
     Py_CLEAR(state->TaskType);
+    Py_CLEAR(state->HandleType);
+    Py_CLEAR(state->TimerHandleType);
+    Py_CLEAR(state->GatheringFutureType);
+    Py_CLEAR(state->TaskGroupBaseType);
 
     Py_CLEAR(state->asyncio_mod);
     Py_CLEAR(state->traceback_extract_stack);
+    Py_CLEAR(state->heapq_heappop);
+    Py_CLEAR(state->asyncio_extract_stack_func);
+    Py_CLEAR(state->asyncio_format_callback_source_func);
     Py_CLEAR(state->asyncio_future_repr_func);
     Py_CLEAR(state->asyncio_get_event_loop_policy);
     Py_CLEAR(state->asyncio_iscoroutine_func);
@@ -3731,6 +5752,11 @@ module_clear(PyObject *mod)
     Py_CLEAR(state->iscoroutine_typecache);
 
     Py_CLEAR(state->context_kwname);
+    Py_CLEAR(state->debug_kwname);
+    Py_CLEAR(state->loop_kwname);
+    Py_CLEAR(state->msg_kwname);
+    Py_CLEAR(state->name_kwname);
+    Py_CLEAR(state->name_context_kwnames);
 
     return 0;
 }
@@ -3767,6 +5793,31 @@ module_init(asyncio_state *state)
         goto fail;
     }
 
+    state->debug_kwname = Py_BuildValue("(s)", "debug");
+    if (state->debug_kwname == NULL) {
+        goto fail;
+    }
+
+    state->loop_kwname = Py_BuildValue("(s)", "loop");
+    if (state->loop_kwname == NULL) {
+        goto fail;
+    }
+
+    state->msg_kwname = Py_BuildValue("(s)", "msg");
+    if (state->msg_kwname == NULL) {
+        goto fail;
+    }
+
+    state->name_kwname = Py_BuildValue("(s)", "name");
+    if (state->name_kwname == NULL) {
+        goto fail;
+    }
+
+    state->name_context_kwnames = Py_BuildValue("(ss)", "name", "context");
+    if (state->name_context_kwnames == NULL) {
+        goto fail;
+    }
+
 #define WITH_MOD(NAME) \
     Py_CLEAR(module); \
     module = PyImport_ImportModule(NAME); \
@@ -3798,9 +5849,17 @@ module_init(asyncio_state *state)
     WITH_MOD("asyncio.coroutines")
     GET_MOD_ATTR(state->asyncio_iscoroutine_func, "iscoroutine")
 
+    WITH_MOD("asyncio.format_helpers")
+    GET_MOD_ATTR(state->asyncio_extract_stack_func, "extract_stack")
+    GET_MOD_ATTR(state->asyncio_format_callback_source_func,
+                 "_format_callback_source")
+
     WITH_MOD("traceback")
     GET_MOD_ATTR(state->traceback_extract_stack, "extract_stack")
 
+    WITH_MOD("heapq")
+    GET_MOD_ATTR(state->heapq_heappop, "heappop")
+
     PyObject *weak_set;
     WITH_MOD("weakref")
     GET_MOD_ATTR(weak_set, "WeakSet");
@@ -3842,6 +5901,9 @@ static PyMethodDef asyncio_methods[] = {
     _ASYNCIO__LEAVE_TASK_METHODDEF
     _ASYNCIO__SWAP_CURRENT_TASK_METHODDEF
     _ASYNCIO_ALL_TASKS_METHODDEF
+    _ASYNCIO__POP_DUE_TIMERS_METHODDEF
+    _ASYNCIO__RUN_READY_METHODDEF
+    _ASYNCIO_GATHER_METHODDEF
     {NULL, NULL}
 };
 
@@ -3866,6 +5928,12 @@ module_exec(PyObject *mod)
     CREATE_TYPE(mod, state->FutureIterType, &FutureIter_spec, NULL);
     CREATE_TYPE(mod, state->FutureType, &Future_spec, NULL);
     CREATE_TYPE(mod, state->TaskType, &Task_spec, state->FutureType);
+    CREATE_TYPE(mod, state->HandleType, &Handle_spec, NULL);
+    CREATE_TYPE(mod, state->TimerHandleType, &TimerHandle_spec,
+                state->HandleType);
+    CREATE_TYPE(mod, state->GatheringFutureType, &GatheringFuture_spec,
+                state->FutureType);
+    CREATE_TYPE(mod, state->TaskGroupBaseType, &TaskGroupBase_spec, NULL);
 
 #undef CREATE_TYPE
 
@@ -3876,6 +5944,22 @@ module_exec(PyObject *mod)
     if (PyModule_AddType(mod, state->TaskType) < 0) {
         return -1;
     }
+
+    if (PyModule_AddType(mod, state->HandleType) < 0) {
+        return -1;
+    }
+
+    if (PyModule_AddType(mod, state->TimerHandleType) < 0) {
+        return -1;
+    }
+
+    if (PyModule_AddType(mod, state->GatheringFutureType) < 0) {
+        return -1;
+    }
+
+    if (PyModule_AddType(mod, state->TaskGroupBaseType) < 0) {
+        return -1;
+    }
     // Must be done after types are added to avoid a circular dependency
     if (module_init(state) < 0) {
         return -1;
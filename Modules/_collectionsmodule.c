@@ -1,6 +1,6 @@
 #include "Python.h"
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
-#include "pycore_dict.h"          // _PyDict_GetItem_KnownHash()
+#include "pycore_dict.h"          // _PyDict_GetItem_KnownHash(), _PyFrozenDict_Type
 #include "pycore_long.h"          // _PyLong_GetZero()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "pycore_pyatomic_ft_wrappers.h"
@@ -2807,6 +2807,9 @@ collections_exec(PyObject *module) {
     if (PyModule_AddType(module, &PyODict_Type) < 0) {
         return -1;
     }
+    if (PyModule_AddType(module, &_PyFrozenDict_Type) < 0) {
+        return -1;
+    }
 
     return 0;
 }
@@ -499,6 +499,10 @@ _queueitem_clear_interpreter(_queueitem *item)
         return 0;
     }
     assert(_PyCrossInterpreterData_INTERPID(item->data) == item->interpid);
+    if (_PyCrossInterpreterData_INDEPENDENT(item->data)) {
+        // The data is still valid without its interpreter.
+        return 0;
+    }
 
     switch (item->unboundop) {
     case UNBOUND_REMOVE:
@@ -19,7 +19,9 @@
 
 #include "marshal.h"              // PyMarshal_ReadObjectFromString()
 
+#define REGISTERS_HEAP_TYPES
 #include "_interpreters_common.h"
+#undef REGISTERS_HEAP_TYPES
 
 
 #define MODULE_NAME _interpreters
@@ -211,6 +213,195 @@ register_memoryview_xid(PyObject *mod, PyTypeObject **p_state)
 
 
 
+/* Shared buffers ***********************************************************/
+
+// The bytes of a SharedBuffer are allocated once with the raw allocator,
+// which all the interpreters share, and are reference counted.  Every
+// SharedBuffer object holds a reference, and so does the cross-interpreter
+// data of a shared SharedBuffer, so sending one to another interpreter
+// does not copy the bytes, and they outlive the interpreter which created
+// them.
+
+typedef struct {
+    Py_ssize_t refcount;
+    Py_ssize_t len;
+    char bytes[];
+} _sharedbytes;
+
+static _sharedbytes *
+_sharedbytes_new(const void *bytes, Py_ssize_t len)
+{
+    if ((size_t)len > PY_SSIZE_T_MAX - sizeof(_sharedbytes)) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    _sharedbytes *shared = PyMem_RawMalloc(sizeof(_sharedbytes) + len);
+    if (shared == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    shared->refcount = 1;
+    shared->len = len;
+    memcpy(shared->bytes, bytes, len);
+    return shared;
+}
+
+static void
+_sharedbytes_incref(_sharedbytes *shared)
+{
+    _Py_atomic_add_ssize(&shared->refcount, 1);
+}
+
+static void
+_sharedbytes_decref(void *data)
+{
+    _sharedbytes *shared = (_sharedbytes *)data;
+    if (_Py_atomic_add_ssize(&shared->refcount, -1) == 1) {
+        PyMem_RawFree(shared);
+    }
+}
+
+typedef struct {
+    PyObject_HEAD
+    _sharedbytes *shared;
+} SharedBufferObject;
+
+static PyObject *
+sharedbuffer_from_shared(PyTypeObject *cls, _sharedbytes *shared)
+{
+    SharedBufferObject *self = (SharedBufferObject *)cls->tp_alloc(cls, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+    _sharedbytes_incref(shared);
+    self->shared = shared;
+    return (PyObject *)self;
+}
+
+static PyObject *
+sharedbuffer_new(PyTypeObject *cls, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"data", NULL};
+    Py_buffer view;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "y*:SharedBuffer", kwlist,
+                                     &view)) {
+        return NULL;
+    }
+    _sharedbytes *shared = _sharedbytes_new(view.buf, view.len);
+    PyBuffer_Release(&view);
+    if (shared == NULL) {
+        return NULL;
+    }
+    PyObject *self = sharedbuffer_from_shared(cls, shared);
+    _sharedbytes_decref(shared);
+    return self;
+}
+
+static void
+sharedbuffer_dealloc(SharedBufferObject *self)
+{
+    PyTypeObject *tp = Py_TYPE(self);
+    if (self->shared != NULL) {
+        _sharedbytes_decref(self->shared);
+    }
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+static int
+sharedbuffer_getbuf(SharedBufferObject *self, Py_buffer *view, int flags)
+{
+    return PyBuffer_FillInfo(view, (PyObject *)self, self->shared->bytes,
+                             self->shared->len, 1, flags);
+}
+
+static Py_ssize_t
+sharedbuffer_len(SharedBufferObject *self)
+{
+    return self->shared->len;
+}
+
+static PyObject *
+sharedbuffer_repr(SharedBufferObject *self)
+{
+    return PyUnicode_FromFormat("<%s object at %p, %zd bytes>",
+                                _PyType_Name(Py_TYPE(self)), self,
+                                self->shared->len);
+}
+
+PyDoc_STRVAR(sharedbuffer_doc,
+"SharedBuffer(data)\n\
+\n\
+An immutable copy of the bytes-like object data, which can be sent to\n\
+other interpreters without copying it again.  Use memoryview() to access\n\
+the bytes.");
+
+static PyType_Slot SharedBufferType_slots[] = {
+    {Py_tp_new, sharedbuffer_new},
+    {Py_tp_dealloc, (destructor)sharedbuffer_dealloc},
+    {Py_tp_repr, (reprfunc)sharedbuffer_repr},
+    {Py_tp_doc, (void *)sharedbuffer_doc},
+    {Py_sq_length, (lenfunc)sharedbuffer_len},
+    {Py_bf_getbuffer, (getbufferproc)sharedbuffer_getbuf},
+    {0, NULL},
+};
+
+static PyType_Spec SharedBufferType_spec = {
+    .name = MODULE_NAME_STR ".SharedBuffer",
+    .basicsize = sizeof(SharedBufferObject),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE),
+    .slots = SharedBufferType_slots,
+};
+
+
+static PyTypeObject * _get_current_sharedbuffer_type(void);
+
+static PyObject *
+_sharedbuffer_from_xid(_PyCrossInterpreterData *data)
+{
+    PyTypeObject *cls = _get_current_sharedbuffer_type();
+    if (cls == NULL) {
+        return NULL;
+    }
+    return sharedbuffer_from_shared(cls, _PyCrossInterpreterData_DATA(data));
+}
+
+static int
+_sharedbuffer_shared(PyThreadState *tstate, PyObject *obj,
+                     _PyCrossInterpreterData *data)
+{
+    _sharedbytes *shared = ((SharedBufferObject *)obj)->shared;
+    _sharedbytes_incref(shared);
+    _PyCrossInterpreterData_Init(data, tstate->interp, shared, NULL,
+                                 _sharedbuffer_from_xid);
+    _PyCrossInterpreterData_SET_FREE(data, _sharedbytes_decref);
+    _PyCrossInterpreterData_SET_INDEPENDENT(data);
+    return 0;
+}
+
+static int
+register_sharedbuffer_xid(PyObject *mod, PyTypeObject **p_state)
+{
+    assert(*p_state == NULL);
+    PyTypeObject *cls = (PyTypeObject *)PyType_FromModuleAndSpec(
+                mod, &SharedBufferType_spec, NULL);
+    if (cls == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(mod, cls) < 0) {
+        Py_DECREF(cls);
+        return -1;
+    }
+    *p_state = cls;
+
+    if (ensure_xid_class(cls, _sharedbuffer_shared) < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+
+
 /* module state *************************************************************/
 
 typedef struct {
@@ -218,6 +409,7 @@ typedef struct {
 
     /* heap types */
     PyTypeObject *XIBufferViewType;
+    PyTypeObject *SharedBufferType;
 } module_state;
 
 static inline module_state *
@@ -249,6 +441,7 @@ traverse_module_state(module_state *state, visitproc visit, void *arg)
 {
     /* heap types */
     Py_VISIT(state->XIBufferViewType);
+    Py_VISIT(state->SharedBufferType);
 
     return 0;
 }
@@ -258,6 +451,10 @@ clear_module_state(module_state *state)
 {
     /* heap types */
     Py_CLEAR(state->XIBufferViewType);
+    if (state->SharedBufferType != NULL) {
+        (void)clear_xid_class(state->SharedBufferType);
+        Py_CLEAR(state->SharedBufferType);
+    }
 
     return 0;
 }
@@ -273,6 +470,19 @@ _get_current_xibufferview_type(void)
     return state->XIBufferViewType;
 }
 
+static PyTypeObject *
+_get_current_sharedbuffer_type(void)
+{
+    // The receiving interpreter may not have imported the module yet.
+    PyObject *mod = PyImport_ImportModule(MODULE_NAME_STR);
+    if (mod == NULL) {
+        return NULL;
+    }
+    module_state *state = get_module_state(mod);
+    Py_DECREF(mod);
+    return state->SharedBufferType;
+}
+
 
 /* Python code **************************************************************/
 
@@ -1190,7 +1400,8 @@ PyDoc_STRVAR(is_shareable_doc,
 "is_shareable(obj) -> bool\n\
 \n\
 Return True if the object's data may be shared between interpreters and\n\
-False otherwise.");
+False otherwise.  Lists and dicts are shareable, but are shared as copies:\n\
+the other interpreter does not see later changes to them.");
 
 
 static PyObject *
@@ -1508,6 +1719,9 @@ module_exec(PyObject *mod)
     if (register_memoryview_xid(mod, &state->XIBufferViewType) < 0) {
         goto error;
     }
+    if (register_sharedbuffer_xid(mod, &state->SharedBufferType) < 0) {
+        goto error;
+    }
 
     return 0;
 
@@ -12,6 +12,7 @@
 #include "pycore_optimizer.h"     // _Py_GetExecutor()
 #include "pycore_opcode_metadata.h" // IS_VALID_OPCODE, OPCODE_HAS_*, etc
 #include "pycore_opcode_utils.h"
+#include "pycore_pystate.h"        // _PyInterpreterState_GET()
 
 /*[clinic input]
 module _opcode
@@ -397,6 +398,59 @@ _opcode_get_executor_impl(PyObject *module, PyObject *code, int offset)
 #endif
 }
 
+/*[clinic input]
+
+_opcode.get_executor_stats
+
+Return a dict of statistics about the executors of this interpreter.
+
+"memory" is the number of bytes held by live executors, including their
+machine code when the JIT is enabled.
+[clinic start generated code]*/
+
+static PyObject *
+_opcode_get_executor_stats_impl(PyObject *module)
+/*[clinic end generated code: output=4d13c9debd0b7e29 input=b9e5b0d4cc7d4120]*/
+{
+#ifdef _Py_TIER2
+    return _Py_Executors_GetStats(_PyInterpreterState_GET());
+#else
+    PyErr_Format(PyExc_RuntimeError,
+                 "Executors are not available in this build");
+    return NULL;
+#endif
+}
+
+/*[clinic input]
+
+_opcode.set_executor_memory_limit
+
+  limit: Py_ssize_t
+
+Set the executor memory budget of this interpreter, in bytes.
+
+Once executors hold more memory than this, cold executors are evicted,
+followed by the least recently created warm ones. 0 means no limit.
+[clinic start generated code]*/
+
+static PyObject *
+_opcode_set_executor_memory_limit_impl(PyObject *module, Py_ssize_t limit)
+/*[clinic end generated code: output=238c98fae7f8c497 input=3518979a8dbf57ef]*/
+{
+    if (limit < 0) {
+        PyErr_SetString(PyExc_ValueError, "limit must be non-negative");
+        return NULL;
+    }
+#ifdef _Py_TIER2
+    _Py_Executors_SetMemoryLimit(_PyInterpreterState_GET(), (size_t)limit);
+    Py_RETURN_NONE;
+#else
+    PyErr_Format(PyExc_RuntimeError,
+                 "Executors are not available in this build");
+    return NULL;
+#endif
+}
+
 static PyMethodDef
 opcode_functions[] =  {
     _OPCODE_STACK_EFFECT_METHODDEF
@@ -413,6 +467,8 @@ opcode_functions[] =  {
     _OPCODE_GET_INTRINSIC1_DESCS_METHODDEF
     _OPCODE_GET_INTRINSIC2_DESCS_METHODDEF
     _OPCODE_GET_EXECUTOR_METHODDEF
+    _OPCODE_GET_EXECUTOR_STATS_METHODDEF
+    _OPCODE_SET_EXECUTOR_MEMORY_LIMIT_METHODDEF
     _OPCODE_GET_SPECIAL_METHOD_NAMES_METHODDEF
     {NULL, NULL, 0, NULL}
 };
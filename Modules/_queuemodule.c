@@ -6,6 +6,8 @@
 #include "pycore_ceval.h"         // Py_MakePendingCalls()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "pycore_parking_lot.h"
+#include "pycore_pyatomic_ft_wrappers.h"
+#include "pycore_pymem.h"         // _PyMem_FreeDelayed()
 #include "pycore_time.h"          // _PyTime_FromSecondsObject()
 
 #include <stdbool.h>
@@ -27,175 +29,299 @@ static struct PyModuleDef queuemodule;
 #define simplequeue_get_state_by_type(type) \
     (simplequeue_get_state(PyType_GetModuleByDef(type, &queuemodule)))
 
-static const Py_ssize_t INITIAL_RING_BUF_CAPACITY = 8;
-
-typedef struct {
-    // Where to place the next item
-    Py_ssize_t put_idx;
-
-    // Where to get the next item
-    Py_ssize_t get_idx;
-
-    PyObject **items;
-
-    // Total number of items that may be stored
-    Py_ssize_t items_cap;
-
-    // Number of items stored
-    Py_ssize_t num_items;
-} RingBuf;
+// The items are stored in a linked list of fixed-size segments.  put()
+// claims a position in the queue by incrementing `tail` with a
+// compare-and-swap and then stores the item in the slot of the position.
+// get() claims the position `head` with a compare-and-swap once its item
+// was stored.  Neither of them takes a lock, so that producers and
+// consumers running in parallel on the free-threaded build only contend on
+// the cache lines of the two ends of the queue.
+//
+// Slots are never reused: a new segment is linked when put() reaches the
+// end of the last one, and a segment is freed once get() took all its
+// items.  Threads may still be reading a freed segment, so it is freed
+// with _PyMem_FreeDelayed(), which waits until all the threads reached a
+// quiescent state on the free-threaded build.
+#define SEGMENT_SIZE 32
+
+// Number of times get() reads again a slot claimed by put() but not
+// stored yet before giving up
+#define GET_SPIN_COUNT 1000
+
+typedef struct QueueSegment {
+    // Position in the queue of items[0]
+    Py_ssize_t start;
+
+    struct QueueSegment *next;
+
+    PyObject *items[SEGMENT_SIZE];
+} QueueSegment;
+
+// The operations on the queue are not interleaved when the GIL is enabled:
+// atomic read-modify-write operations are only needed on the free-threaded
+// build, like the FT_ATOMIC_* loads and stores.
+static inline int
+queue_cas_ptr(void *obj, void *expected, void *value)
+{
+#ifdef Py_GIL_DISABLED
+    return _Py_atomic_compare_exchange_ptr(obj, expected, value);
+#else
+    void **ptr = (void **)obj;
+    void **expected_ptr = (void **)expected;
+    if (*ptr == *expected_ptr) {
+        *ptr = value;
+        return 1;
+    }
+    *expected_ptr = *ptr;
+    return 0;
+#endif
+}
 
-static int
-RingBuf_Init(RingBuf *buf)
+static inline int
+queue_cas_ssize(Py_ssize_t *obj, Py_ssize_t *expected, Py_ssize_t value)
 {
-    buf->put_idx = 0;
-    buf->get_idx = 0;
-    buf->items_cap = INITIAL_RING_BUF_CAPACITY;
-    buf->num_items = 0;
-    buf->items = PyMem_Calloc(buf->items_cap, sizeof(PyObject *));
-    if (buf->items == NULL) {
-        PyErr_NoMemory();
-        return -1;
+#ifdef Py_GIL_DISABLED
+    return _Py_atomic_compare_exchange_ssize(obj, expected, value);
+#else
+    if (*obj == *expected) {
+        *obj = value;
+        return 1;
     }
+    *expected = *obj;
     return 0;
+#endif
 }
 
-static PyObject *
-RingBuf_At(RingBuf *buf, Py_ssize_t idx)
+static inline void
+queue_add_ssize(Py_ssize_t *obj, Py_ssize_t value)
 {
-    assert(idx >= 0 && idx < buf->num_items);
-    return buf->items[(buf->get_idx + idx) % buf->items_cap];
+#ifdef Py_GIL_DISABLED
+    _Py_atomic_add_ssize(obj, value);
+#else
+    *obj += value;
+#endif
 }
 
-static void
-RingBuf_Fini(RingBuf *buf)
+static inline void
+queue_add_uint(unsigned int *obj, unsigned int value)
 {
-    PyObject **items = buf->items;
-    Py_ssize_t num_items = buf->num_items;
-    Py_ssize_t cap = buf->items_cap;
-    Py_ssize_t idx = buf->get_idx;
-    buf->items = NULL;
-    buf->put_idx = 0;
-    buf->get_idx = 0;
-    buf->num_items = 0;
-    buf->items_cap = 0;
-    for (Py_ssize_t n = num_items; n > 0; idx = (idx + 1) % cap, n--) {
-        Py_DECREF(items[idx]);
+#ifdef Py_GIL_DISABLED
+    _Py_atomic_add_uint(obj, value);
+#else
+    *obj += value;
+#endif
+}
+
+// Keep the fields written by get() and put() in separate cache lines
+#define CACHE_LINE_SIZE 64
+
+typedef struct {
+    PyObject_HEAD
+
+    // Position of the next item to get and the segment holding it.  The
+    // segments are allocated on the first put().
+    Py_ssize_t head;
+    QueueSegment *head_seg;
+
+    char head_padding[CACHE_LINE_SIZE];
+
+    // Position where to put the next item and the segment holding it.
+    // `tail_seg` may lag behind `tail`.
+    Py_ssize_t tail;
+    QueueSegment *tail_seg;
+
+    char tail_padding[CACHE_LINE_SIZE];
+
+    // Number of threads waiting for items in get()
+    Py_ssize_t num_waiters;
+
+    // Incremented to wake up the threads parked on it in get()
+    unsigned int wakeup_seq;
+
+    PyObject *weakreflist;
+} simplequeueobject;
+
+static QueueSegment *
+segment_new(Py_ssize_t start)
+{
+    QueueSegment *seg = PyMem_Calloc(1, sizeof(QueueSegment));
+    if (seg == NULL) {
+        PyErr_NoMemory();
+        return NULL;
     }
-    PyMem_Free(items);
+    seg->start = start;
+    return seg;
 }
 
-// Resize the underlying items array of buf to the new capacity and arrange
-// the items contiguously in the new items array.
+// Allocate the first segment of an empty queue.
 //
 // Returns -1 on allocation failure or 0 on success.
 static int
-resize_ringbuf(RingBuf *buf, Py_ssize_t capacity)
+queue_init_segments(simplequeueobject *self)
 {
-    Py_ssize_t new_capacity = Py_MAX(INITIAL_RING_BUF_CAPACITY, capacity);
-    if (new_capacity == buf->items_cap) {
-        return 0;
-    }
-    assert(buf->num_items <= new_capacity);
-
-    PyObject **new_items = PyMem_Calloc(new_capacity, sizeof(PyObject *));
-    if (new_items == NULL) {
+    QueueSegment *seg = segment_new(0);
+    if (seg == NULL) {
         return -1;
     }
-
-    // Copy the "tail" of the old items array. This corresponds to "head" of
-    // the abstract ring buffer.
-    Py_ssize_t tail_size =
-        Py_MIN(buf->num_items, buf->items_cap - buf->get_idx);
-    if (tail_size > 0) {
-        memcpy(new_items, buf->items + buf->get_idx,
-               tail_size * sizeof(PyObject *));
+    QueueSegment *expected = NULL;
+    if (!queue_cas_ptr(&self->head_seg, &expected, seg)) {
+        // Another thread allocated it
+        PyMem_Free(seg);
+        seg = expected;
     }
-
-    // Copy the "head" of the old items array, if any. This corresponds to the
-    // "tail" of the abstract ring buffer.
-    Py_ssize_t head_size = buf->num_items - tail_size;
-    if (head_size > 0) {
-        memcpy(new_items + tail_size, buf->items,
-               head_size * sizeof(PyObject *));
-    }
-
-    PyMem_Free(buf->items);
-    buf->items = new_items;
-    buf->items_cap = new_capacity;
-    buf->get_idx = 0;
-    buf->put_idx = buf->num_items;
-
+    expected = NULL;
+    queue_cas_ptr(&self->tail_seg, &expected, seg);
     return 0;
 }
 
-// Returns a strong reference from the head of the buffer.
-static PyObject *
-RingBuf_Get(RingBuf *buf)
+// Free the segments and release the items of the queue.
+static void
+queue_fini(simplequeueobject *self)
 {
-    assert(buf->num_items > 0);
-
-    if (buf->num_items < (buf->items_cap / 4)) {
-        // Items is less than 25% occupied, shrink it by 50%. This allows for
-        // growth without immediately needing to resize the underlying items
-        // array.
-        //
-        // It's safe it ignore allocation failures here; shrinking is an
-        // optimization that isn't required for correctness.
-        (void)resize_ringbuf(buf, buf->items_cap / 2);
+    QueueSegment *seg = self->head_seg;
+    Py_ssize_t pos = self->head;
+    Py_ssize_t tail = self->tail;
+    // Detach the segments first: releasing an item may call put()
+    self->head_seg = NULL;
+    self->tail_seg = NULL;
+    self->head = 0;
+    self->tail = 0;
+    while (seg != NULL) {
+        for (; pos < tail && pos < seg->start + SEGMENT_SIZE; pos++) {
+            Py_XDECREF(seg->items[pos - seg->start]);
+        }
+        QueueSegment *next = seg->next;
+        PyMem_Free(seg);
+        seg = next;
     }
+}
 
-    PyObject *item = buf->items[buf->get_idx];
-    buf->items[buf->get_idx] = NULL;
-    buf->get_idx = (buf->get_idx + 1) % buf->items_cap;
-    buf->num_items--;
-    return item;
+// Move `head_seg` from `seg`, whose items were all got, to the next segment
+// and return it.
+static QueueSegment *
+queue_advance_head_segment(simplequeueobject *self, QueueSegment *seg)
+{
+    QueueSegment *next = FT_ATOMIC_LOAD_PTR_ACQUIRE(seg->next);
+    assert(next != NULL);
+    QueueSegment *expected = seg;
+    if (queue_cas_ptr(&self->head_seg, &expected, next)) {
+        // `tail_seg` never lags behind `head_seg`
+        expected = seg;
+        queue_cas_ptr(&self->tail_seg, &expected, next);
+        _PyMem_FreeDelayed(seg, sizeof(QueueSegment));
+    }
+    return next;
 }
 
-// Returns 0 on success or -1 if the buffer failed to grow.
+// Returns 0 on success or -1 if a segment could not be allocated.
 //
-// Steals a reference to item.
+// Steals a reference to item on success.
 static int
-RingBuf_Put(RingBuf *buf, PyObject *item)
+queue_put(simplequeueobject *self, PyObject *item)
 {
-    assert(buf->num_items <= buf->items_cap);
+    for (;;) {
+        QueueSegment *seg = FT_ATOMIC_LOAD_PTR_ACQUIRE(self->tail_seg);
+        if (seg == NULL) {
+            if (queue_init_segments(self) < 0) {
+                return -1;
+            }
+            continue;
+        }
+        // Read after `tail_seg`, so pos >= seg->start
+        Py_ssize_t pos = FT_ATOMIC_LOAD_SSIZE_ACQUIRE(self->tail);
+        while (pos >= seg->start + SEGMENT_SIZE) {
+            QueueSegment *next = FT_ATOMIC_LOAD_PTR_ACQUIRE(seg->next);
+            if (next == NULL) {
+                // Link the next segment before claiming a position in it,
+                // so that an allocation failure leaves no hole in the queue
+                next = segment_new(seg->start + SEGMENT_SIZE);
+                if (next == NULL) {
+                    return -1;
+                }
+                QueueSegment *expected = NULL;
+                if (!queue_cas_ptr(&seg->next, &expected,
+                                                     next)) {
+                    PyMem_Free(next);
+                    next = expected;
+                }
+            }
+            QueueSegment *expected = seg;
+            queue_cas_ptr(&self->tail_seg, &expected, next);
+            seg = next;
+        }
+        if (queue_cas_ssize(&self->tail, &pos, pos + 1)) {
+            // Sequentially consistent, so that either the thread waiting in
+            // get() sees the item, or this thread sees the waiter.
+            FT_ATOMIC_STORE_PTR(seg->items[pos - seg->start], item);
+            return 0;
+        }
+    }
+}
 
-    if (buf->num_items == buf->items_cap) {
-        // Buffer is full, grow it.
-        if (resize_ringbuf(buf, buf->items_cap * 2) < 0) {
-            PyErr_NoMemory();
-            return -1;
+// Returns a strong reference to the item at the head of the queue, or NULL
+// without an exception set if the queue is empty.
+static PyObject *
+queue_try_get(simplequeueobject *self)
+{
+    for (;;) {
+        QueueSegment *seg = FT_ATOMIC_LOAD_PTR_ACQUIRE(self->head_seg);
+        if (seg == NULL) {
+            return NULL;
+        }
+        // Read after `head_seg`, so pos >= seg->start
+        Py_ssize_t pos = FT_ATOMIC_LOAD_SSIZE_ACQUIRE(self->head);
+        if (pos >= FT_ATOMIC_LOAD_SSIZE_ACQUIRE(self->tail)) {
+            return NULL;
+        }
+        while (pos >= seg->start + SEGMENT_SIZE) {
+            seg = queue_advance_head_segment(self, seg);
+        }
+        PyObject **slot = &seg->items[pos - seg->start];
+        PyObject *item = FT_ATOMIC_LOAD_PTR(*slot);
+        // put() claimed the position but did not store the item yet: it
+        // only has a store left to do, so wait for it briefly rather than
+        // report an empty queue while qsize() is positive.
+        for (int i = 0; item == NULL && i < GET_SPIN_COUNT; i++) {
+            item = FT_ATOMIC_LOAD_PTR(*slot);
+        }
+        if (item == NULL) {
+            // The thread running put() was likely preempted.  It wakes up
+            // the waiting threads once the item is stored.
+            return NULL;
+        }
+        if (queue_cas_ssize(&self->head, &pos, pos + 1)) {
+            if (pos + 1 == seg->start + SEGMENT_SIZE
+                && FT_ATOMIC_LOAD_PTR_ACQUIRE(seg->next) != NULL)
+            {
+                queue_advance_head_segment(self, seg);
+            }
+            return item;
         }
     }
-    buf->items[buf->put_idx] = item;
-    buf->put_idx = (buf->put_idx + 1) % buf->items_cap;
-    buf->num_items++;
-    return 0;
 }
 
 static Py_ssize_t
-RingBuf_Len(RingBuf *buf)
+queue_len(simplequeueobject *self)
 {
-    return buf->num_items;
+    Py_ssize_t head = FT_ATOMIC_LOAD_SSIZE_ACQUIRE(self->head);
+    Py_ssize_t tail = FT_ATOMIC_LOAD_SSIZE_ACQUIRE(self->tail);
+    return tail - head;
 }
 
-static bool
-RingBuf_IsEmpty(RingBuf *buf)
+static void
+unpark_nothing(void *arg, void *park_arg, int has_more_waiters)
 {
-    return buf->num_items == 0;
 }
 
-typedef struct {
-    PyObject_HEAD
-
-    // Are there threads waiting for items
-    bool has_threads_waiting;
-
-    // Items in the queue
-    RingBuf buf;
-
-    PyObject *weakreflist;
-} simplequeueobject;
+// Wake up one of the threads waiting in get(), if any.
+static void
+queue_wakeup_waiter(simplequeueobject *self)
+{
+    if (FT_ATOMIC_LOAD_SSIZE(self->num_waiters) > 0) {
+        queue_add_uint(&self->wakeup_seq, 1);
+        _PyParkingLot_Unpark(&self->wakeup_seq, unpark_nothing, NULL);
+    }
+}
 
 /*[clinic input]
 module _queue
@@ -206,7 +332,7 @@ class _queue.SimpleQueue "simplequeueobject *" "simplequeue_get_state_by_type(ty
 static int
 simplequeue_clear(simplequeueobject *self)
 {
-    RingBuf_Fini(&self->buf);
+    queue_fini(self);
     return 0;
 }
 
@@ -226,9 +352,12 @@ simplequeue_dealloc(simplequeueobject *self)
 static int
 simplequeue_traverse(simplequeueobject *self, visitproc visit, void *arg)
 {
-    RingBuf *buf = &self->buf;
-    for (Py_ssize_t i = 0, num_items = buf->num_items; i < num_items; i++) {
-        Py_VISIT(RingBuf_At(buf, i));
+    QueueSegment *seg = self->head_seg;
+    for (Py_ssize_t pos = self->head; pos < self->tail; pos++) {
+        while (pos >= seg->start + SEGMENT_SIZE) {
+            seg = seg->next;
+        }
+        Py_VISIT(seg->items[pos - seg->start]);
     }
     Py_VISIT(Py_TYPE(self));
     return 0;
@@ -250,38 +379,12 @@ simplequeue_new_impl(PyTypeObject *type)
     self = (simplequeueobject *) type->tp_alloc(type, 0);
     if (self != NULL) {
         self->weakreflist = NULL;
-        if (RingBuf_Init(&self->buf) < 0) {
-            Py_DECREF(self);
-            return NULL;
-        }
     }
 
     return (PyObject *) self;
 }
 
-typedef struct {
-    bool handed_off;
-    simplequeueobject *queue;
-    PyObject *item;
-} HandoffData;
-
-static void
-maybe_handoff_item(HandoffData *data, PyObject **item, int has_more_waiters)
-{
-    if (item == NULL) {
-        // No threads were waiting
-        data->handed_off = false;
-    }
-    else {
-        // There was at least one waiting thread, hand off the item
-        *item = data->item;
-        data->handed_off = true;
-    }
-    data->queue->has_threads_waiting = has_more_waiters;
-}
-
 /*[clinic input]
-@critical_section
 _queue.SimpleQueue.put
     item: object
     block: bool = True
@@ -297,28 +400,17 @@ never blocks.  They are provided for compatibility with the Queue class.
 static PyObject *
 _queue_SimpleQueue_put_impl(simplequeueobject *self, PyObject *item,
                             int block, PyObject *timeout)
-/*[clinic end generated code: output=4333136e88f90d8b input=a16dbb33363c0fa8]*/
+/*[clinic end generated code: output=4333136e88f90d8b input=6e601fa707a782d5]*/
 {
-    HandoffData data = {
-        .handed_off = 0,
-        .item = Py_NewRef(item),
-        .queue = self,
-    };
-    if (self->has_threads_waiting) {
-        // Try to hand the item off directly if there are threads waiting
-        _PyParkingLot_Unpark(&self->has_threads_waiting,
-                             (_Py_unpark_fn_t *)maybe_handoff_item, &data);
-    }
-    if (!data.handed_off) {
-        if (RingBuf_Put(&self->buf, item) < 0) {
-            return NULL;
-        }
+    if (queue_put(self, Py_NewRef(item)) < 0) {
+        Py_DECREF(item);
+        return NULL;
     }
+    queue_wakeup_waiter(self);
     Py_RETURN_NONE;
 }
 
 /*[clinic input]
-@critical_section
 _queue.SimpleQueue.put_nowait
     item: object
 
@@ -331,11 +423,25 @@ for compatibility with the Queue class.
 
 static PyObject *
 _queue_SimpleQueue_put_nowait_impl(simplequeueobject *self, PyObject *item)
-/*[clinic end generated code: output=0990536715efb1f1 input=ce949cc2cd8a4119]*/
+/*[clinic end generated code: output=0990536715efb1f1 input=36b1ea96756b2ece]*/
 {
     return _queue_SimpleQueue_put_impl(self, item, 0, Py_None);
 }
 
+// Like queue_try_get(), but also wake up another waiting thread if items
+// are left in the queue.
+static PyObject *
+queue_get(simplequeueobject *self)
+{
+    PyObject *item = queue_try_get(self);
+    if (item != NULL && queue_len(self) > 0) {
+        // put() wakes up a single thread, which may have found the head of
+        // the queue not stored yet and waited again: pass the wakeup on
+        queue_wakeup_waiter(self);
+    }
+    return item;
+}
+
 static PyObject *
 empty_error(PyTypeObject *cls)
 {
@@ -347,7 +453,6 @@ empty_error(PyTypeObject *cls)
 }
 
 /*[clinic input]
-@critical_section
 _queue.SimpleQueue.get
 
     cls: defining_class
@@ -370,7 +475,7 @@ in that case).
 static PyObject *
 _queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
                             int block, PyObject *timeout_obj)
-/*[clinic end generated code: output=5c2cca914cd1e55b input=f7836c65e5839c51]*/
+/*[clinic end generated code: output=5c2cca914cd1e55b input=5b4047bfbc645ec1]*/
 {
     PyTime_t endtime = 0;
 
@@ -392,8 +497,9 @@ _queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
     }
 
     for (;;) {
-        if (!RingBuf_IsEmpty(&self->buf)) {
-            return RingBuf_Get(&self->buf);
+        PyObject *item = queue_get(self);
+        if (item != NULL) {
+            return item;
         }
 
         if (!block) {
@@ -408,20 +514,28 @@ _queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
             }
         }
 
-        bool waiting = 1;
-        self->has_threads_waiting = waiting;
-
-        PyObject *item = NULL;
-        int st = _PyParkingLot_Park(&self->has_threads_waiting, &waiting,
-                                    sizeof(bool), timeout_ns, &item,
-                                    /* detach */ 1);
+        // Register as a waiter before checking the queue again: put()
+        // stores the item before checking for waiters, so either this
+        // thread sees the item, or put() changes `wakeup_seq` and wakes it
+        // up.
+        queue_add_ssize(&self->num_waiters, 1);
+        unsigned int seq = FT_ATOMIC_LOAD_UINT(self->wakeup_seq);
+        int st = Py_PARK_AGAIN;
+        item = queue_get(self);
+        if (item == NULL) {
+            st = _PyParkingLot_Park(&self->wakeup_seq, &seq, sizeof(seq),
+                                    timeout_ns, NULL, /* detach */ 1);
+        }
+        queue_add_ssize(&self->num_waiters, -1);
+        if (item != NULL) {
+            return item;
+        }
         switch (st) {
-            case Py_PARK_OK: {
-                assert(item != NULL);
-                return item;
-            }
+            case Py_PARK_OK:
+            case Py_PARK_AGAIN:
             case Py_PARK_TIMEOUT: {
-                return empty_error(cls);
+                // Check the queue and the deadline again
+                break;
             }
             case Py_PARK_INTR: {
                 // Interrupted
@@ -430,13 +544,6 @@ _queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
                 }
                 break;
             }
-            case Py_PARK_AGAIN: {
-                // This should be impossible with the current implementation of
-                // PyParkingLot, but would be possible if critical sections /
-                // the GIL were released before the thread was added to the
-                // internal thread queue in the parking lot.
-                break;
-            }
             default: {
                 Py_UNREACHABLE();
             }
@@ -445,7 +552,6 @@ _queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
 }
 
 /*[clinic input]
-@critical_section
 _queue.SimpleQueue.get_nowait
 
     cls: defining_class
@@ -460,13 +566,12 @@ raise the Empty exception.
 static PyObject *
 _queue_SimpleQueue_get_nowait_impl(simplequeueobject *self,
                                    PyTypeObject *cls)
-/*[clinic end generated code: output=620c58e2750f8b8a input=d48be63633fefae9]*/
+/*[clinic end generated code: output=620c58e2750f8b8a input=842f732bf04216d3]*/
 {
     return _queue_SimpleQueue_get_impl(self, cls, 0, Py_None);
 }
 
 /*[clinic input]
-@critical_section
 _queue.SimpleQueue.empty -> bool
 
 Return True if the queue is empty, False otherwise (not reliable!).
@@ -474,13 +579,12 @@ Return True if the queue is empty, False otherwise (not reliable!).
 
 static int
 _queue_SimpleQueue_empty_impl(simplequeueobject *self)
-/*[clinic end generated code: output=1a02a1b87c0ef838 input=96cb22df5a67d831]*/
+/*[clinic end generated code: output=1a02a1b87c0ef838 input=1a98431c45fd66f9]*/
 {
-    return RingBuf_IsEmpty(&self->buf);
+    return queue_len(self) == 0;
 }
 
 /*[clinic input]
-@critical_section
 _queue.SimpleQueue.qsize -> Py_ssize_t
 
 Return the approximate size of the queue (not reliable!).
@@ -488,9 +592,9 @@ Return the approximate size of the queue (not reliable!).
 
 static Py_ssize_t
 _queue_SimpleQueue_qsize_impl(simplequeueobject *self)
-/*[clinic end generated code: output=f9dcd9d0a90e121e input=e218623cb8c16a79]*/
+/*[clinic end generated code: output=f9dcd9d0a90e121e input=7a74852b407868a1]*/
 {
-    return RingBuf_Len(&self->buf);
+    return queue_len(self);
 }
 
 static int
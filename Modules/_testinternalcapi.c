@@ -32,6 +32,7 @@
 #include "pycore_pyerrors.h"      // _PyErr_ChainExceptions1()
 #include "pycore_pylifecycle.h"   // _PyInterpreterConfig_AsDict()
 #include "pycore_pystate.h"       // _PyThreadState_GET()
+#include "pycore_tstate.h"        // _PyThreadStateImpl
 
 #include "clinic/_testinternalcapi.c.h"
 
@@ -1963,6 +1964,45 @@ get_py_thread_id(PyObject *self, PyObject *Py_UNUSED(ignored))
     Py_BUILD_ASSERT(sizeof(unsigned long long) >= sizeof(tid));
     return PyLong_FromUnsignedLongLong(tid);
 }
+
+// Clear the list and return a dict mapping the thread ids of the owners of
+// the objects still waiting in the biased reference counting batches of
+// this thread to their number.
+static PyObject *
+brc_clear_list(PyObject *self, PyObject *list)
+{
+    if (!PyList_CheckExact(list)) {
+        PyErr_SetString(PyExc_TypeError, "expected a list");
+        return NULL;
+    }
+    if (PyList_SetSlice(list, 0, PyList_GET_SIZE(list), NULL) < 0) {
+        return NULL;
+    }
+    PyObject *result = PyDict_New();
+    if (result == NULL) {
+        return NULL;
+    }
+    _PyThreadStateImpl *tstate = (_PyThreadStateImpl *)_PyThreadState_GET();
+    for (int i = 0; i < _Py_BRC_NUM_BATCHES; i++) {
+        struct _brc_batch *batch = &tstate->brc.batches[i];
+        if (batch->size == 0) {
+            continue;
+        }
+        PyObject *tid = PyLong_FromUnsignedLongLong(batch->tid);
+        PyObject *size = PyLong_FromSsize_t(batch->size);
+        if (tid == NULL || size == NULL
+            || PyDict_SetItem(result, tid, size) < 0)
+        {
+            Py_XDECREF(tid);
+            Py_XDECREF(size);
+            Py_DECREF(result);
+            return NULL;
+        }
+        Py_DECREF(tid);
+        Py_DECREF(size);
+    }
+    return result;
+}
 #endif
 
 static PyObject *
@@ -2136,6 +2176,7 @@ static PyMethodDef module_functions[] = {
 
 #ifdef Py_GIL_DISABLED
     {"py_thread_id", get_py_thread_id, METH_NOARGS},
+    {"brc_clear_list", brc_clear_list, METH_O},
 #endif
     {"suppress_immortalization", suppress_immortalization, METH_O},
     {"get_immortalize_deferred", get_immortalize_deferred, METH_NOARGS},
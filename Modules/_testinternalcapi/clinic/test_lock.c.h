@@ -7,7 +7,8 @@ preserve
 
 PyDoc_STRVAR(_testinternalcapi_benchmark_locks__doc__,
 "benchmark_locks($module, num_threads, use_pymutex=True,\n"
-"                critical_section_length=1, time_ms=1000, /)\n"
+"                critical_section_length=1, time_ms=1000,\n"
+"                noncritical_length=0, /)\n"
 "--\n"
 "\n");
 
@@ -19,7 +20,7 @@ _testinternalcapi_benchmark_locks_impl(PyObject *module,
                                        Py_ssize_t num_threads,
                                        int use_pymutex,
                                        int critical_section_length,
-                                       int time_ms);
+                                       int time_ms, int noncritical_length);
 
 static PyObject *
 _testinternalcapi_benchmark_locks(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
@@ -29,8 +30,9 @@ _testinternalcapi_benchmark_locks(PyObject *module, PyObject *const *args, Py_ss
     int use_pymutex = 1;
     int critical_section_length = 1;
     int time_ms = 1000;
+    int noncritical_length = 0;
 
-    if (!_PyArg_CheckPositional("benchmark_locks", nargs, 1, 4)) {
+    if (!_PyArg_CheckPositional("benchmark_locks", nargs, 1, 5)) {
         goto exit;
     }
     {
@@ -66,10 +68,17 @@ _testinternalcapi_benchmark_locks(PyObject *module, PyObject *const *args, Py_ss
     if (time_ms == -1 && PyErr_Occurred()) {
         goto exit;
     }
+    if (nargs < 5) {
+        goto skip_optional;
+    }
+    noncritical_length = PyLong_AsInt(args[4]);
+    if (noncritical_length == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
 skip_optional:
-    return_value = _testinternalcapi_benchmark_locks_impl(module, num_threads, use_pymutex, critical_section_length, time_ms);
+    return_value = _testinternalcapi_benchmark_locks_impl(module, num_threads, use_pymutex, critical_section_length, time_ms, noncritical_length);
 
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=105105d759c0c271 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=eba3132f58f8fa78 input=a9049054013a1b77]*/
@@ -194,6 +194,7 @@ struct bench_data_locks {
     int stop;
     int use_pymutex;
     int critical_section_length;
+    int noncritical_length;
     char padding[200];
     PyThread_type_lock lock;
     PyMutex m;
@@ -204,6 +205,7 @@ struct bench_data_locks {
 struct bench_thread_data {
     struct bench_data_locks *bench_data;
     Py_ssize_t iters;
+    double work;  // keeps the non-critical work from being optimized out
     PyEvent done;
 };
 
@@ -214,10 +216,17 @@ thread_benchmark_locks(void *arg)
     struct bench_data_locks *bench_data = thread_data->bench_data;
     int use_pymutex = bench_data->use_pymutex;
     int critical_section_length = bench_data->critical_section_length;
+    int noncritical_length = bench_data->noncritical_length;
 
     double my_value = 1.0;
+    double my_work = 0.0;
     Py_ssize_t iters = 0;
     while (!_Py_atomic_load_int_relaxed(&bench_data->stop)) {
+        // Work done without holding the lock: the longer it is, the lighter
+        // the contention.
+        for (int i = 0; i < noncritical_length; i++) {
+            my_work = my_work * 0.5 + my_value;
+        }
         if (use_pymutex) {
             PyMutex_Lock(&bench_data->m);
             for (int i = 0; i < critical_section_length; i++) {
@@ -238,6 +247,7 @@ thread_benchmark_locks(void *arg)
     }
 
     thread_data->iters = iters;
+    thread_data->work = my_work;
     _Py_atomic_add_ssize(&bench_data->total_iters, iters);
     _PyEvent_Notify(&thread_data->done);
 }
@@ -249,6 +259,7 @@ _testinternalcapi.benchmark_locks
     use_pymutex: bool = True
     critical_section_length: int = 1
     time_ms: int = 1000
+    noncritical_length: int = 0
     /
 
 [clinic start generated code]*/
@@ -258,8 +269,8 @@ _testinternalcapi_benchmark_locks_impl(PyObject *module,
                                        Py_ssize_t num_threads,
                                        int use_pymutex,
                                        int critical_section_length,
-                                       int time_ms)
-/*[clinic end generated code: output=381df8d7e9a74f18 input=f3aeaf688738c121]*/
+                                       int time_ms, int noncritical_length)
+/*[clinic end generated code: output=8453d4beee65e568 input=26b55dbadb0366d2]*/
 {
     // Run from Tools/lockbench/lockbench.py
     // Based on the WebKit lock benchmarks:
@@ -272,6 +283,7 @@ _testinternalcapi_benchmark_locks_impl(PyObject *module,
     memset(&bench_data, 0, sizeof(bench_data));
     bench_data.use_pymutex = use_pymutex;
     bench_data.critical_section_length = critical_section_length;
+    bench_data.noncritical_length = noncritical_length;
 
     bench_data.lock = PyThread_allocate_lock();
     if (bench_data.lock == NULL) {
@@ -340,7 +352,7 @@ test_lock_benchmark(PyObject *module, PyObject *obj)
 {
     // Just make sure the benchmark runs without crashing
     PyObject *res = _testinternalcapi_benchmark_locks_impl(
-        module, 1, 1, 1, 100);
+        module, 1, 1, 1, 100, 0);
     if (res == NULL) {
         return NULL;
     }
@@ -33,6 +33,9 @@ static PyObject *
 dict_clear(PyObject *self, PyObject *obj)
 {
     PyDict_Clear(obj);
+    if (PyErr_Occurred()) {
+        return NULL;
+    }
     Py_RETURN_NONE;
 }
 
@@ -0,0 +1,1018 @@
+/* _uring - Minimal io_uring interface for the asyncio event loop.
+
+   The module only exposes what asyncio's IoUringProactor needs: queueing
+   socket and file operations on the submission queue, and waiting for their
+   completions.  Operations are not submitted when they are queued; wait()
+   submits everything queued since the previous call with a single
+   io_uring_enter() system call, which also collects the completions.
+
+   Every operation gets an integer identifier, and wait() returns a list of
+   (identifier, result) pairs where result is the value the corresponding
+   system call would have returned, or a negated errno value.  Buffers passed
+   to an operation are kept exported until its completion has been returned,
+   so the kernel can safely write into them in the meantime.
+*/
+
+#ifndef Py_BUILD_CORE_BUILTIN
+#  define Py_BUILD_CORE_MODULE 1
+#endif
+
+#include "Python.h"
+#include "pycore_time.h"          // _PyTime_FromSecondsObject()
+
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <string.h>               // memset()
+#include <sys/mman.h>             // mmap()
+#include <sys/syscall.h>          // __NR_io_uring_setup
+#include <unistd.h>               // syscall()
+
+#define SEC_TO_NS (1000 * 1000 * 1000)
+
+
+/* An operation queued on the ring.  Its address is the user_data of the
+   submission queue entry, so the completion leads back to it.  User data 0
+   is used for the internal timeout and cancel requests, whose completions
+   are ignored. */
+typedef struct uring_op {
+    struct uring_op *prev;
+    struct uring_op *next;
+    unsigned long long id;      /* identifier returned to Python */
+    int cancelled;              /* a cancel request has been queued */
+    Py_buffer view;             /* buffer used by the kernel, if view.obj */
+} uring_op;
+
+typedef struct {
+    PyObject_HEAD
+    int fd;                     /* ring file descriptor, -1 once closed */
+
+    /* submission queue */
+    void *sq_ring;
+    size_t sq_ring_size;
+    uint32_t *sq_head;
+    uint32_t *sq_tail;
+    uint32_t sq_mask;
+    uint32_t sq_entries;
+    uint32_t *sq_array;
+    struct io_uring_sqe *sqes;
+    size_t sqes_size;
+    uint32_t sq_local_tail;     /* tail including unpublished entries */
+    uint32_t to_submit;         /* entries not handed to the kernel yet */
+
+    /* completion queue */
+    void *cq_ring;              /* same as sq_ring with a single mapping */
+    size_t cq_ring_size;
+    uint32_t *cq_head;
+    uint32_t *cq_tail;
+    uint32_t cq_mask;
+    struct io_uring_cqe *cqes;
+
+    /* in-flight operations, as a circular list */
+    uring_op pending;
+    Py_ssize_t npending;
+    unsigned long long next_id;
+
+    struct __kernel_timespec timeout;
+} IoUringObject;
+
+typedef struct {
+    PyTypeObject *IoUring_Type;
+} _uringstate;
+
+static inline _uringstate *
+get_uring_state(PyObject *module)
+{
+    void *state = PyModule_GetState(module);
+    assert(state != NULL);
+    return (_uringstate *)state;
+}
+
+static struct PyModuleDef _uringmodule;
+
+#define find_uring_state_by_type(tp) \
+    (get_uring_state(PyType_GetModuleByDef(tp, &_uringmodule)))
+
+/*[clinic input]
+module _uring
+class _uring.IoUring "IoUringObject *" "find_uring_state_by_type(type)->IoUring_Type"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=401eab259dd3d04b]*/
+
+#include "clinic/_uringmodule.c.h"
+
+
+static int
+sys_io_uring_setup(unsigned entries, struct io_uring_params *p)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int
+sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+                   unsigned flags)
+{
+    return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+                        flags, NULL, (size_t)0);
+}
+
+static int
+sys_io_uring_register(int fd, unsigned opcode, void *arg, unsigned nr_args)
+{
+    return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+static PyObject *
+uring_err_closed(void)
+{
+    PyErr_SetString(PyExc_ValueError, "I/O operation on closed io_uring");
+    return NULL;
+}
+
+/* Check that the kernel implements every operation used by the module.
+   Return 0 if it does, or an errno value otherwise. */
+static int
+uring_probe(int fd)
+{
+    static const int required[] = {
+        IORING_OP_READ, IORING_OP_WRITE, IORING_OP_RECV, IORING_OP_SEND,
+        IORING_OP_ACCEPT, IORING_OP_POLL_ADD, IORING_OP_TIMEOUT,
+        IORING_OP_ASYNC_CANCEL,
+    };
+    const unsigned nops = 256;
+    size_t size = sizeof(struct io_uring_probe)
+                  + nops * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe *probe = PyMem_Calloc(1, size);
+    if (probe == NULL) {
+        return ENOMEM;
+    }
+    int err = 0;
+    if (sys_io_uring_register(fd, IORING_REGISTER_PROBE, probe, nops) < 0) {
+        /* Kernels older than 5.6 cannot probe and lack IORING_OP_RECV */
+        err = (errno == EINVAL) ? ENOSYS : errno;
+    }
+    else {
+        for (size_t i = 0; i < Py_ARRAY_LENGTH(required); i++) {
+            int op = required[i];
+            if (op > probe->last_op
+                || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED))
+            {
+                err = ENOSYS;
+                break;
+            }
+        }
+    }
+    PyMem_Free(probe);
+    return err;
+}
+
+/* Map the rings of a freshly created io_uring. Return 0 on success, or -1
+   with errno set. */
+static int
+uring_map(IoUringObject *self, struct io_uring_params *p)
+{
+    self->sq_ring_size = p->sq_off.array + p->sq_entries * sizeof(uint32_t);
+    self->cq_ring_size = p->cq_off.cqes
+                         + p->cq_entries * sizeof(struct io_uring_cqe);
+    int single_mmap = (p->features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+        self->sq_ring_size = self->cq_ring_size =
+            Py_MAX(self->sq_ring_size, self->cq_ring_size);
+    }
+
+    self->sq_ring = mmap(NULL, self->sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, self->fd,
+                         IORING_OFF_SQ_RING);
+    if (self->sq_ring == MAP_FAILED) {
+        self->sq_ring = NULL;
+        return -1;
+    }
+    if (single_mmap) {
+        self->cq_ring = self->sq_ring;
+    }
+    else {
+        self->cq_ring = mmap(NULL, self->cq_ring_size, PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE, self->fd,
+                             IORING_OFF_CQ_RING);
+        if (self->cq_ring == MAP_FAILED) {
+            self->cq_ring = NULL;
+            return -1;
+        }
+    }
+    self->sqes_size = p->sq_entries * sizeof(struct io_uring_sqe);
+    void *sqes = mmap(NULL, self->sqes_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, self->fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        return -1;
+    }
+    self->sqes = (struct io_uring_sqe *)sqes;
+
+    char *sq = (char *)self->sq_ring;
+    self->sq_head = (uint32_t *)(sq + p->sq_off.head);
+    self->sq_tail = (uint32_t *)(sq + p->sq_off.tail);
+    self->sq_mask = *(uint32_t *)(sq + p->sq_off.ring_mask);
+    self->sq_entries = *(uint32_t *)(sq + p->sq_off.ring_entries);
+    self->sq_array = (uint32_t *)(sq + p->sq_off.array);
+    self->sq_local_tail = *self->sq_tail;
+
+    char *cq = (char *)self->cq_ring;
+    self->cq_head = (uint32_t *)(cq + p->cq_off.head);
+    self->cq_tail = (uint32_t *)(cq + p->cq_off.tail);
+    self->cq_mask = *(uint32_t *)(cq + p->cq_off.ring_mask);
+    self->cqes = (struct io_uring_cqe *)(cq + p->cq_off.cqes);
+    return 0;
+}
+
+static void
+uring_unmap(IoUringObject *self)
+{
+    if (self->sqes != NULL) {
+        munmap(self->sqes, self->sqes_size);
+        self->sqes = NULL;
+    }
+    if (self->cq_ring != NULL && self->cq_ring != self->sq_ring) {
+        munmap(self->cq_ring, self->cq_ring_size);
+    }
+    self->cq_ring = NULL;
+    if (self->sq_ring != NULL) {
+        munmap(self->sq_ring, self->sq_ring_size);
+        self->sq_ring = NULL;
+    }
+}
+
+static void
+uring_op_release(IoUringObject *self, uring_op *op)
+{
+    op->prev->next = op->next;
+    op->next->prev = op->prev;
+    self->npending--;
+    if (op->view.obj != NULL) {
+        PyBuffer_Release(&op->view);
+    }
+    PyMem_Free(op);
+}
+
+/* Publish the queued entries and enter the kernel.  Return the result of
+   io_uring_enter(), with errno set if it is negative. */
+static int
+uring_enter(IoUringObject *self, int fd, unsigned min_complete,
+            int release_gil)
+{
+    unsigned flags = min_complete ? IORING_ENTER_GETEVENTS : 0;
+    unsigned to_submit = self->to_submit;
+    int ret;
+
+    _Py_atomic_store_uint32_release(self->sq_tail, self->sq_local_tail);
+    if (release_gil) {
+        Py_BEGIN_ALLOW_THREADS
+        ret = sys_io_uring_enter(fd, to_submit, min_complete, flags);
+        Py_END_ALLOW_THREADS
+    }
+    else {
+        ret = sys_io_uring_enter(fd, to_submit, min_complete, flags);
+    }
+    if (ret > 0 && self->fd >= 0) {
+        self->to_submit -= Py_MIN((unsigned)ret, self->to_submit);
+    }
+    return ret;
+}
+
+/* Return a zeroed submission queue entry, submitting the queued ones if the
+   queue is full. */
+static struct io_uring_sqe *
+uring_get_sqe(IoUringObject *self)
+{
+    uint32_t head = _Py_atomic_load_uint32_acquire(self->sq_head);
+    if (self->sq_local_tail - head >= self->sq_entries) {
+        if (uring_enter(self, self->fd, 0, 0) < 0
+            && errno != EBUSY && errno != EAGAIN)
+        {
+            PyErr_SetFromErrno(PyExc_OSError);
+            return NULL;
+        }
+        head = _Py_atomic_load_uint32_acquire(self->sq_head);
+        if (self->sq_local_tail - head >= self->sq_entries) {
+            errno = EBUSY;
+            PyErr_SetFromErrno(PyExc_OSError);
+            return NULL;
+        }
+    }
+    uint32_t index = self->sq_local_tail & self->sq_mask;
+    struct io_uring_sqe *sqe = &self->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    self->sq_array[index] = index;
+    self->sq_local_tail++;
+    self->to_submit++;
+    return sqe;
+}
+
+/* Queue a new operation. On success, return the entry to fill in, and
+   take over the buffer view if one is given. */
+static struct io_uring_sqe *
+uring_prep(IoUringObject *self, uint8_t opcode, int fd, Py_buffer *view,
+           uring_op **result)
+{
+    if (self->fd < 0) {
+        uring_err_closed();
+        return NULL;
+    }
+    uring_op *op = PyMem_Malloc(sizeof(uring_op));
+    if (op == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    struct io_uring_sqe *sqe = uring_get_sqe(self);
+    if (sqe == NULL) {
+        PyMem_Free(op);
+        return NULL;
+    }
+    op->id = self->next_id++;
+    op->cancelled = 0;
+    if (view != NULL) {
+        /* The caller's view is released by Argument Clinic: keep a copy
+           and clear the original so it stays exported. */
+        op->view = *view;
+        memset(view, 0, sizeof(*view));
+        sqe->addr = (uint64_t)(uintptr_t)op->view.buf;
+        sqe->len = (uint32_t)Py_MIN(op->view.len, INT_MAX);
+    }
+    else {
+        op->view.obj = NULL;
+    }
+    op->prev = self->pending.prev;
+    op->next = &self->pending;
+    op->prev->next = op;
+    self->pending.prev = op;
+    self->npending++;
+
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->user_data = (uint64_t)(uintptr_t)op;
+    *result = op;
+    return sqe;
+}
+
+/* Move the available completions to list (or drop them if list is NULL)
+   and release their operations. */
+static int
+uring_reap(IoUringObject *self, PyObject *list)
+{
+    uint32_t head = *self->cq_head;
+    uint32_t tail = _Py_atomic_load_uint32_acquire(self->cq_tail);
+    int res = 0;
+    for (; head != tail; head++) {
+        struct io_uring_cqe *cqe = &self->cqes[head & self->cq_mask];
+        uring_op *op = (uring_op *)(uintptr_t)cqe->user_data;
+        if (op == NULL) {
+            continue;
+        }
+        if (list != NULL) {
+            PyObject *item = Py_BuildValue("Ki", op->id, cqe->res);
+            if (item == NULL || PyList_Append(list, item) < 0) {
+                /* Leave the completion in the queue for the next call */
+                Py_XDECREF(item);
+                res = -1;
+                break;
+            }
+            Py_DECREF(item);
+        }
+        uring_op_release(self, op);
+    }
+    _Py_atomic_store_uint32_release(self->cq_head, head);
+    return res;
+}
+
+static int
+uring_cancel_op(IoUringObject *self, uring_op *op)
+{
+    if (op->cancelled) {
+        return 0;
+    }
+    struct io_uring_sqe *sqe = uring_get_sqe(self);
+    if (sqe == NULL) {
+        return -1;
+    }
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = (uint64_t)(uintptr_t)op;
+    sqe->user_data = 0;
+    op->cancelled = 1;
+    return 0;
+}
+
+/* Cancel every pending operation, wait for them and close the ring. */
+static int
+uring_internal_close(IoUringObject *self)
+{
+    int save_errno = 0;
+    int fd = self->fd;
+    if (fd < 0) {
+        return 0;
+    }
+    if (self->sq_ring != NULL) {
+        for (uring_op *op = self->pending.next; op != &self->pending;
+             op = op->next)
+        {
+            if (uring_cancel_op(self, op) < 0) {
+                PyErr_Clear();
+                break;
+            }
+        }
+        while (self->npending > 0) {
+            if (uring_enter(self, fd, 1, 1) < 0
+                && errno != EINTR && errno != EBUSY && errno != EAGAIN)
+            {
+                save_errno = errno;
+                break;
+            }
+            (void)uring_reap(self, NULL);
+        }
+    }
+    /* Operations that could not be waited for are abandoned with the ring */
+    while (self->pending.next != &self->pending) {
+        uring_op_release(self, self->pending.next);
+    }
+    self->fd = -1;
+    uring_unmap(self);
+    if (close(fd) < 0 && save_errno == 0) {
+        save_errno = errno;
+    }
+    return save_errno;
+}
+
+
+/*[clinic input]
+@classmethod
+_uring.IoUring.__new__
+
+    entries: int = 256
+        The size of the submission queue.  The kernel rounds it up to a
+        power of two, and caps it to its own limit.
+
+Create an io_uring instance.
+
+Raise OSError if the kernel does not support io_uring, or lacks one of the
+operations used by this module.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_IoUring_impl(PyTypeObject *type, int entries)
+/*[clinic end generated code: output=08831b4c288efa2a input=b2c531c25d28ca2b]*/
+{
+    if (entries <= 0) {
+        PyErr_SetString(PyExc_ValueError, "entries must be positive");
+        return NULL;
+    }
+
+    struct io_uring_params params;
+    int fd;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CLAMP | IORING_SETUP_SUBMIT_ALL;
+    Py_BEGIN_ALLOW_THREADS
+    fd = sys_io_uring_setup((unsigned)entries, &params);
+    if (fd < 0 && errno == EINVAL) {
+        /* IORING_SETUP_SUBMIT_ALL requires Linux 5.18 */
+        memset(&params, 0, sizeof(params));
+        params.flags = IORING_SETUP_CLAMP;
+        fd = sys_io_uring_setup((unsigned)entries, &params);
+    }
+    Py_END_ALLOW_THREADS
+    if (fd < 0) {
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+
+    int err = uring_probe(fd);
+    if (err != 0) {
+        close(fd);
+        errno = err;
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+
+    allocfunc alloc = PyType_GetSlot(type, Py_tp_alloc);
+    IoUringObject *self = (IoUringObject *)alloc(type, 0);
+    if (self == NULL) {
+        close(fd);
+        return NULL;
+    }
+    self->fd = fd;
+    self->pending.prev = self->pending.next = &self->pending;
+    self->next_id = 1;
+    if (uring_map(self, &params) < 0) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject *)self;
+}
+
+static void
+uring_dealloc(IoUringObject *self)
+{
+    PyTypeObject *type = Py_TYPE(self);
+    (void)uring_internal_close(self);
+    freefunc uring_free = PyType_GetSlot(type, Py_tp_free);
+    uring_free((PyObject *)self);
+    Py_DECREF(type);
+}
+
+/*[clinic input]
+@critical_section
+_uring.IoUring.close
+
+Cancel the pending operations, wait for them and close the ring.
+
+The buffers of the cancelled operations are released, and their
+completions are discarded.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_IoUring_close_impl(IoUringObject *self)
+/*[clinic end generated code: output=341f7afa0beb833f input=be86d918d8225342]*/
+{
+    errno = uring_internal_close(self);
+    if (errno != 0) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+@critical_section
+_uring.IoUring.fileno
+
+Return the ring file descriptor.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_IoUring_fileno_impl(IoUringObject *self)
+/*[clinic end generated code: output=a1a58b0d093eb579 input=13d7a25e6cff17ca]*/
+{
+    if (self->fd < 0) {
+        return uring_err_closed();
+    }
+    return PyLong_FromLong(self->fd);
+}
+
+static PyObject *
+uring_get_closed(IoUringObject *self, void *Py_UNUSED(ignored))
+{
+    return PyBool_FromLong(self->fd < 0);
+}
+
+static PyObject *
+uring_get_pending(IoUringObject *self, void *Py_UNUSED(ignored))
+{
+    return PyLong_FromSsize_t(self->npending);
+}
+
+/*[clinic input]
+@critical_section
+_uring.IoUring.recv
+
+    fd: fildes
+    buffer: Py_buffer(accept={rwbuffer})
+    flags: int = 0
+    /
+
+Queue a recv() of up to len(buffer) bytes into buffer.
+
+Return the identifier of the operation.  Its result is the number of
+bytes received.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_IoUring_recv_impl(IoUringObject *self, int fd, Py_buffer *buffer,
+                         int flags)
+/*[clinic end generated code: output=f91aa874b77bfabd input=8ae6b2876b822cbc]*/
+{
+    uring_op *op;
+    struct io_uring_sqe *sqe = uring_prep(self, IORING_OP_RECV, fd, buffer,
+                                          &op);
+    if (sqe == NULL) {
+        return NULL;
+    }
+    sqe->msg_flags = (uint32_t)flags;
+    return PyLong_FromUnsignedLongLong(op->id);
+}
+
+/*[clinic input]
+@critical_section
+_uring.IoUring.send
+
+    fd: fildes
+    data: Py_buffer
+    flags: int = 0
+    /
+
+Queue a send() of data.
+
+Return the identifier of the operation.  Its result is the number of
+bytes sent, which can be less than len(data).
+[clinic start generated code]*/
+
+static PyObject *
+_uring_IoUring_send_impl(IoUringObject *self, int fd, Py_buffer *data,
+                         int flags)
+/*[clinic end generated code: output=0b22a268ae3f4bb9 input=0258800803622fa9]*/
+{
+    uring_op *op;
+    struct io_uring_sqe *sqe = uring_prep(self, IORING_OP_SEND, fd, data,
+                                          &op);
+    if (sqe == NULL) {
+        return NULL;
+    }
+    sqe->msg_flags = (uint32_t)flags;
+    return PyLong_FromUnsignedLongLong(op->id);
+}
+
+/*[clinic input]
+@critical_section
+_uring.IoUring.read
+
+    fd: fildes
+    buffer: Py_buffer(accept={rwbuffer})
+    offset: long_long = -1
+        The file offset to read from, or -1 to read from the current
+        position, which is also used for pipes and terminals.
+    /
+
+Queue a read() of up to len(buffer) bytes into buffer.
+
+Return the identifier of the operation.  Its result is the number of
+bytes read.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_IoUring_read_impl(IoUringObject *self, int fd, Py_buffer *buffer,
+                         long long offset)
+/*[clinic end generated code: output=2d0eda9e2ddab341 input=6929a87b69d8a484]*/
+{
+    uring_op *op;
+    struct io_uring_sqe *sqe = uring_prep(self, IORING_OP_READ, fd, buffer,
+                                          &op);
+    if (sqe == NULL) {
+        return NULL;
+    }
+    sqe->off = (uint64_t)offset;
+    return PyLong_FromUnsignedLongLong(op->id);
+}
+
+/*[clinic input]
+@critical_section
+_uring.IoUring.write
+
+    fd: fildes
+    data: Py_buffer
+    offset: long_long = -1
+        The file offset to write at, or -1 to write at the current
+        position.
+    /
+
+Queue a write() of data.
+
+Return the identifier of the operation.  Its result is the number of
+bytes written.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_IoUring_write_impl(IoUringObject *self, int fd, Py_buffer *data,
+                          long long offset)
+/*[clinic end generated code: output=4e3d41090f72dd5f input=12bbc31a4c72e5e7]*/
+{
+    uring_op *op;
+    struct io_uring_sqe *sqe = uring_prep(self, IORING_OP_WRITE, fd, data,
+                                          &op);
+    if (sqe == NULL) {
+        return NULL;
+    }
+    sqe->off = (uint64_t)offset;
+    return PyLong_FromUnsignedLongLong(op->id);
+}
+
+/*[clinic input]
+@critical_section
+_uring.IoUring.accept
+
+    fd: fildes
+    flags: int = 0
+        Flags of the accepted socket, such as SOCK_NONBLOCK and
+        SOCK_CLOEXEC.
+    /
+
+Queue an accept4() on the listening socket fd.
+
+Return the identifier of the operation.  Its result is the file
+descriptor of the accepted socket.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_IoUring_accept_impl(IoUringObject *self, int fd, int flags)
+/*[clinic end generated code: output=e877f0c3995b3ae8 input=2526d3d7d7e20e2b]*/
+{
+    uring_op *op;
+    struct io_uring_sqe *sqe = uring_prep(self, IORING_OP_ACCEPT, fd, NULL,
+                                          &op);
+    if (sqe == NULL) {
+        return NULL;
+    }
+    sqe->accept_flags = (uint32_t)flags;
+    return PyLong_FromUnsignedLongLong(op->id);
+}
+
+/*[clinic input]
+@critical_section
+_uring.IoUring.poll
+
+    fd: fildes
+    eventmask: unsigned_short
+    /
+
+Queue a one-shot wait for the poll() events in eventmask on fd.
+
+Return the identifier of the operation.  Its result is the mask of the
+events that occurred.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_IoUring_poll_impl(IoUringObject *self, int fd,
+                         unsigned short eventmask)
+/*[clinic end generated code: output=73790f214e3e8724 input=54cc98996233bacb]*/
+{
+    uring_op *op;
+    struct io_uring_sqe *sqe = uring_prep(self, IORING_OP_POLL_ADD, fd, NULL,
+                                          &op);
+    if (sqe == NULL) {
+        return NULL;
+    }
+    uint32_t mask = eventmask;
+#if PY_BIG_ENDIAN
+    /* The kernel expects the mask word-reversed on big-endian machines */
+    mask = (mask << 16) | (mask >> 16);
+#endif
+    sqe->poll32_events = mask;
+    return PyLong_FromUnsignedLongLong(op->id);
+}
+
+/*[clinic input]
+@critical_section
+_uring.IoUring.cancel
+
+    id: unsigned_long_long(bitwise=True)
+    /
+
+Queue a request to cancel the operation id.
+
+Return False if the operation already completed.  Otherwise, its
+completion is still reported by wait(): its result is -ECANCELED if the
+cancellation succeeded, or the result of the operation if it completed
+first.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_IoUring_cancel_impl(IoUringObject *self, unsigned long long id)
+/*[clinic end generated code: output=983ec05b0e670759 input=126bda4fd93379a9]*/
+{
+    if (self->fd < 0) {
+        return uring_err_closed();
+    }
+    /* Cancellation is rare enough for a linear search */
+    for (uring_op *op = self->pending.next; op != &self->pending;
+         op = op->next)
+    {
+        if (op->id == id) {
+            if (uring_cancel_op(self, op) < 0) {
+                return NULL;
+            }
+            Py_RETURN_TRUE;
+        }
+    }
+    Py_RETURN_FALSE;
+}
+
+/*[clinic input]
+@critical_section
+_uring.IoUring.wait
+
+    timeout as timeout_obj: object = None
+        The maximum time to wait in seconds; None or a negative value
+        waits until an operation completes, and 0 does not wait.
+
+Submit the queued operations and wait for completions.
+
+Return a list of (id, result) pairs.  The result is negative errno value
+if the operation failed.  The list can be empty if the timeout expired
+or the call was interrupted by a signal.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_IoUring_wait_impl(IoUringObject *self, PyObject *timeout_obj)
+/*[clinic end generated code: output=cb783f765a185ced input=1128e48452ed228e]*/
+{
+    PyTime_t timeout = -1;
+
+    if (self->fd < 0) {
+        return uring_err_closed();
+    }
+    if (timeout_obj != Py_None) {
+        if (_PyTime_FromSecondsObject(&timeout, timeout_obj,
+                                      _PyTime_ROUND_TIMEOUT) < 0) {
+            if (PyErr_ExceptionMatches(PyExc_TypeError)) {
+                PyErr_SetString(PyExc_TypeError,
+                                "timeout must be a number or None");
+            }
+            return NULL;
+        }
+    }
+
+    unsigned min_complete = 1;
+    uint32_t head = *self->cq_head;
+    if (timeout == 0 || self->npending == 0
+        || head != _Py_atomic_load_uint32_acquire(self->cq_tail))
+    {
+        /* Nothing to wait for, or completions are already available */
+        min_complete = 0;
+    }
+    else if (timeout > 0) {
+        /* The timeout completes on expiry or as soon as any other
+           operation does, so it never outlives this call. */
+        struct io_uring_sqe *sqe = uring_get_sqe(self);
+        if (sqe == NULL) {
+            return NULL;
+        }
+        self->timeout.tv_sec = timeout / SEC_TO_NS;
+        self->timeout.tv_nsec = timeout % SEC_TO_NS;
+        sqe->opcode = IORING_OP_TIMEOUT;
+        sqe->fd = -1;
+        sqe->addr = (uint64_t)(uintptr_t)&self->timeout;
+        sqe->len = 1;
+        sqe->off = 1;
+        sqe->user_data = 0;
+    }
+
+    if (self->to_submit > 0 || min_complete > 0) {
+        int fd = self->fd;
+        if (uring_enter(self, fd, min_complete, min_complete > 0) < 0) {
+            if (errno == EINTR) {
+                if (PyErr_CheckSignals() < 0) {
+                    return NULL;
+                }
+            }
+            else if (errno != EBUSY && errno != EAGAIN && errno != ETIME) {
+                return PyErr_SetFromErrno(PyExc_OSError);
+            }
+        }
+        if (self->fd < 0) {
+            /* Closed by another thread while waiting */
+            return uring_err_closed();
+        }
+    }
+
+    PyObject *list = PyList_New(0);
+    if (list == NULL) {
+        return NULL;
+    }
+    if (uring_reap(self, list) < 0) {
+        Py_DECREF(list);
+        return NULL;
+    }
+    return list;
+}
+
+/*[clinic input]
+_uring.IoUring.__enter__
+
+[clinic start generated code]*/
+
+static PyObject *
+_uring_IoUring___enter___impl(IoUringObject *self)
+/*[clinic end generated code: output=be3c905c13ddaaf4 input=862f2b10796595dd]*/
+{
+    if (self->fd < 0) {
+        return uring_err_closed();
+    }
+    return Py_NewRef(self);
+}
+
+/*[clinic input]
+_uring.IoUring.__exit__
+
+    exc_type:  object = None
+    exc_value: object = None
+    exc_tb:    object = None
+    /
+
+[clinic start generated code]*/
+
+static PyObject *
+_uring_IoUring___exit___impl(IoUringObject *self, PyObject *exc_type,
+                             PyObject *exc_value, PyObject *exc_tb)
+/*[clinic end generated code: output=03c40fb019a10eac input=d9ceeb714d3a5d0e]*/
+{
+    return _uring_IoUring_close(self, NULL);
+}
+
+
+static PyMethodDef uring_methods[] = {
+    _URING_IOURING_CLOSE_METHODDEF
+    _URING_IOURING_FILENO_METHODDEF
+    _URING_IOURING_RECV_METHODDEF
+    _URING_IOURING_SEND_METHODDEF
+    _URING_IOURING_READ_METHODDEF
+    _URING_IOURING_WRITE_METHODDEF
+    _URING_IOURING_ACCEPT_METHODDEF
+    _URING_IOURING_POLL_METHODDEF
+    _URING_IOURING_CANCEL_METHODDEF
+    _URING_IOURING_WAIT_METHODDEF
+    _URING_IOURING___ENTER___METHODDEF
+    _URING_IOURING___EXIT___METHODDEF
+    {NULL, NULL},
+};
+
+static PyGetSetDef uring_getsetlist[] = {
+    {"closed", (getter)uring_get_closed, NULL,
+     "True if the ring is closed"},
+    {"pending", (getter)uring_get_pending, NULL,
+     "Number of operations whose completion was not returned yet"},
+    {NULL},
+};
+
+static PyType_Slot uring_Type_slots[] = {
+    {Py_tp_dealloc, uring_dealloc},
+    {Py_tp_doc, (void *)_uring_IoUring__doc__},
+    {Py_tp_getset, uring_getsetlist},
+    {Py_tp_methods, uring_methods},
+    {Py_tp_new, _uring_IoUring},
+    {0, NULL},
+};
+
+static PyType_Spec uring_Type_spec = {
+    .name = "_uring.IoUring",
+    .basicsize = sizeof(IoUringObject),
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE,
+    .slots = uring_Type_slots,
+};
+
+
+static int
+_uring_traverse(PyObject *module, visitproc visit, void *arg)
+{
+    _uringstate *state = get_uring_state(module);
+    Py_VISIT(state->IoUring_Type);
+    return 0;
+}
+
+static int
+_uring_clear(PyObject *module)
+{
+    _uringstate *state = get_uring_state(module);
+    Py_CLEAR(state->IoUring_Type);
+    return 0;
+}
+
+static void
+_uring_free(void *module)
+{
+    (void)_uring_clear((PyObject *)module);
+}
+
+static int
+_uring_exec(PyObject *module)
+{
+    _uringstate *state = get_uring_state(module);
+    state->IoUring_Type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &uring_Type_spec, NULL);
+    if (state->IoUring_Type == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(module, state->IoUring_Type) < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static PyModuleDef_Slot _uring_slots[] = {
+    {Py_mod_exec, _uring_exec},
+    {Py_mod_multiple_interpreters, Py_MOD_PER_INTERPRETER_GIL_SUPPORTED},
+    {Py_mod_gil, Py_MOD_GIL_NOT_USED},
+    {0, NULL}
+};
+
+PyDoc_STRVAR(_uring__doc__,
+"Minimal io_uring interface used by the asyncio io_uring event loop.");
+
+static struct PyModuleDef _uringmodule = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "_uring",
+    .m_doc = _uring__doc__,
+    .m_size = sizeof(_uringstate),
+    .m_slots = _uring_slots,
+    .m_traverse = _uring_traverse,
+    .m_clear = _uring_clear,
+    .m_free = _uring_free,
+};
+
+PyMODINIT_FUNC
+PyInit__uring(void)
+{
+    return PyModuleDef_Init(&_uringmodule);
+}
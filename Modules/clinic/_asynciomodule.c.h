@@ -6,6 +6,7 @@ preserve
 #  include "pycore_gc.h"          // PyGC_Head
 #  include "pycore_runtime.h"     // _Py_ID()
 #endif
+#include "pycore_critical_section.h"// Py_BEGIN_CRITICAL_SECTION()
 #include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
 
 PyDoc_STRVAR(_asyncio_Future___init____doc__,
@@ -940,6 +941,547 @@ PyDoc_STRVAR(_asyncio_Task_set_name__doc__,
 #define _ASYNCIO_TASK_SET_NAME_METHODDEF    \
     {"set_name", (PyCFunction)_asyncio_Task_set_name, METH_O, _asyncio_Task_set_name__doc__},
 
+PyDoc_STRVAR(_asyncio__GatheringFuture_cancel__doc__,
+"cancel($self, /, msg=None)\n"
+"--\n"
+"\n"
+"Cancel the children which are not done yet.\n"
+"\n"
+"Unlike Future.cancel(), the future is not marked as cancelled: it is\n"
+"done when all the children are done.  Return True if a child was\n"
+"cancelled.");
+
+#define _ASYNCIO__GATHERINGFUTURE_CANCEL_METHODDEF    \
+    {"cancel", _PyCFunction_CAST(_asyncio__GatheringFuture_cancel), METH_FASTCALL|METH_KEYWORDS, _asyncio__GatheringFuture_cancel__doc__},
+
+static PyObject *
+_asyncio__GatheringFuture_cancel_impl(GatheringFutureObj *self,
+                                      PyObject *msg);
+
+static PyObject *
+_asyncio__GatheringFuture_cancel(GatheringFutureObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(msg), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"msg", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "cancel",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    PyObject *msg = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 0, 1, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    msg = args[0];
+skip_optional_pos:
+    return_value = _asyncio__GatheringFuture_cancel_impl(self, msg);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_gather__doc__,
+"gather($module, /, *coros_or_futures, return_exceptions=False)\n"
+"--\n"
+"\n"
+"Return a future aggregating results from the given coroutines/futures.\n"
+"\n"
+"Coroutines will be wrapped in a future and scheduled in the event\n"
+"loop. They will not necessarily be scheduled in the same order as\n"
+"passed in.\n"
+"\n"
+"All futures must share the same event loop.  If all the tasks are\n"
+"done successfully, the returned future\'s result is the list of\n"
+"results (in the order of the original sequence, not necessarily\n"
+"the order of results arrival).  If *return_exceptions* is True,\n"
+"exceptions in the tasks are treated the same as successful\n"
+"results, and gathered in the result list; otherwise, the first\n"
+"raised exception will be immediately propagated to the returned\n"
+"future.\n"
+"\n"
+"Cancellation: if the outer Future is cancelled, all children (that\n"
+"have not completed yet) are also cancelled.  If any child is\n"
+"cancelled, this is treated as if it raised CancelledError --\n"
+"the outer Future is *not* cancelled in this case.  (This is to\n"
+"prevent the cancellation of one child to cause other children to\n"
+"be cancelled.)\n"
+"\n"
+"If *return_exceptions* is False, cancelling gather() after it\n"
+"has been marked done won\'t cancel any submitted awaitables.\n"
+"For instance, gather can be marked done after propagating an\n"
+"exception to the caller, therefore, calling ``gather.cancel()``\n"
+"after catching an exception (raised by one of the awaitables) from\n"
+"gather won\'t cancel any other awaitables.");
+
+#define _ASYNCIO_GATHER_METHODDEF    \
+    {"gather", _PyCFunction_CAST(_asyncio_gather), METH_FASTCALL|METH_KEYWORDS, _asyncio_gather__doc__},
+
+static PyObject *
+_asyncio_gather_impl(PyObject *module, PyObject *coros_or_futures,
+                     int return_exceptions);
+
+static PyObject *
+_asyncio_gather(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(return_exceptions), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"return_exceptions", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "gather",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    Py_ssize_t noptargs = 0 + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    PyObject *coros_or_futures = NULL;
+    int return_exceptions = 0;
+
+    args = _PyArg_UnpackKeywordsWithVararg(args, nargs, NULL, kwnames, &_parser, 0, 0, 0, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    coros_or_futures = args[0];
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    return_exceptions = PyObject_IsTrue(args[1]);
+    if (return_exceptions < 0) {
+        goto exit;
+    }
+skip_optional_kwonly:
+    return_value = _asyncio_gather_impl(module, coros_or_futures, return_exceptions);
+
+exit:
+    Py_XDECREF(coros_or_futures);
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__TaskGroupBase_create_task__doc__,
+"create_task($self, /, coro, *, name=None, context=None)\n"
+"--\n"
+"\n"
+"Create a new task in this group and return it.\n"
+"\n"
+"Similar to `asyncio.create_task`.");
+
+#define _ASYNCIO__TASKGROUPBASE_CREATE_TASK_METHODDEF    \
+    {"create_task", _PyCFunction_CAST(_asyncio__TaskGroupBase_create_task), METH_FASTCALL|METH_KEYWORDS, _asyncio__TaskGroupBase_create_task__doc__},
+
+static PyObject *
+_asyncio__TaskGroupBase_create_task_impl(TaskGroupObj *self, PyObject *coro,
+                                         PyObject *name, PyObject *context);
+
+static PyObject *
+_asyncio__TaskGroupBase_create_task(TaskGroupObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 3
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(coro), &_Py_ID(name), &_Py_ID(context), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"coro", "name", "context", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "create_task",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[3];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 1;
+    PyObject *coro;
+    PyObject *name = Py_None;
+    PyObject *context = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 1, 1, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    coro = args[0];
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    if (args[1]) {
+        name = args[1];
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    context = args[2];
+skip_optional_kwonly:
+    return_value = _asyncio__TaskGroupBase_create_task_impl(self, coro, name, context);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__TaskGroupBase__on_task_done__doc__,
+"_on_task_done($self, task, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO__TASKGROUPBASE__ON_TASK_DONE_METHODDEF    \
+    {"_on_task_done", (PyCFunction)_asyncio__TaskGroupBase__on_task_done, METH_O, _asyncio__TaskGroupBase__on_task_done__doc__},
+
+PyDoc_STRVAR(_asyncio_Handle___init____doc__,
+"Handle(callback, args, loop, context=None)\n"
+"--\n"
+"\n"
+"Object returned by callback registration methods.");
+
+static int
+_asyncio_Handle___init___impl(HandleObj *self, PyObject *callback,
+                              PyObject *args, PyObject *loop,
+                              PyObject *context);
+
+static int
+_asyncio_Handle___init__(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    int return_value = -1;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 4
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(callback), &_Py_ID(args), &_Py_ID(loop), &_Py_ID(context), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"callback", "args", "loop", "context", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "Handle",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[4];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 3;
+    PyObject *callback;
+    PyObject *__clinic_args;
+    PyObject *loop;
+    PyObject *context = Py_None;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser, 3, 4, 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    callback = fastargs[0];
+    __clinic_args = fastargs[1];
+    loop = fastargs[2];
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    context = fastargs[3];
+skip_optional_pos:
+    return_value = _asyncio_Handle___init___impl((HandleObj *)self, callback, __clinic_args, loop, context);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_Handle__repr_info__doc__,
+"_repr_info($self, /)\n"
+"--\n"
+"\n"
+"Return the list of strings shown by repr().");
+
+#define _ASYNCIO_HANDLE__REPR_INFO_METHODDEF    \
+    {"_repr_info", (PyCFunction)_asyncio_Handle__repr_info, METH_NOARGS, _asyncio_Handle__repr_info__doc__},
+
+static PyObject *
+_asyncio_Handle__repr_info_impl(HandleObj *self);
+
+static PyObject *
+_asyncio_Handle__repr_info(HandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _asyncio_Handle__repr_info_impl(self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_Handle_get_context__doc__,
+"get_context($self, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO_HANDLE_GET_CONTEXT_METHODDEF    \
+    {"get_context", (PyCFunction)_asyncio_Handle_get_context, METH_NOARGS, _asyncio_Handle_get_context__doc__},
+
+static PyObject *
+_asyncio_Handle_get_context_impl(HandleObj *self);
+
+static PyObject *
+_asyncio_Handle_get_context(HandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_Handle_get_context_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio_Handle_cancel__doc__,
+"cancel($self, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO_HANDLE_CANCEL_METHODDEF    \
+    {"cancel", (PyCFunction)_asyncio_Handle_cancel, METH_NOARGS, _asyncio_Handle_cancel__doc__},
+
+static PyObject *
+_asyncio_Handle_cancel_impl(HandleObj *self);
+
+static PyObject *
+_asyncio_Handle_cancel(HandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _asyncio_Handle_cancel_impl(self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_Handle_cancelled__doc__,
+"cancelled($self, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO_HANDLE_CANCELLED_METHODDEF    \
+    {"cancelled", (PyCFunction)_asyncio_Handle_cancelled, METH_NOARGS, _asyncio_Handle_cancelled__doc__},
+
+static PyObject *
+_asyncio_Handle_cancelled_impl(HandleObj *self);
+
+static PyObject *
+_asyncio_Handle_cancelled(HandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_Handle_cancelled_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio_Handle__run__doc__,
+"_run($self, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO_HANDLE__RUN_METHODDEF    \
+    {"_run", (PyCFunction)_asyncio_Handle__run, METH_NOARGS, _asyncio_Handle__run__doc__},
+
+static PyObject *
+_asyncio_Handle__run_impl(HandleObj *self);
+
+static PyObject *
+_asyncio_Handle__run(HandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_Handle__run_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio_TimerHandle___init____doc__,
+"TimerHandle(when, callback, args, loop, context=None)\n"
+"--\n"
+"\n"
+"Object returned by timed callback registration methods.");
+
+static int
+_asyncio_TimerHandle___init___impl(TimerHandleObj *self, PyObject *when,
+                                   PyObject *callback, PyObject *args,
+                                   PyObject *loop, PyObject *context);
+
+static int
+_asyncio_TimerHandle___init__(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    int return_value = -1;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 5
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(when), &_Py_ID(callback), &_Py_ID(args), &_Py_ID(loop), &_Py_ID(context), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"when", "callback", "args", "loop", "context", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "TimerHandle",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[5];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 4;
+    PyObject *when;
+    PyObject *callback;
+    PyObject *__clinic_args;
+    PyObject *loop;
+    PyObject *context = Py_None;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser, 4, 5, 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    when = fastargs[0];
+    callback = fastargs[1];
+    __clinic_args = fastargs[2];
+    loop = fastargs[3];
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    context = fastargs[4];
+skip_optional_pos:
+    return_value = _asyncio_TimerHandle___init___impl((TimerHandleObj *)self, when, callback, __clinic_args, loop, context);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_TimerHandle__repr_info__doc__,
+"_repr_info($self, /)\n"
+"--\n"
+"\n"
+"Return the list of strings shown by repr().");
+
+#define _ASYNCIO_TIMERHANDLE__REPR_INFO_METHODDEF    \
+    {"_repr_info", (PyCFunction)_asyncio_TimerHandle__repr_info, METH_NOARGS, _asyncio_TimerHandle__repr_info__doc__},
+
+static PyObject *
+_asyncio_TimerHandle__repr_info_impl(TimerHandleObj *self);
+
+static PyObject *
+_asyncio_TimerHandle__repr_info(TimerHandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _asyncio_TimerHandle__repr_info_impl(self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_TimerHandle_cancel__doc__,
+"cancel($self, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO_TIMERHANDLE_CANCEL_METHODDEF    \
+    {"cancel", (PyCFunction)_asyncio_TimerHandle_cancel, METH_NOARGS, _asyncio_TimerHandle_cancel__doc__},
+
+static PyObject *
+_asyncio_TimerHandle_cancel_impl(TimerHandleObj *self);
+
+static PyObject *
+_asyncio_TimerHandle_cancel(TimerHandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _asyncio_TimerHandle_cancel_impl(self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_TimerHandle_when__doc__,
+"when($self, /)\n"
+"--\n"
+"\n"
+"Return a scheduled callback time.\n"
+"\n"
+"The time is an absolute timestamp, using the same time\n"
+"reference as loop.time().");
+
+#define _ASYNCIO_TIMERHANDLE_WHEN_METHODDEF    \
+    {"when", (PyCFunction)_asyncio_TimerHandle_when, METH_NOARGS, _asyncio_TimerHandle_when__doc__},
+
+static PyObject *
+_asyncio_TimerHandle_when_impl(TimerHandleObj *self);
+
+static PyObject *
+_asyncio_TimerHandle_when(TimerHandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_TimerHandle_when_impl(self);
+}
+
 PyDoc_STRVAR(_asyncio__get_running_loop__doc__,
 "_get_running_loop($module, /)\n"
 "--\n"
@@ -1488,6 +2030,59 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_asyncio__pop_due_timers__doc__,
+"_pop_due_timers($module, scheduled, ready, end_time, /)\n"
+"--\n"
+"\n"
+"Move the timer handles of the scheduled heap due before end_time to ready.\n"
+"\n"
+"This is a low-level function intended to be used by event loops.");
+
+#define _ASYNCIO__POP_DUE_TIMERS_METHODDEF    \
+    {"_pop_due_timers", _PyCFunction_CAST(_asyncio__pop_due_timers), METH_FASTCALL, _asyncio__pop_due_timers__doc__},
+
+static PyObject *
+_asyncio__pop_due_timers_impl(PyObject *module, PyObject *scheduled,
+                              PyObject *ready, PyObject *end_time);
+
+static PyObject *
+_asyncio__pop_due_timers(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *scheduled;
+    PyObject *ready;
+    PyObject *end_time;
+
+    if (!_PyArg_CheckPositional("_pop_due_timers", nargs, 3, 3)) {
+        goto exit;
+    }
+    if (!PyList_Check(args[0])) {
+        _PyArg_BadArgument("_pop_due_timers", "argument 1", "list", args[0]);
+        goto exit;
+    }
+    scheduled = args[0];
+    ready = args[1];
+    end_time = args[2];
+    return_value = _asyncio__pop_due_timers_impl(module, scheduled, ready, end_time);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__run_ready__doc__,
+"_run_ready($module, ready, /)\n"
+"--\n"
+"\n"
+"Run the callbacks of the handles in the ready queue.\n"
+"\n"
+"Only the handles already in the queue are run: the ones added by the\n"
+"callbacks are left for the next call.  Cancelled handles are dropped.\n"
+"\n"
+"This is a low-level function intended to be used by event loops.");
+
+#define _ASYNCIO__RUN_READY_METHODDEF    \
+    {"_run_ready", (PyCFunction)_asyncio__run_ready, METH_O, _asyncio__run_ready__doc__},
+
 PyDoc_STRVAR(_asyncio_all_tasks__doc__,
 "all_tasks($module, /, loop=None)\n"
 "--\n"
@@ -1547,4 +2142,4 @@ skip_optional_pos:
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=ffe9b71bc65888b3 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=07241feec79f1b79 input=a9049054013a1b77]*/
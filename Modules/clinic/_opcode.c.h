@@ -6,6 +6,7 @@ preserve
 #  include "pycore_gc.h"          // PyGC_Head
 #  include "pycore_runtime.h"     // _Py_ID()
 #endif
+#include "pycore_abstract.h"      // _PyNumber_Index()
 #include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
 
 PyDoc_STRVAR(_opcode_stack_effect__doc__,
@@ -746,4 +747,94 @@ _opcode_get_executor(PyObject *module, PyObject *const *args, Py_ssize_t nargs,
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=3b4d4f32eedd636e input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(_opcode_get_executor_stats__doc__,
+"get_executor_stats($module, /)\n"
+"--\n"
+"\n"
+"Return a dict of statistics about the executors of this interpreter.\n"
+"\n"
+"\"memory\" is the number of bytes held by live executors, including their\n"
+"machine code when the JIT is enabled.");
+
+#define _OPCODE_GET_EXECUTOR_STATS_METHODDEF    \
+    {"get_executor_stats", (PyCFunction)_opcode_get_executor_stats, METH_NOARGS, _opcode_get_executor_stats__doc__},
+
+static PyObject *
+_opcode_get_executor_stats_impl(PyObject *module);
+
+static PyObject *
+_opcode_get_executor_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _opcode_get_executor_stats_impl(module);
+}
+
+PyDoc_STRVAR(_opcode_set_executor_memory_limit__doc__,
+"set_executor_memory_limit($module, /, limit)\n"
+"--\n"
+"\n"
+"Set the executor memory budget of this interpreter, in bytes.\n"
+"\n"
+"Once executors hold more memory than this, cold executors are evicted,\n"
+"followed by the least recently created warm ones. 0 means no limit.");
+
+#define _OPCODE_SET_EXECUTOR_MEMORY_LIMIT_METHODDEF    \
+    {"set_executor_memory_limit", _PyCFunction_CAST(_opcode_set_executor_memory_limit), METH_FASTCALL|METH_KEYWORDS, _opcode_set_executor_memory_limit__doc__},
+
+static PyObject *
+_opcode_set_executor_memory_limit_impl(PyObject *module, Py_ssize_t limit);
+
+static PyObject *
+_opcode_set_executor_memory_limit(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(limit), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"limit", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "set_executor_memory_limit",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t limit;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 1, 1, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[0]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        limit = ival;
+    }
+    return_value = _opcode_set_executor_memory_limit_impl(module, limit);
+
+exit:
+    return return_value;
+}
+/*[clinic end generated code: output=32650157b8a8db7b input=a9049054013a1b77]*/
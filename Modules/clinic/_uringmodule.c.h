@@ -0,0 +1,617 @@
+/*[clinic input]
+preserve
+[clinic start generated code]*/
+
+#if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+#  include "pycore_gc.h"          // PyGC_Head
+#  include "pycore_runtime.h"     // _Py_ID()
+#endif
+#include "pycore_critical_section.h"// Py_BEGIN_CRITICAL_SECTION()
+#include "pycore_long.h"          // _PyLong_UnsignedShort_Converter()
+#include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
+
+PyDoc_STRVAR(_uring_IoUring__doc__,
+"IoUring(entries=256)\n"
+"--\n"
+"\n"
+"Create an io_uring instance.\n"
+"\n"
+"  entries\n"
+"    The size of the submission queue.  The kernel rounds it up to a\n"
+"    power of two, and caps it to its own limit.\n"
+"\n"
+"Raise OSError if the kernel does not support io_uring, or lacks one of the\n"
+"operations used by this module.");
+
+static PyObject *
+_uring_IoUring_impl(PyTypeObject *type, int entries);
+
+static PyObject *
+_uring_IoUring(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(entries), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"entries", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "IoUring",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 0;
+    int entries = 256;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser, 0, 1, 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    entries = PyLong_AsInt(fastargs[0]);
+    if (entries == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = _uring_IoUring_impl(type, entries);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_IoUring_close__doc__,
+"close($self, /)\n"
+"--\n"
+"\n"
+"Cancel the pending operations, wait for them and close the ring.\n"
+"\n"
+"The buffers of the cancelled operations are released, and their\n"
+"completions are discarded.");
+
+#define _URING_IOURING_CLOSE_METHODDEF    \
+    {"close", (PyCFunction)_uring_IoUring_close, METH_NOARGS, _uring_IoUring_close__doc__},
+
+static PyObject *
+_uring_IoUring_close_impl(IoUringObject *self);
+
+static PyObject *
+_uring_IoUring_close(IoUringObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_IoUring_close_impl(self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_IoUring_fileno__doc__,
+"fileno($self, /)\n"
+"--\n"
+"\n"
+"Return the ring file descriptor.");
+
+#define _URING_IOURING_FILENO_METHODDEF    \
+    {"fileno", (PyCFunction)_uring_IoUring_fileno, METH_NOARGS, _uring_IoUring_fileno__doc__},
+
+static PyObject *
+_uring_IoUring_fileno_impl(IoUringObject *self);
+
+static PyObject *
+_uring_IoUring_fileno(IoUringObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_IoUring_fileno_impl(self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_IoUring_recv__doc__,
+"recv($self, fd, buffer, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue a recv() of up to len(buffer) bytes into buffer.\n"
+"\n"
+"Return the identifier of the operation.  Its result is the number of\n"
+"bytes received.");
+
+#define _URING_IOURING_RECV_METHODDEF    \
+    {"recv", _PyCFunction_CAST(_uring_IoUring_recv), METH_FASTCALL, _uring_IoUring_recv__doc__},
+
+static PyObject *
+_uring_IoUring_recv_impl(IoUringObject *self, int fd, Py_buffer *buffer,
+                         int flags);
+
+static PyObject *
+_uring_IoUring_recv(IoUringObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_buffer buffer = {NULL, NULL};
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("recv", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyObject_AsFileDescriptor(args[0]);
+    if (fd < 0) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_WRITABLE) < 0) {
+        _PyArg_BadArgument("recv", "argument 2", "read-write bytes-like object", args[1]);
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[2]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_IoUring_recv_impl(self, fd, &buffer, flags);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_IoUring_send__doc__,
+"send($self, fd, data, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue a send() of data.\n"
+"\n"
+"Return the identifier of the operation.  Its result is the number of\n"
+"bytes sent, which can be less than len(data).");
+
+#define _URING_IOURING_SEND_METHODDEF    \
+    {"send", _PyCFunction_CAST(_uring_IoUring_send), METH_FASTCALL, _uring_IoUring_send__doc__},
+
+static PyObject *
+_uring_IoUring_send_impl(IoUringObject *self, int fd, Py_buffer *data,
+                         int flags);
+
+static PyObject *
+_uring_IoUring_send(IoUringObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_buffer data = {NULL, NULL};
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("send", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyObject_AsFileDescriptor(args[0]);
+    if (fd < 0) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[2]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_IoUring_send_impl(self, fd, &data, flags);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_IoUring_read__doc__,
+"read($self, fd, buffer, offset=-1, /)\n"
+"--\n"
+"\n"
+"Queue a read() of up to len(buffer) bytes into buffer.\n"
+"\n"
+"  offset\n"
+"    The file offset to read from, or -1 to read from the current\n"
+"    position, which is also used for pipes and terminals.\n"
+"\n"
+"Return the identifier of the operation.  Its result is the number of\n"
+"bytes read.");
+
+#define _URING_IOURING_READ_METHODDEF    \
+    {"read", _PyCFunction_CAST(_uring_IoUring_read), METH_FASTCALL, _uring_IoUring_read__doc__},
+
+static PyObject *
+_uring_IoUring_read_impl(IoUringObject *self, int fd, Py_buffer *buffer,
+                         long long offset);
+
+static PyObject *
+_uring_IoUring_read(IoUringObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_buffer buffer = {NULL, NULL};
+    long long offset = -1;
+
+    if (!_PyArg_CheckPositional("read", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyObject_AsFileDescriptor(args[0]);
+    if (fd < 0) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_WRITABLE) < 0) {
+        _PyArg_BadArgument("read", "argument 2", "read-write bytes-like object", args[1]);
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    offset = PyLong_AsLongLong(args[2]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_IoUring_read_impl(self, fd, &buffer, offset);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_IoUring_write__doc__,
+"write($self, fd, data, offset=-1, /)\n"
+"--\n"
+"\n"
+"Queue a write() of data.\n"
+"\n"
+"  offset\n"
+"    The file offset to write at, or -1 to write at the current\n"
+"    position.\n"
+"\n"
+"Return the identifier of the operation.  Its result is the number of\n"
+"bytes written.");
+
+#define _URING_IOURING_WRITE_METHODDEF    \
+    {"write", _PyCFunction_CAST(_uring_IoUring_write), METH_FASTCALL, _uring_IoUring_write__doc__},
+
+static PyObject *
+_uring_IoUring_write_impl(IoUringObject *self, int fd, Py_buffer *data,
+                          long long offset);
+
+static PyObject *
+_uring_IoUring_write(IoUringObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_buffer data = {NULL, NULL};
+    long long offset = -1;
+
+    if (!_PyArg_CheckPositional("write", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyObject_AsFileDescriptor(args[0]);
+    if (fd < 0) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    offset = PyLong_AsLongLong(args[2]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_IoUring_write_impl(self, fd, &data, offset);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_IoUring_accept__doc__,
+"accept($self, fd, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue an accept4() on the listening socket fd.\n"
+"\n"
+"  flags\n"
+"    Flags of the accepted socket, such as SOCK_NONBLOCK and\n"
+"    SOCK_CLOEXEC.\n"
+"\n"
+"Return the identifier of the operation.  Its result is the file\n"
+"descriptor of the accepted socket.");
+
+#define _URING_IOURING_ACCEPT_METHODDEF    \
+    {"accept", _PyCFunction_CAST(_uring_IoUring_accept), METH_FASTCALL, _uring_IoUring_accept__doc__},
+
+static PyObject *
+_uring_IoUring_accept_impl(IoUringObject *self, int fd, int flags);
+
+static PyObject *
+_uring_IoUring_accept(IoUringObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("accept", nargs, 1, 2)) {
+        goto exit;
+    }
+    fd = PyObject_AsFileDescriptor(args[0]);
+    if (fd < 0) {
+        goto exit;
+    }
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[1]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_IoUring_accept_impl(self, fd, flags);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_IoUring_poll__doc__,
+"poll($self, fd, eventmask, /)\n"
+"--\n"
+"\n"
+"Queue a one-shot wait for the poll() events in eventmask on fd.\n"
+"\n"
+"Return the identifier of the operation.  Its result is the mask of the\n"
+"events that occurred.");
+
+#define _URING_IOURING_POLL_METHODDEF    \
+    {"poll", _PyCFunction_CAST(_uring_IoUring_poll), METH_FASTCALL, _uring_IoUring_poll__doc__},
+
+static PyObject *
+_uring_IoUring_poll_impl(IoUringObject *self, int fd,
+                         unsigned short eventmask);
+
+static PyObject *
+_uring_IoUring_poll(IoUringObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    unsigned short eventmask;
+
+    if (!_PyArg_CheckPositional("poll", nargs, 2, 2)) {
+        goto exit;
+    }
+    fd = PyObject_AsFileDescriptor(args[0]);
+    if (fd < 0) {
+        goto exit;
+    }
+    if (!_PyLong_UnsignedShort_Converter(args[1], &eventmask)) {
+        goto exit;
+    }
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_IoUring_poll_impl(self, fd, eventmask);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_IoUring_cancel__doc__,
+"cancel($self, id, /)\n"
+"--\n"
+"\n"
+"Queue a request to cancel the operation id.\n"
+"\n"
+"Return False if the operation already completed.  Otherwise, its\n"
+"completion is still reported by wait(): its result is -ECANCELED if the\n"
+"cancellation succeeded, or the result of the operation if it completed\n"
+"first.");
+
+#define _URING_IOURING_CANCEL_METHODDEF    \
+    {"cancel", (PyCFunction)_uring_IoUring_cancel, METH_O, _uring_IoUring_cancel__doc__},
+
+static PyObject *
+_uring_IoUring_cancel_impl(IoUringObject *self, unsigned long long id);
+
+static PyObject *
+_uring_IoUring_cancel(IoUringObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    unsigned long long id;
+
+    if (!PyLong_Check(arg)) {
+        _PyArg_BadArgument("cancel", "argument", "int", arg);
+        goto exit;
+    }
+    id = PyLong_AsUnsignedLongLongMask(arg);
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_IoUring_cancel_impl(self, id);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_IoUring_wait__doc__,
+"wait($self, /, timeout=None)\n"
+"--\n"
+"\n"
+"Submit the queued operations and wait for completions.\n"
+"\n"
+"  timeout\n"
+"    The maximum time to wait in seconds; None or a negative value\n"
+"    waits until an operation completes, and 0 does not wait.\n"
+"\n"
+"Return a list of (id, result) pairs.  The result is negative errno value\n"
+"if the operation failed.  The list can be empty if the timeout expired\n"
+"or the call was interrupted by a signal.");
+
+#define _URING_IOURING_WAIT_METHODDEF    \
+    {"wait", _PyCFunction_CAST(_uring_IoUring_wait), METH_FASTCALL|METH_KEYWORDS, _uring_IoUring_wait__doc__},
+
+static PyObject *
+_uring_IoUring_wait_impl(IoUringObject *self, PyObject *timeout_obj);
+
+static PyObject *
+_uring_IoUring_wait(IoUringObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(timeout), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"timeout", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "wait",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    PyObject *timeout_obj = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 0, 1, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    timeout_obj = args[0];
+skip_optional_pos:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_IoUring_wait_impl(self, timeout_obj);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_IoUring___enter____doc__,
+"__enter__($self, /)\n"
+"--\n"
+"\n");
+
+#define _URING_IOURING___ENTER___METHODDEF    \
+    {"__enter__", (PyCFunction)_uring_IoUring___enter__, METH_NOARGS, _uring_IoUring___enter____doc__},
+
+static PyObject *
+_uring_IoUring___enter___impl(IoUringObject *self);
+
+static PyObject *
+_uring_IoUring___enter__(IoUringObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _uring_IoUring___enter___impl(self);
+}
+
+PyDoc_STRVAR(_uring_IoUring___exit____doc__,
+"__exit__($self, exc_type=None, exc_value=None, exc_tb=None, /)\n"
+"--\n"
+"\n");
+
+#define _URING_IOURING___EXIT___METHODDEF    \
+    {"__exit__", _PyCFunction_CAST(_uring_IoUring___exit__), METH_FASTCALL, _uring_IoUring___exit____doc__},
+
+static PyObject *
+_uring_IoUring___exit___impl(IoUringObject *self, PyObject *exc_type,
+                             PyObject *exc_value, PyObject *exc_tb);
+
+static PyObject *
+_uring_IoUring___exit__(IoUringObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *exc_type = Py_None;
+    PyObject *exc_value = Py_None;
+    PyObject *exc_tb = Py_None;
+
+    if (!_PyArg_CheckPositional("__exit__", nargs, 0, 3)) {
+        goto exit;
+    }
+    if (nargs < 1) {
+        goto skip_optional;
+    }
+    exc_type = args[0];
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    exc_value = args[1];
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    exc_tb = args[2];
+skip_optional:
+    return_value = _uring_IoUring___exit___impl(self, exc_type, exc_value, exc_tb);
+
+exit:
+    return return_value;
+}
+/*[clinic end generated code: output=d951f082c88c0e67 input=a9049054013a1b77]*/
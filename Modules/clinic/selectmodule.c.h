@@ -930,6 +930,45 @@ exit:
 
 #if defined(HAVE_EPOLL)
 
+PyDoc_STRVAR(select_epoll_register_many__doc__,
+"register_many($self, items, /)\n"
+"--\n"
+"\n"
+"Register several file descriptors with a single call.\n"
+"\n"
+"  items\n"
+"    an iterable of (fd, eventmask) pairs\n"
+"\n"
+"The file descriptors are registered in order.  If one of them cannot be\n"
+"registered, OSError is raised and the file descriptors before it stay\n"
+"registered.");
+
+#define SELECT_EPOLL_REGISTER_MANY_METHODDEF    \
+    {"register_many", (PyCFunction)select_epoll_register_many, METH_O, select_epoll_register_many__doc__},
+
+#endif /* defined(HAVE_EPOLL) */
+
+#if defined(HAVE_EPOLL)
+
+PyDoc_STRVAR(select_epoll_modify_many__doc__,
+"modify_many($self, items, /)\n"
+"--\n"
+"\n"
+"Modify the event masks of several registered file descriptors.\n"
+"\n"
+"  items\n"
+"    an iterable of (fd, eventmask) pairs\n"
+"\n"
+"The file descriptors are modified in order.  If one of them cannot be\n"
+"modified, OSError is raised and the changes before it stay applied.");
+
+#define SELECT_EPOLL_MODIFY_MANY_METHODDEF    \
+    {"modify_many", (PyCFunction)select_epoll_modify_many, METH_O, select_epoll_modify_many__doc__},
+
+#endif /* defined(HAVE_EPOLL) */
+
+#if defined(HAVE_EPOLL)
+
 PyDoc_STRVAR(select_epoll_poll__doc__,
 "poll($self, /, timeout=None, maxevents=-1)\n"
 "--\n"
@@ -1014,6 +1053,82 @@ exit:
 
 #if defined(HAVE_EPOLL)
 
+PyDoc_STRVAR(select_epoll_poll_into__doc__,
+"poll_into($self, /, buffer, timeout=None)\n"
+"--\n"
+"\n"
+"Wait for events on the epoll file descriptor and store them into buffer.\n"
+"\n"
+"  buffer\n"
+"    a writable buffer of C unsigned ints, such as array.array(\'I\')\n"
+"  timeout\n"
+"    the maximum time to wait in seconds (as float);\n"
+"    a timeout of None or -1 makes poll_into wait indefinitely\n"
+"\n"
+"Events are stored as consecutive pairs of file descriptor and event mask;\n"
+"the buffer size limits the number of events.  Returns the number of events.");
+
+#define SELECT_EPOLL_POLL_INTO_METHODDEF    \
+    {"poll_into", _PyCFunction_CAST(select_epoll_poll_into), METH_FASTCALL|METH_KEYWORDS, select_epoll_poll_into__doc__},
+
+static PyObject *
+select_epoll_poll_into_impl(pyEpoll_Object *self, PyObject *buffer_obj,
+                            PyObject *timeout_obj);
+
+static PyObject *
+select_epoll_poll_into(pyEpoll_Object *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 2
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(buffer), &_Py_ID(timeout), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"buffer", "timeout", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "poll_into",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 1;
+    PyObject *buffer_obj;
+    PyObject *timeout_obj = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 1, 2, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    buffer_obj = args[0];
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    timeout_obj = args[1];
+skip_optional_pos:
+    return_value = select_epoll_poll_into_impl(self, buffer_obj, timeout_obj);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_EPOLL) */
+
+#if defined(HAVE_EPOLL)
+
 PyDoc_STRVAR(select_epoll___enter____doc__,
 "__enter__($self, /)\n"
 "--\n"
@@ -1333,10 +1448,22 @@ exit:
     #define SELECT_EPOLL_UNREGISTER_METHODDEF
 #endif /* !defined(SELECT_EPOLL_UNREGISTER_METHODDEF) */
 
+#ifndef SELECT_EPOLL_REGISTER_MANY_METHODDEF
+    #define SELECT_EPOLL_REGISTER_MANY_METHODDEF
+#endif /* !defined(SELECT_EPOLL_REGISTER_MANY_METHODDEF) */
+
+#ifndef SELECT_EPOLL_MODIFY_MANY_METHODDEF
+    #define SELECT_EPOLL_MODIFY_MANY_METHODDEF
+#endif /* !defined(SELECT_EPOLL_MODIFY_MANY_METHODDEF) */
+
 #ifndef SELECT_EPOLL_POLL_METHODDEF
     #define SELECT_EPOLL_POLL_METHODDEF
 #endif /* !defined(SELECT_EPOLL_POLL_METHODDEF) */
 
+#ifndef SELECT_EPOLL_POLL_INTO_METHODDEF
+    #define SELECT_EPOLL_POLL_INTO_METHODDEF
+#endif /* !defined(SELECT_EPOLL_POLL_INTO_METHODDEF) */
+
 #ifndef SELECT_EPOLL___ENTER___METHODDEF
     #define SELECT_EPOLL___ENTER___METHODDEF
 #endif /* !defined(SELECT_EPOLL___ENTER___METHODDEF) */
@@ -1360,4 +1487,4 @@ exit:
 #ifndef SELECT_KQUEUE_CONTROL_METHODDEF
     #define SELECT_KQUEUE_CONTROL_METHODDEF
 #endif /* !defined(SELECT_KQUEUE_CONTROL_METHODDEF) */
-/*[clinic end generated code: output=f99427b75cbe6d44 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=845f2d25bdb86163 input=a9049054013a1b77]*/
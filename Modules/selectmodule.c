@@ -15,6 +15,7 @@
 #include "Python.h"
 #include "pycore_fileutils.h"     // _Py_set_inheritable()
 #include "pycore_import.h"        // _PyImport_GetModuleAttrString()
+#include "pycore_modsupport.h"    // _PyArg_BadArgument()
 #include "pycore_time.h"          // _PyTime_FromSecondsObject()
 
 #include <stdbool.h>
@@ -1547,33 +1548,132 @@ select_epoll_unregister_impl(pyEpoll_Object *self, int fd)
     return pyepoll_internal_ctl(self->epfd, EPOLL_CTL_DEL, fd, 0);
 }
 
+/* Apply the (fd, eventmask) pairs of items with epoll_ctl(), releasing the
+   GIL once for the whole batch.  The operations are applied in order and
+   the first failure stops the batch. */
+static PyObject *
+pyepoll_internal_ctl_many(int epfd, int op, PyObject *items)
+{
+    PyObject *seq, *result = NULL;
+    struct epoll_event *evs = NULL;
+    Py_ssize_t i, n, done = 0;
+    int save_errno = 0;
+
+    if (epfd < 0)
+        return pyepoll_err_closed();
+
+    seq = PySequence_Fast(items, "items must be an iterable of "
+                                 "(fd, eventmask) pairs");
+    if (seq == NULL) {
+        return NULL;
+    }
+    n = PySequence_Fast_GET_SIZE(seq);
+    evs = PyMem_New(struct epoll_event, n ? n : 1);
+    if (evs == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    for (i = 0; i < n; i++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(seq, i);
+        PyObject *fdobj, *maskobj;
+        unsigned long mask;
+        int fd;
+
+        if (!PyTuple_Check(item) || PyTuple_GET_SIZE(item) != 2) {
+            PyErr_Format(PyExc_TypeError,
+                         "items must be (fd, eventmask) pairs, not %T", item);
+            goto finally;
+        }
+        fdobj = PyTuple_GET_ITEM(item, 0);
+        maskobj = PyTuple_GET_ITEM(item, 1);
+        fd = PyObject_AsFileDescriptor(fdobj);
+        if (fd < 0) {
+            goto finally;
+        }
+        if (!PyIndex_Check(maskobj)) {
+            PyErr_Format(PyExc_TypeError,
+                         "eventmask must be an integer, not %T", maskobj);
+            goto finally;
+        }
+        mask = PyLong_AsUnsignedLongMask(maskobj);
+        if (mask == (unsigned long)-1 && PyErr_Occurred()) {
+            goto finally;
+        }
+        evs[i].events = (unsigned int)mask;
+        evs[i].data.fd = fd;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    for (; done < n; done++) {
+        if (epoll_ctl(epfd, op, evs[done].data.fd, &evs[done]) < 0) {
+            save_errno = errno;
+            break;
+        }
+    }
+    Py_END_ALLOW_THREADS
+
+    if (done < n) {
+        errno = save_errno;
+        PyErr_SetFromErrno(PyExc_OSError);
+        goto finally;
+    }
+    result = Py_NewRef(Py_None);
+
+finally:
+    PyMem_Free(evs);
+    Py_DECREF(seq);
+    return result;
+}
+
 /*[clinic input]
-select.epoll.poll
+select.epoll.register_many
 
-    timeout as timeout_obj: object = None
-      the maximum time to wait in seconds (as float);
-      a timeout of None or -1 makes poll wait indefinitely
-    maxevents: int = -1
-      the maximum number of events returned; -1 means no limit
+    items: object
+      an iterable of (fd, eventmask) pairs
+    /
 
-Wait for events on the epoll file descriptor.
+Register several file descriptors with a single call.
 
-Returns a list containing any descriptors that have events to report,
-as a list of (fd, events) 2-tuples.
+The file descriptors are registered in order.  If one of them cannot be
+registered, OSError is raised and the file descriptors before it stay
+registered.
 [clinic start generated code]*/
 
 static PyObject *
-select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
-                       int maxevents)
-/*[clinic end generated code: output=e02d121a20246c6c input=33d34a5ea430fd5b]*/
+select_epoll_register_many(pyEpoll_Object *self, PyObject *items)
+/*[clinic end generated code: output=9d8394895640d912 input=826547f26d3bcc09]*/
 {
-    int nfds, i;
-    PyObject *elist = NULL, *etuple = NULL;
-    struct epoll_event *evs = NULL;
-    PyTime_t timeout = -1, ms = -1, deadline = 0;
+    return pyepoll_internal_ctl_many(self->epfd, EPOLL_CTL_ADD, items);
+}
 
-    if (self->epfd < 0)
-        return pyepoll_err_closed();
+/*[clinic input]
+select.epoll.modify_many
+
+    items: object
+      an iterable of (fd, eventmask) pairs
+    /
+
+Modify the event masks of several registered file descriptors.
+
+The file descriptors are modified in order.  If one of them cannot be
+modified, OSError is raised and the changes before it stay applied.
+[clinic start generated code]*/
+
+static PyObject *
+select_epoll_modify_many(pyEpoll_Object *self, PyObject *items)
+/*[clinic end generated code: output=5521f6daae8a3088 input=fc2a505ec12a50fc]*/
+{
+    return pyepoll_internal_ctl_many(self->epfd, EPOLL_CTL_MOD, items);
+}
+
+/* Wait for events with epoll_wait(), retrying on EINTR with a recomputed
+   timeout.  Return the number of events, or -1 with an exception set. */
+static int
+pyepoll_internal_wait(pyEpoll_Object *self, PyObject *timeout_obj,
+                      struct epoll_event *evs, int maxevents)
+{
+    int nfds;
+    PyTime_t timeout = -1, ms = -1, deadline = 0;
 
     if (timeout_obj != Py_None) {
         /* epoll_wait() has a resolution of 1 millisecond, round towards
@@ -1584,13 +1684,13 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
                 PyErr_SetString(PyExc_TypeError,
                                 "timeout must be an integer or None");
             }
-            return NULL;
+            return -1;
         }
 
         ms = _PyTime_AsMilliseconds(timeout, _PyTime_ROUND_CEILING);
         if (ms < INT_MIN || ms > INT_MAX) {
             PyErr_SetString(PyExc_OverflowError, "timeout is too large");
-            return NULL;
+            return -1;
         }
         /* epoll_wait(2) treats all arbitrary negative numbers the same
            for the timeout argument, but -1 is the documented way to block
@@ -1608,22 +1708,6 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
         }
     }
 
-    if (maxevents == -1) {
-        maxevents = FD_SETSIZE-1;
-    }
-    else if (maxevents < 1) {
-        PyErr_Format(PyExc_ValueError,
-                     "maxevents must be greater than 0, got %d",
-                     maxevents);
-        return NULL;
-    }
-
-    evs = PyMem_New(struct epoll_event, maxevents);
-    if (evs == NULL) {
-        PyErr_NoMemory();
-        return NULL;
-    }
-
     do {
         Py_BEGIN_ALLOW_THREADS
         errno = 0;
@@ -1635,7 +1719,7 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
 
         /* poll() was interrupted by a signal */
         if (PyErr_CheckSignals())
-            goto error;
+            return -1;
 
         if (timeout >= 0) {
             timeout = _PyDeadline_Get(deadline);
@@ -1650,6 +1734,56 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
 
     if (nfds < 0) {
         PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    return nfds;
+}
+
+/*[clinic input]
+select.epoll.poll
+
+    timeout as timeout_obj: object = None
+      the maximum time to wait in seconds (as float);
+      a timeout of None or -1 makes poll wait indefinitely
+    maxevents: int = -1
+      the maximum number of events returned; -1 means no limit
+
+Wait for events on the epoll file descriptor.
+
+Returns a list containing any descriptors that have events to report,
+as a list of (fd, events) 2-tuples.
+[clinic start generated code]*/
+
+static PyObject *
+select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
+                       int maxevents)
+/*[clinic end generated code: output=e02d121a20246c6c input=33d34a5ea430fd5b]*/
+{
+    int nfds, i;
+    PyObject *elist = NULL, *etuple = NULL;
+    struct epoll_event *evs = NULL;
+
+    if (self->epfd < 0)
+        return pyepoll_err_closed();
+
+    if (maxevents == -1) {
+        maxevents = FD_SETSIZE-1;
+    }
+    else if (maxevents < 1) {
+        PyErr_Format(PyExc_ValueError,
+                     "maxevents must be greater than 0, got %d",
+                     maxevents);
+        return NULL;
+    }
+
+    evs = PyMem_New(struct epoll_event, maxevents);
+    if (evs == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+
+    nfds = pyepoll_internal_wait(self, timeout_obj, evs, maxevents);
+    if (nfds < 0) {
         goto error;
     }
 
@@ -1673,6 +1807,94 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
 }
 
 
+/* Number of events poll_into() can read without allocating memory */
+#define EPOLL_STACK_EVENTS 256
+
+/*[clinic input]
+select.epoll.poll_into
+
+    buffer as buffer_obj: object
+      a writable buffer of C unsigned ints, such as array.array('I')
+    timeout as timeout_obj: object = None
+      the maximum time to wait in seconds (as float);
+      a timeout of None or -1 makes poll_into wait indefinitely
+
+Wait for events on the epoll file descriptor and store them into buffer.
+
+Events are stored as consecutive pairs of file descriptor and event mask;
+the buffer size limits the number of events.  Returns the number of events.
+[clinic start generated code]*/
+
+static PyObject *
+select_epoll_poll_into_impl(pyEpoll_Object *self, PyObject *buffer_obj,
+                            PyObject *timeout_obj)
+/*[clinic end generated code: output=bbf6a3e3e3023c56 input=4af44bb352471f21]*/
+{
+    int nfds, i;
+    struct epoll_event stack_evs[EPOLL_STACK_EVENTS];
+    struct epoll_event *evs = stack_evs;
+    Py_buffer buffer;
+    unsigned int *out;
+    Py_ssize_t maxevents;
+
+    if (self->epfd < 0)
+        return pyepoll_err_closed();
+
+    if (PyObject_GetBuffer(buffer_obj, &buffer,
+                           PyBUF_CONTIG | PyBUF_FORMAT) < 0) {
+        PyErr_Clear();
+        _PyArg_BadArgument("poll_into", "argument 'buffer'",
+                           "contiguous read-write buffer", buffer_obj);
+        return NULL;
+    }
+    /* Other item types would be misparsed: require C unsigned ints */
+    const char *format = buffer.format;
+    if (format[0] == '@') {
+        format++;
+    }
+    if (strcmp(format, "I") != 0 || buffer.itemsize != sizeof(unsigned int)) {
+        PyErr_Format(PyExc_TypeError,
+                     "buffer must contain C unsigned ints (format 'I'), "
+                     "not format '%s'", buffer.format);
+        PyBuffer_Release(&buffer);
+        return NULL;
+    }
+    out = (unsigned int *)buffer.buf;
+    maxevents = buffer.len / (2 * (Py_ssize_t)sizeof(unsigned int));
+    if (maxevents < 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "buffer is too small to store an event");
+        PyBuffer_Release(&buffer);
+        return NULL;
+    }
+    if (maxevents > EPOLL_STACK_EVENTS) {
+        if (maxevents > INT_MAX) {
+            maxevents = INT_MAX;
+        }
+        evs = PyMem_New(struct epoll_event, maxevents);
+        if (evs == NULL) {
+            PyBuffer_Release(&buffer);
+            return PyErr_NoMemory();
+        }
+    }
+
+    nfds = pyepoll_internal_wait(self, timeout_obj, evs, (int)maxevents);
+    for (i = 0; i < nfds; i++) {
+        out[2 * i] = (unsigned int)evs[i].data.fd;
+        out[2 * i + 1] = evs[i].events;
+    }
+
+    if (evs != stack_evs) {
+        PyMem_Free(evs);
+    }
+    PyBuffer_Release(&buffer);
+    if (nfds < 0) {
+        return NULL;
+    }
+    return PyLong_FromLong(nfds);
+}
+
+
 /*[clinic input]
 select.epoll.__enter__
 
@@ -2477,6 +2699,9 @@ static PyMethodDef pyepoll_methods[] = {
     SELECT_EPOLL_REGISTER_METHODDEF
     SELECT_EPOLL_UNREGISTER_METHODDEF
     SELECT_EPOLL_POLL_METHODDEF
+    SELECT_EPOLL_POLL_INTO_METHODDEF
+    SELECT_EPOLL_REGISTER_MANY_METHODDEF
+    SELECT_EPOLL_MODIFY_MANY_METHODDEF
     SELECT_EPOLL___ENTER___METHODDEF
     SELECT_EPOLL___EXIT___METHODDEF
     {NULL,      NULL},
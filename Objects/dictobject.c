@@ -47,6 +47,21 @@ PyDictUnicodeEntry otherwise. Its length is USABLE_FRACTION(dk_size).
 NOTE: Since negative value is used for DKIX_EMPTY and DKIX_DUMMY, type of
 dk_indices entry is signed integer and int16 is used for table which
 dk_size == 256.
+
+Large tables (dk_log2_size >= DK_CTRL_MIN_LOG2_SIZE) are followed by one more
+array, dk_ctrl[dk_size], with a control byte per slot of dk_indices, in the
+style of "Swiss tables":
+
++---------------------+
+| dk_ctrl[]           |
++---------------------+
+
+A control byte is DK_CTRL_EMPTY, DK_CTRL_DUMMY, or a 7-bit tag taken from the
+hash of the key stored in the slot.  These tables are probed a group of
+DK_CTRL_GROUP control bytes at a time (with SSE2 or NEON where available),
+and only slots whose tag matches are looked at in dk_indices and dk_entries.
+See "Control bytes" below for the probe sequence.  Entries and insertion
+order are unaffected.
 */
 
 
@@ -132,6 +147,11 @@ As a consequence of this, split keys have a maximum size of 16.
 #include "stringlib/eq.h"                // unicode_eq()
 
 #include <stdbool.h>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>               // _mm_cmpeq_epi8()
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#  include <arm_neon.h>                // vceqq_u8()
+#endif
 
 /*[clinic input]
 class dict "PyDictObject *" "&PyDict_Type"
@@ -379,6 +399,7 @@ equally good collision statistics, needed less code & used less memory.
 
 static int dictresize(PyInterpreterState *interp, PyDictObject *mp,
                       uint8_t log_newsize, int unicode);
+static int dict_make_perfect(PyInterpreterState *interp, PyDictObject *mp);
 
 static PyObject* dict_iter(PyObject *dict);
 
@@ -574,6 +595,186 @@ estimate_log2_keysize(Py_ssize_t n)
 }
 
 
+/* Control bytes
+
+Above a few tens of thousands of entries, most of a lookup is spent on cache
+misses: one in dk_indices, and one in dk_entries for every slot whose key has
+to be compared.  For those tables a control byte per slot records whether the
+slot is empty, a dummy, or which 7-bit tag the hash of its key has, so that a
+single 16-byte load rules out whole groups of slots.
+
+The probe sequence differs from the perturbation scheme above, since it has
+to visit groups: the hash is scrambled by a Fibonacci multiplication, its top
+dk_log2_size bits select the first group (rounded down to DK_CTRL_GROUP), and
+the next 7 bits are the tag.  Groups are then visited in triangular order,
+which covers every group of a power-of-2 sized table.  As with the per-slot
+scheme, dummies are never turned back into empty slots, so a lookup can stop
+at the first group containing an empty slot.
+
+Free-threaded builds do not use control bytes: their lookups run without the
+dict lock and only read dk_indices atomically.
+*/
+#ifdef Py_GIL_DISABLED
+#  define DK_CTRL_MIN_LOG2_SIZE 255
+#else
+#  define DK_CTRL_MIN_LOG2_SIZE 16
+#endif
+#define DK_IS_PERFECT(dk) ((dk)->dk_log2_seeds != 0)  // see below
+#define DK_HAS_CTRL(dk) \
+    (DK_LOG_SIZE(dk) >= DK_CTRL_MIN_LOG2_SIZE && !DK_IS_PERFECT(dk))
+#define DK_CTRL_GROUP 16
+#define DK_CTRL_EMPTY 0x80
+#define DK_CTRL_DUMMY 0xfe
+#if SIZEOF_SIZE_T == 8
+#  define DK_MIX_MULTIPLIER ((size_t)0x9E3779B97F4A7C15ULL)
+#else
+#  define DK_MIX_MULTIPLIER ((size_t)0x9E3779B9UL)
+#endif
+#define DK_MIX_BITS (8 * SIZEOF_SIZE_T)
+
+static inline uint8_t *
+dk_ctrl(PyDictKeysObject *dk)
+{
+    assert(DK_HAS_CTRL(dk));
+    size_t es = DK_IS_UNICODE(dk) ? sizeof(PyDictUnicodeEntry)
+                                  : sizeof(PyDictKeyEntry);
+    return (uint8_t *)_DK_ENTRIES(dk) + USABLE_FRACTION((size_t)DK_SIZE(dk)) * es;
+}
+
+static inline size_t
+dk_ctrl_first_group(PyDictKeysObject *dk, Py_hash_t hash)
+{
+    size_t h = (size_t)hash * DK_MIX_MULTIPLIER;
+    return (h >> (DK_MIX_BITS - DK_LOG_SIZE(dk))) & ~(size_t)(DK_CTRL_GROUP - 1);
+}
+
+static inline uint8_t
+dk_ctrl_tag(PyDictKeysObject *dk, Py_hash_t hash)
+{
+    size_t h = (size_t)hash * DK_MIX_MULTIPLIER;
+    int log2_size = DK_LOG_SIZE(dk);
+    if (log2_size + 7 <= DK_MIX_BITS) {
+        h >>= DK_MIX_BITS - log2_size - 7;
+    }
+    return (uint8_t)(h & 0x7f);
+}
+
+/* Bit k of the result is set if group[k] == byte. */
+static inline uint32_t
+dk_ctrl_match(const uint8_t *group, uint8_t byte)
+{
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)byte)));
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    static const uint8_t weights[DK_CTRL_GROUP] = {
+        1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128
+    };
+    uint8x16_t eq = vceqq_u8(vld1q_u8(group), vdupq_n_u8(byte));
+    uint8x16_t bits = vandq_u8(eq, vld1q_u8(weights));
+    return (uint32_t)vaddv_u8(vget_low_u8(bits)) |
+           ((uint32_t)vaddv_u8(vget_high_u8(bits)) << 8);
+#else
+    uint32_t bits = 0;
+    for (int k = 0; k < DK_CTRL_GROUP; k++) {
+        bits |= (uint32_t)(group[k] == byte) << k;
+    }
+    return bits;
+#endif
+}
+
+/* Bit k of the result is set if slot k of the group is empty or a dummy. */
+static inline uint32_t
+dk_ctrl_match_free(const uint8_t *group)
+{
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+#else
+    return dk_ctrl_match(group, DK_CTRL_EMPTY) | dk_ctrl_match(group, DK_CTRL_DUMMY);
+#endif
+}
+
+static inline int
+dk_ctrl_lowest_bit(uint32_t bits)
+{
+    assert(bits != 0);
+#if defined(__clang__) || defined(__GNUC__)
+    return __builtin_ctz(bits);
+#else
+    int k = 0;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        k++;
+    }
+    return k;
+#endif
+}
+
+/* Perfect-hash keys
+
+dict_make_perfect() rebuilds the keys of a dict that is not expected to grow,
+such as a frozendict, so that no two keys share a slot.  The keys are split
+into buckets by hash, and each bucket gets a 16-bit seed such that
+dk_perfect_slot() sends all of its keys to distinct free slots ("hash and
+displace").  A lookup then reads a single slot of dk_indices and compares at
+most one entry.
+
+The seeds follow dk_entries, in place of control bytes.  Perfect-hash keys
+have no usable entries left, so adding a key resizes the dict back to an
+ordinary table.  Deleting a key leaves a dummy, which lookups treat like an
+empty slot.
+*/
+#define DK_PERFECT_MAX_SEED 0xffff
+#define DK_PERFECT_MAX_BUCKET 64
+#if SIZEOF_SIZE_T == 8
+#  define DK_PERFECT_SEED_MULTIPLIER ((size_t)0xC2B2AE3D27D4EB4FULL)
+#else
+#  define DK_PERFECT_SEED_MULTIPLIER ((size_t)0x27D4EB2FUL)
+#endif
+
+static inline uint16_t *
+dk_perfect_seeds(PyDictKeysObject *dk)
+{
+    assert(DK_IS_PERFECT(dk));
+    size_t es = DK_IS_UNICODE(dk) ? sizeof(PyDictUnicodeEntry)
+                                  : sizeof(PyDictKeyEntry);
+    return (uint16_t *)((char *)_DK_ENTRIES(dk)
+                        + USABLE_FRACTION((size_t)DK_SIZE(dk)) * es);
+}
+
+static inline size_t
+dk_perfect_bucket(Py_hash_t hash, uint8_t log2_seeds)
+{
+    size_t h = (size_t)hash * DK_MIX_MULTIPLIER;
+    return (h >> (DK_MIX_BITS / 2)) & (((size_t)1 << log2_seeds) - 1);
+}
+
+static inline size_t
+dk_perfect_slot_seeded(Py_hash_t hash, size_t seed, uint8_t log2_size)
+{
+    size_t h = ((size_t)hash ^ (seed * DK_PERFECT_SEED_MULTIPLIER)) * DK_MIX_MULTIPLIER;
+    return h >> (DK_MIX_BITS - log2_size);
+}
+
+static inline size_t
+dk_perfect_slot(PyDictKeysObject *dk, Py_hash_t hash)
+{
+    size_t b = dk_perfect_bucket(hash, dk->dk_log2_seeds);
+    return dk_perfect_slot_seeded(hash, dk_perfect_seeds(dk)[b], DK_LOG_SIZE(dk));
+}
+
+/* Write to indices and, for large tables, to the control bytes. */
+static inline void
+dictkeys_set_index_hash(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix,
+                        Py_hash_t hash)
+{
+    dictkeys_set_index(keys, i, ix);
+    if (DK_HAS_CTRL(keys)) {
+        assert(ix != DKIX_EMPTY);
+        dk_ctrl(keys)[i] = ix == DKIX_DUMMY ? DK_CTRL_DUMMY : dk_ctrl_tag(keys, hash);
+    }
+}
+
 /* GROWTH_RATE. Growth rate upon hitting maximum load.
  * Currently set to used*3.
  * This means that dicts double in size when growing without deletions,
@@ -594,6 +795,7 @@ static PyDictKeysObject empty_keys_struct = {
         0, /* dk_log2_size */
         0, /* dk_log2_index_bytes */
         DICT_KEYS_UNICODE, /* dk_kind */
+        0, /* dk_log2_seeds */
 #ifdef Py_GIL_DISABLED
         {0}, /* dk_mutex */
 #endif
@@ -686,6 +888,11 @@ _PyDict_CheckConsistency(PyObject *op, int check_content)
         for (Py_ssize_t i=0; i < DK_SIZE(keys); i++) {
             Py_ssize_t ix = dictkeys_get_index(keys, i);
             CHECK(DKIX_DUMMY <= ix && ix <= usable);
+            if (DK_HAS_CTRL(keys)) {
+                uint8_t c = dk_ctrl(keys)[i];
+                CHECK(ix == DKIX_EMPTY ? c == DK_CTRL_EMPTY :
+                      ix == DKIX_DUMMY ? c == DK_CTRL_DUMMY : c < 0x80);
+            }
         }
 
         if (keys->dk_kind == DICT_KEYS_GENERAL) {
@@ -747,7 +954,8 @@ _PyDict_CheckConsistency(PyObject *op, int check_content)
 
 
 static PyDictKeysObject*
-new_keys_object(PyInterpreterState *interp, uint8_t log2_size, bool unicode)
+new_keys_object_ex(PyInterpreterState *interp, uint8_t log2_size, bool unicode,
+                   uint8_t log2_seeds)
 {
     Py_ssize_t usable;
     int log2_bytes;
@@ -771,14 +979,23 @@ new_keys_object(PyInterpreterState *interp, uint8_t log2_size, bool unicode)
         log2_bytes = log2_size + 2;
     }
 
+    size_t ctrl_size = 0, seeds_size = 0;
+    if (log2_seeds) {
+        seeds_size = sizeof(uint16_t) << log2_seeds;
+    }
+    else if (log2_size >= DK_CTRL_MIN_LOG2_SIZE) {
+        ctrl_size = (size_t)1 << log2_size;
+    }
+
     PyDictKeysObject *dk = NULL;
-    if (log2_size == PyDict_LOG_MINSIZE && unicode) {
+    if (log2_size == PyDict_LOG_MINSIZE && unicode && !log2_seeds) {
         dk = _Py_FREELIST_POP_MEM(dictkeys);
     }
     if (dk == NULL) {
         dk = PyMem_Malloc(sizeof(PyDictKeysObject)
                           + ((size_t)1 << log2_bytes)
-                          + entry_size * usable);
+                          + entry_size * usable
+                          + ctrl_size + seeds_size);
         if (dk == NULL) {
             PyErr_NoMemory();
             return NULL;
@@ -791,6 +1008,7 @@ new_keys_object(PyInterpreterState *interp, uint8_t log2_size, bool unicode)
     dk->dk_log2_size = log2_size;
     dk->dk_log2_index_bytes = log2_bytes;
     dk->dk_kind = unicode ? DICT_KEYS_UNICODE : DICT_KEYS_GENERAL;
+    dk->dk_log2_seeds = log2_seeds;
 #ifdef Py_GIL_DISABLED
     dk->dk_mutex = (PyMutex){0};
 #endif
@@ -799,15 +1017,27 @@ new_keys_object(PyInterpreterState *interp, uint8_t log2_size, bool unicode)
     dk->dk_version = 0;
     memset(&dk->dk_indices[0], 0xff, ((size_t)1 << log2_bytes));
     memset(&dk->dk_indices[(size_t)1 << log2_bytes], 0, entry_size * usable);
+    if (ctrl_size) {
+        memset(dk_ctrl(dk), DK_CTRL_EMPTY, ctrl_size);
+    }
+    if (seeds_size) {
+        memset(dk_perfect_seeds(dk), 0, seeds_size);
+    }
     return dk;
 }
 
+static PyDictKeysObject*
+new_keys_object(PyInterpreterState *interp, uint8_t log2_size, bool unicode)
+{
+    return new_keys_object_ex(interp, log2_size, unicode, 0);
+}
+
 static void
 free_keys_object(PyDictKeysObject *keys, bool use_qsbr)
 {
 #ifdef Py_GIL_DISABLED
     if (use_qsbr) {
-        _PyMem_FreeDelayed(keys);
+        _PyMem_FreeDelayed(keys, _PyDict_KeysSize(keys));
         return;
     }
 #endif
@@ -852,7 +1082,7 @@ free_values(PyDictValues *values, bool use_qsbr)
     assert(values->embedded == 0);
 #ifdef Py_GIL_DISABLED
     if (use_qsbr) {
-        _PyMem_FreeDelayed(values);
+        _PyMem_FreeDelayed(values, values_size_from_count(values->capacity));
         return;
     }
 #endif
@@ -970,9 +1200,40 @@ PyDict_New(void)
 }
 
 /* Search index of hash table from offset of entry table */
+static Py_ssize_t
+lookdict_index_ctrl(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
+{
+    const uint8_t *ctrl = dk_ctrl(k);
+    size_t mask = DK_MASK(k);
+    uint8_t tag = dk_ctrl_tag(k, hash);
+    size_t g = dk_ctrl_first_group(k, hash);
+    for (size_t step = DK_CTRL_GROUP;; step += DK_CTRL_GROUP) {
+        uint32_t bits = dk_ctrl_match(&ctrl[g], tag);
+        while (bits) {
+            size_t i = g + dk_ctrl_lowest_bit(bits);
+            if (dictkeys_get_index(k, i) == index) {
+                return i;
+            }
+            bits &= bits - 1;
+        }
+        if (dk_ctrl_match(&ctrl[g], DK_CTRL_EMPTY)) {
+            return DKIX_EMPTY;
+        }
+        g = (g + step) & mask;
+    }
+    Py_UNREACHABLE();
+}
+
 static Py_ssize_t
 lookdict_index(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
 {
+    if (DK_HAS_CTRL(k)) {
+        return lookdict_index_ctrl(k, hash, index);
+    }
+    if (DK_IS_PERFECT(k)) {
+        size_t i = dk_perfect_slot(k, hash);
+        return dictkeys_get_index(k, i) == index ? (Py_ssize_t)i : DKIX_EMPTY;
+    }
     size_t mask = DK_MASK(k);
     size_t perturb = (size_t)hash;
     size_t i = (size_t)hash & mask;
@@ -991,11 +1252,60 @@ lookdict_index(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
     Py_UNREACHABLE();
 }
 
+static inline Py_ALWAYS_INLINE Py_ssize_t
+do_lookup_ctrl(PyDictObject *mp, PyDictKeysObject *dk, PyObject *key, Py_hash_t hash,
+               int (*check_lookup)(PyDictObject *, PyDictKeysObject *, void *, Py_ssize_t ix, PyObject *key, Py_hash_t))
+{
+    void *ep0 = _DK_ENTRIES(dk);
+    const uint8_t *ctrl = dk_ctrl(dk);
+    size_t mask = DK_MASK(dk);
+    uint8_t tag = dk_ctrl_tag(dk, hash);
+    size_t g = dk_ctrl_first_group(dk, hash);
+    for (size_t step = DK_CTRL_GROUP;; step += DK_CTRL_GROUP) {
+        uint32_t bits = dk_ctrl_match(&ctrl[g], tag);
+        while (bits) {
+            Py_ssize_t ix = dictkeys_get_index(dk, g + dk_ctrl_lowest_bit(bits));
+            bits &= bits - 1;
+            /* A comparison can run __eq__, which may delete another key
+               of this group and turn its slot into a dummy. */
+            if (ix < 0) {
+                continue;
+            }
+            int cmp = check_lookup(mp, dk, ep0, ix, key, hash);
+            if (cmp < 0) {
+                return cmp;
+            } else if (cmp) {
+                return ix;
+            }
+        }
+        if (dk_ctrl_match(&ctrl[g], DK_CTRL_EMPTY)) {
+            return DKIX_EMPTY;
+        }
+        g = (g + step) & mask;
+    }
+    Py_UNREACHABLE();
+}
+
 static inline Py_ALWAYS_INLINE Py_ssize_t
 do_lookup(PyDictObject *mp, PyDictKeysObject *dk, PyObject *key, Py_hash_t hash,
           int (*check_lookup)(PyDictObject *, PyDictKeysObject *, void *, Py_ssize_t ix, PyObject *key, Py_hash_t))
 {
+    if (DK_HAS_CTRL(dk)) {
+        return do_lookup_ctrl(mp, dk, key, hash, check_lookup);
+    }
     void *ep0 = _DK_ENTRIES(dk);
+    if (DK_IS_PERFECT(dk)) {
+        Py_ssize_t ix = dictkeys_get_index(dk, dk_perfect_slot(dk, hash));
+        if (ix >= 0) {
+            int cmp = check_lookup(mp, dk, ep0, ix, key, hash);
+            if (cmp < 0) {
+                return cmp;
+            } else if (cmp) {
+                return ix;
+            }
+        }
+        return DKIX_EMPTY;
+    }
     size_t mask = DK_MASK(dk);
     size_t perturb = hash;
     size_t i = (size_t)hash & mask;
@@ -1654,6 +1964,24 @@ find_empty_slot(PyDictKeysObject *keys, Py_hash_t hash)
 {
     assert(keys != NULL);
 
+    if (DK_IS_PERFECT(keys)) {
+        // Only reached while building the indices of new keys.
+        size_t i = dk_perfect_slot(keys, hash);
+        assert(dictkeys_get_index(keys, i) == DKIX_EMPTY);
+        return i;
+    }
+    if (DK_HAS_CTRL(keys)) {
+        const uint8_t *ctrl = dk_ctrl(keys);
+        const size_t mask = DK_MASK(keys);
+        size_t g = dk_ctrl_first_group(keys, hash);
+        for (size_t step = DK_CTRL_GROUP;; step += DK_CTRL_GROUP) {
+            uint32_t bits = dk_ctrl_match_free(&ctrl[g]);
+            if (bits) {
+                return g + dk_ctrl_lowest_bit(bits);
+            }
+            g = (g + step) & mask;
+        }
+    }
     const size_t mask = DK_MASK(keys);
     size_t i = hash & mask;
     Py_ssize_t ix = dictkeys_get_index(keys, i);
@@ -1686,7 +2014,7 @@ insert_combined_dict(PyInterpreterState *interp, PyDictObject *mp,
     mp->ma_keys->dk_version = 0;
 
     Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
-    dictkeys_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
+    dictkeys_set_index_hash(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries, hash);
 
     if (DK_IS_UNICODE(mp->ma_keys)) {
         PyDictUnicodeEntry *ep;
@@ -1728,7 +2056,7 @@ insert_split_key(PyDictKeysObject *keys, PyObject *key, Py_hash_t hash)
         keys->dk_version = 0;
         Py_ssize_t hashpos = find_empty_slot(keys, hash);
         ix = keys->dk_nentries;
-        dictkeys_set_index(keys, hashpos, ix);
+        dictkeys_set_index_hash(keys, hashpos, ix, hash);
         PyDictUnicodeEntry *ep = &DK_UNICODE_ENTRIES(keys)[ix];
         STORE_SHARED_KEY(ep->me_key, Py_NewRef(key));
         split_keys_entry_added(keys);
@@ -1761,6 +2089,22 @@ insert_split_value(PyInterpreterState *interp, PyDictObject *mp, PyObject *key,
     ASSERT_CONSISTENT(mp);
 }
 
+/* Fail with TypeError if mp is a frozendict that has been fully built.
+   Exact dicts are checked first so that they pay for a single compare. */
+static inline int
+dict_check_mutable(PyDictObject *mp)
+{
+    if (PyDict_CheckExact(mp)
+        || !PyObject_TypeCheck(mp, &_PyFrozenDict_Type)
+        || !((_PyFrozenDictObject *)mp)->fd_frozen)
+    {
+        return 0;
+    }
+    PyErr_Format(PyExc_TypeError, "'%s' object is immutable",
+                 _PyType_Name(Py_TYPE(mp)));
+    return -1;
+}
+
 /*
 Internal routine to insert a new item into the table.
 Used both by the internal resize routine and by the public insert routine.
@@ -1775,6 +2119,10 @@ insertdict(PyInterpreterState *interp, PyDictObject *mp,
 
     ASSERT_DICT_LOCKED(mp);
 
+    if (dict_check_mutable(mp) < 0) {
+        goto Fail;
+    }
+
     if (DK_IS_UNICODE(mp->ma_keys) && !PyUnicode_CheckExact(key)) {
         if (insertion_resize(interp, mp, 0) < 0)
             goto Fail;
@@ -1847,6 +2195,12 @@ insert_to_emptydict(PyInterpreterState *interp, PyDictObject *mp,
     assert(mp->ma_keys == Py_EMPTY_KEYS);
     ASSERT_DICT_LOCKED(mp);
 
+    if (dict_check_mutable(mp) < 0) {
+        Py_DECREF(key);
+        Py_DECREF(value);
+        return -1;
+    }
+
     int unicode = PyUnicode_CheckExact(key);
     PyDictKeysObject *newkeys = new_keys_object(
             interp, PyDict_LOG_MINSIZE, unicode);
@@ -1893,6 +2247,13 @@ Internal routine used by dictresize() to build a hashtable of entries.
 static void
 build_indices_generic(PyDictKeysObject *keys, PyDictKeyEntry *ep, Py_ssize_t n)
 {
+    if (DK_HAS_CTRL(keys) || DK_IS_PERFECT(keys)) {
+        for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
+            Py_ssize_t i = find_empty_slot(keys, ep->me_hash);
+            dictkeys_set_index_hash(keys, i, ix, ep->me_hash);
+        }
+        return;
+    }
     size_t mask = DK_MASK(keys);
     for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
         Py_hash_t hash = ep->me_hash;
@@ -1908,6 +2269,15 @@ build_indices_generic(PyDictKeysObject *keys, PyDictKeyEntry *ep, Py_ssize_t n)
 static void
 build_indices_unicode(PyDictKeysObject *keys, PyDictUnicodeEntry *ep, Py_ssize_t n)
 {
+    if (DK_HAS_CTRL(keys) || DK_IS_PERFECT(keys)) {
+        for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
+            Py_hash_t hash = unicode_get_hash(ep->me_key);
+            assert(hash != -1);
+            Py_ssize_t i = find_empty_slot(keys, hash);
+            dictkeys_set_index_hash(keys, i, ix, hash);
+        }
+        return;
+    }
     size_t mask = DK_MASK(keys);
     for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
         Py_hash_t hash = unicode_get_hash(ep->me_key);
@@ -1936,8 +2306,9 @@ This function supports:
  - Generic -> Generic
 */
 static int
-dictresize(PyInterpreterState *interp, PyDictObject *mp,
-           uint8_t log2_newsize, int unicode)
+dictresize_ex(PyInterpreterState *interp, PyDictObject *mp,
+              uint8_t log2_newsize, int unicode,
+              uint8_t log2_seeds, const uint16_t *seeds)
 {
     PyDictKeysObject *oldkeys, *newkeys;
     PyDictValues *oldvalues;
@@ -1964,10 +2335,13 @@ dictresize(PyInterpreterState *interp, PyDictObject *mp,
      */
 
     /* Allocate a new table. */
-    newkeys = new_keys_object(interp, log2_newsize, unicode);
+    newkeys = new_keys_object_ex(interp, log2_newsize, unicode, log2_seeds);
     if (newkeys == NULL) {
         return -1;
     }
+    if (log2_seeds) {
+        memcpy(dk_perfect_seeds(newkeys), seeds, sizeof(uint16_t) << log2_seeds);
+    }
     // New table must be large enough.
     assert(newkeys->dk_usable >= mp->ma_used);
 
@@ -2081,12 +2455,182 @@ dictresize(PyInterpreterState *interp, PyDictObject *mp,
         }
     }
 
-    STORE_KEYS_USABLE(mp->ma_keys, mp->ma_keys->dk_usable - numentries);
+    if (log2_seeds) {
+        STORE_KEYS_USABLE(mp->ma_keys, 0);
+    }
+    else {
+        STORE_KEYS_USABLE(mp->ma_keys, mp->ma_keys->dk_usable - numentries);
+    }
     STORE_KEYS_NENTRIES(mp->ma_keys, numentries);
     ASSERT_CONSISTENT(mp);
     return 0;
 }
 
+static int
+dictresize(PyInterpreterState *interp, PyDictObject *mp,
+           uint8_t log2_newsize, int unicode)
+{
+    return dictresize_ex(interp, mp, log2_newsize, unicode, 0, NULL);
+}
+
+/* Pick a seed for every bucket of hashes so that all of them land in
+   distinct slots of a table of 1 << log2_size slots.  Buckets are placed
+   largest first, while the table is still mostly empty.
+   Return 0 on success, 1 if no such seeds were found, and -1 with an
+   exception set on error. */
+static int
+find_perfect_seeds(const Py_hash_t *hashes, Py_ssize_t n,
+                   uint8_t log2_size, uint8_t log2_seeds, uint16_t *seeds)
+{
+    size_t nbuckets = (size_t)1 << log2_seeds;
+    int result = -1;
+    Py_ssize_t *start = PyMem_Calloc(nbuckets + 1, sizeof(Py_ssize_t));
+    Py_ssize_t *members = PyMem_New(Py_ssize_t, n);
+    char *used = PyMem_Calloc((size_t)1 << log2_size, 1);
+    if (start == NULL || members == NULL || used == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    /* Group the hashes by bucket: members[start[b]:start[b+1]] */
+    for (Py_ssize_t i = 0; i < n; i++) {
+        start[dk_perfect_bucket(hashes[i], log2_seeds) + 1]++;
+    }
+    Py_ssize_t max_bucket = 0;
+    for (size_t b = 0; b < nbuckets; b++) {
+        max_bucket = Py_MAX(max_bucket, start[b + 1]);
+        start[b + 1] += start[b];
+    }
+    if (max_bucket > DK_PERFECT_MAX_BUCKET) {
+        result = 1;
+        goto done;
+    }
+    for (Py_ssize_t i = 0; i < n; i++) {
+        members[start[dk_perfect_bucket(hashes[i], log2_seeds)]++] = i;
+    }
+    for (size_t b = nbuckets; b > 0; b--) {
+        start[b] = start[b - 1];
+    }
+    start[0] = 0;
+
+    for (Py_ssize_t k = max_bucket; k > 0; k--) {
+        for (size_t b = 0; b < nbuckets; b++) {
+            if (start[b + 1] - start[b] != k) {
+                continue;
+            }
+            const Py_ssize_t *m = &members[start[b]];
+            /* Equal hashes can never be told apart. */
+            for (Py_ssize_t j = 1; j < k; j++) {
+                for (Py_ssize_t l = 0; l < j; l++) {
+                    if (hashes[m[j]] == hashes[m[l]]) {
+                        result = 1;
+                        goto done;
+                    }
+                }
+            }
+            size_t slots[DK_PERFECT_MAX_BUCKET];
+            size_t seed;
+            for (seed = 0; seed <= DK_PERFECT_MAX_SEED; seed++) {
+                Py_ssize_t j;
+                for (j = 0; j < k; j++) {
+                    size_t i = dk_perfect_slot_seeded(hashes[m[j]], seed, log2_size);
+                    if (used[i]) {
+                        break;
+                    }
+                    used[i] = 1;
+                    slots[j] = i;
+                }
+                if (j == k) {
+                    break;
+                }
+                while (j-- > 0) {
+                    used[slots[j]] = 0;
+                }
+            }
+            if (seed > DK_PERFECT_MAX_SEED) {
+                result = 1;
+                goto done;
+            }
+            seeds[b] = (uint16_t)seed;
+        }
+    }
+    result = 0;
+
+done:
+    PyMem_Free(start);
+    PyMem_Free(members);
+    PyMem_Free(used);
+    return result;
+}
+
+/* Rebuild the keys of a combined dict as perfect-hash keys.  Dicts whose
+   keys do not have a perfect hash (for example because some hashes are
+   equal) are only compacted.  Return -1 with an exception set on error. */
+static int
+dict_make_perfect(PyInterpreterState *interp, PyDictObject *mp)
+{
+    ASSERT_DICT_LOCKED(mp);
+    PyDictKeysObject *keys = mp->ma_keys;
+    Py_ssize_t n = mp->ma_used;
+    if (n == 0 || mp->ma_values != NULL || DK_IS_PERFECT(keys)) {
+        return 0;
+    }
+
+    Py_hash_t *hashes = PyMem_New(Py_hash_t, n);
+    if (hashes == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    Py_ssize_t j = 0;
+    for (Py_ssize_t i = 0; i < keys->dk_nentries; i++) {
+        if (DK_IS_UNICODE(keys)) {
+            PyDictUnicodeEntry *ep = &DK_UNICODE_ENTRIES(keys)[i];
+            if (ep->me_value != NULL) {
+                hashes[j++] = unicode_get_hash(ep->me_key);
+            }
+        }
+        else {
+            PyDictKeyEntry *ep = &DK_ENTRIES(keys)[i];
+            if (ep->me_value != NULL) {
+                hashes[j++] = ep->me_hash;
+            }
+        }
+    }
+    assert(j == n);
+
+    /* At most half of the slots are used, and a bucket holds 4 keys on
+       average.  If that fails, try once more with twice as many slots. */
+    uint8_t log2_size = PyDict_LOG_MINSIZE;
+    while (((size_t)1 << log2_size) < (size_t)n * 2) {
+        log2_size++;
+    }
+    int res = 1;
+    for (int attempt = 0; attempt < 2 && res == 1; attempt++, log2_size++) {
+        if (log2_size >= SIZEOF_SIZE_T * 8 - 1) {
+            break;
+        }
+        uint8_t log2_seeds = Py_MAX(log2_size - 3, 1);
+        uint16_t *seeds = PyMem_New(uint16_t, (size_t)1 << log2_seeds);
+        if (seeds == NULL) {
+            PyErr_NoMemory();
+            res = -1;
+            break;
+        }
+        res = find_perfect_seeds(hashes, n, log2_size, log2_seeds, seeds);
+        if (res == 0) {
+            res = dictresize_ex(interp, mp, log2_size, DK_IS_UNICODE(keys),
+                                log2_seeds, seeds);
+        }
+        PyMem_Free(seeds);
+    }
+    PyMem_Free(hashes);
+    if (res == 1 && keys->dk_nentries != n) {
+        res = dictresize(interp, mp, calculate_log2_keysize(n),
+                         DK_IS_UNICODE(keys));
+    }
+    return res < 0 ? -1 : 0;
+}
+
 static PyObject *
 dict_new_presized(PyInterpreterState *interp, Py_ssize_t minused, bool unicode)
 {
@@ -2628,7 +3172,7 @@ delitem_common(PyDictObject *mp, Py_hash_t hash, Py_ssize_t ix,
     }
     else {
         mp->ma_keys->dk_version = 0;
-        dictkeys_set_index(mp->ma_keys, hashpos, DKIX_DUMMY);
+        dictkeys_set_index_hash(mp->ma_keys, hashpos, DKIX_DUMMY, hash);
         if (DK_IS_UNICODE(mp->ma_keys)) {
             PyDictUnicodeEntry *ep = &DK_UNICODE_ENTRIES(mp->ma_keys)[ix];
             old_key = ep->me_key;
@@ -2678,6 +3222,9 @@ delitem_knownhash_lock_held(PyObject *op, PyObject *key, Py_hash_t hash)
     assert(key);
     assert(hash != -1);
     mp = (PyDictObject *)op;
+    if (dict_check_mutable(mp) < 0) {
+        return -1;
+    }
     ix = _Py_dict_lookup(mp, key, hash, &old_value);
     if (ix == DKIX_ERROR)
         return -1;
@@ -2720,6 +3267,9 @@ delitemif_lock_held(PyObject *op, PyObject *key,
     if (hash == -1)
         return -1;
     mp = (PyDictObject *)op;
+    if (dict_check_mutable(mp) < 0) {
+        return -1;
+    }
     ix = _Py_dict_lookup(mp, key, hash, &old_value);
     if (ix == DKIX_ERROR) {
         return -1;
@@ -2809,6 +3359,9 @@ clear_lock_held(PyObject *op)
 void
 PyDict_Clear(PyObject *op)
 {
+    if (PyDict_Check(op) && dict_check_mutable((PyDictObject *)op) < 0) {
+        return;
+    }
     Py_BEGIN_CRITICAL_SECTION(op);
     clear_lock_held(op);
     Py_END_CRITICAL_SECTION();
@@ -2916,6 +3469,13 @@ _PyDict_Pop_KnownHash(PyDictObject *mp, PyObject *key, Py_hash_t hash,
 
     ASSERT_DICT_LOCKED(mp);
 
+    if (dict_check_mutable(mp) < 0) {
+        if (result) {
+            *result = NULL;
+        }
+        return -1;
+    }
+
     if (mp->ma_used == 0) {
         if (result) {
             *result = NULL;
@@ -2972,7 +3532,7 @@ pop_lock_held(PyObject *op, PyObject *key, PyObject **result)
         if (result) {
             *result = NULL;
         }
-        return 0;
+        return dict_check_mutable(dict);
     }
 
     Py_hash_t hash = _PyObject_HashFast(key);
@@ -3550,6 +4110,9 @@ dict_update_common(PyObject *self, PyObject *args, PyObject *kwds,
     PyObject *arg = NULL;
     int result = 0;
 
+    if (dict_check_mutable((PyDictObject *)self) < 0) {
+        return -1;
+    }
     if (!PyArg_UnpackTuple(args, methname, 0, 1, &arg)) {
         result = -1;
     }
@@ -3689,6 +4252,9 @@ dict_dict_merge(PyInterpreterState *interp, PyDictObject *mp, PyDictObject *othe
     ASSERT_DICT_LOCKED(mp);
     ASSERT_DICT_LOCKED(other);
 
+    if (dict_check_mutable(mp) < 0) {
+        return -1;
+    }
     if (other == mp || other->ma_used == 0)
         /* a.update(a) or a.update({}); nothing to do */
         return 0;
@@ -4175,7 +4741,6 @@ dict___contains__(PyDictObject *self, PyObject *key)
 }
 
 /*[clinic input]
-@critical_section
 dict.get
 
     key: object
@@ -4187,7 +4752,7 @@ Return the value for key if key is in the dictionary, else default.
 
 static PyObject *
 dict_get_impl(PyDictObject *self, PyObject *key, PyObject *default_value)
-/*[clinic end generated code: output=bba707729dee05bf input=a631d3f18f584c60]*/
+/*[clinic end generated code: output=bba707729dee05bf input=279ddb5790b6b107]*/
 {
     PyObject *val = NULL;
     Py_hash_t hash;
@@ -4225,6 +4790,13 @@ dict_setdefault_ref_lock_held(PyObject *d, PyObject *key, PyObject *default_valu
         return -1;
     }
 
+    if (dict_check_mutable(mp) < 0) {
+        if (result) {
+            *result = NULL;
+        }
+        return -1;
+    }
+
     hash = _PyObject_HashFast(key);
     if (hash == -1) {
         if (result) {
@@ -4378,6 +4950,9 @@ static PyObject *
 dict_clear_impl(PyDictObject *self)
 /*[clinic end generated code: output=5139a830df00830a input=0bf729baba97a4c2]*/
 {
+    if (dict_check_mutable(self) < 0) {
+        return NULL;
+    }
     PyDict_Clear((PyObject *)self);
     Py_RETURN_NONE;
 }
@@ -4422,6 +4997,10 @@ dict_popitem_impl(PyDictObject *self)
 
     ASSERT_DICT_LOCKED(self);
 
+    if (dict_check_mutable(self) < 0) {
+        return NULL;
+    }
+
     /* Allocate the result tuple before checking the size.  Believe it
      * or not, this allocation could trigger a garbage collection which
      * could empty the dict, so if we checked the size first and that
@@ -4486,7 +5065,7 @@ dict_popitem_impl(PyDictObject *self)
     j = lookdict_index(self->ma_keys, hash, i);
     assert(j >= 0);
     assert(dictkeys_get_index(self->ma_keys, j) == i);
-    dictkeys_set_index(self->ma_keys, j, DKIX_DUMMY);
+    dictkeys_set_index_hash(self->ma_keys, j, DKIX_DUMMY, hash);
 
     PyTuple_SET_ITEM(res, 0, key);
     PyTuple_SET_ITEM(res, 1, value);
@@ -4534,7 +5113,10 @@ dict_traverse(PyObject *op, visitproc visit, void *arg)
 static int
 dict_tp_clear(PyObject *op)
 {
-    PyDict_Clear(op);
+    /* The garbage collector also breaks cycles through frozendicts. */
+    Py_BEGIN_CRITICAL_SECTION(op);
+    clear_lock_held(op);
+    Py_END_CRITICAL_SECTION();
     return 0;
 }
 
@@ -4575,6 +5157,12 @@ _PyDict_KeysSize(PyDictKeysObject *keys)
     size_t size = sizeof(PyDictKeysObject);
     size += (size_t)1 << keys->dk_log2_index_bytes;
     size += USABLE_FRACTION((size_t)DK_SIZE(keys)) * es;
+    if (DK_HAS_CTRL(keys)) {
+        size += (size_t)DK_SIZE(keys);
+    }
+    if (DK_IS_PERFECT(keys)) {
+        size += sizeof(uint16_t) << keys->dk_log2_seeds;
+    }
     return size;
 }
 
@@ -4611,7 +5199,9 @@ dict_or(PyObject *self, PyObject *other)
 static PyObject *
 dict_ior(PyObject *self, PyObject *other)
 {
-    if (dict_update_arg(self, other)) {
+    if (dict_check_mutable((PyDictObject *)self) < 0
+        || dict_update_arg(self, other))
+    {
         return NULL;
     }
     return Py_NewRef(self);
@@ -4862,6 +5452,231 @@ PyTypeObject PyDict_Type = {
     .tp_vectorcall = dict_vectorcall,
 };
 
+/* frozendict: a dict that cannot be changed.  Its keys are rebuilt once, at
+   creation, into perfect-hash keys.  It is a dict subclass, so it is accepted
+   wherever a dict is; once fd_frozen is set, the dict methods and the dict C
+   API refuse to change it (see dict_check_mutable()).  The hash is computed
+   on first use and cached in fd_hash. */
+
+#define _PyFrozenDict_CAST(op) \
+    (assert(PyObject_TypeCheck((op), &_PyFrozenDict_Type)), \
+     _Py_CAST(_PyFrozenDictObject*, (op)))
+
+static PyObject *
+frozendict_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    if (type == &_PyFrozenDict_Type
+        && PyTuple_GET_SIZE(args) == 1
+        && (kwds == NULL || PyDict_GET_SIZE(kwds) == 0)
+        && _PyFrozenDict_CheckExact(PyTuple_GET_ITEM(args, 0)))
+    {
+        return Py_NewRef(PyTuple_GET_ITEM(args, 0));
+    }
+
+    PyObject *self = dict_new(type, NULL, NULL);
+    if (self == NULL) {
+        return NULL;
+    }
+    _PyFrozenDict_CAST(self)->fd_hash = -1;
+    int res = dict_update_common(self, args, kwds, "frozendict");
+    if (res == 0) {
+        PyInterpreterState *interp = _PyInterpreterState_GET();
+        Py_BEGIN_CRITICAL_SECTION(self);
+        res = dict_make_perfect(interp, (PyDictObject *)self);
+        Py_END_CRITICAL_SECTION();
+    }
+    if (res < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    _PyFrozenDict_CAST(self)->fd_frozen = 1;
+    return self;
+}
+
+static int
+frozendict_init(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    /* Everything is done by frozendict_new() */
+    return 0;
+}
+
+static int
+frozendict_ass_sub(PyObject *self, PyObject *key, PyObject *value)
+{
+    PyErr_Format(PyExc_TypeError, "'%s' object does not support item %s",
+                 _PyType_Name(Py_TYPE(self)),
+                 value == NULL ? "deletion" : "assignment");
+    return -1;
+}
+
+static PyObject *
+frozendict_immutable(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    PyErr_Format(PyExc_TypeError, "'%s' object is immutable",
+                 _PyType_Name(Py_TYPE(self)));
+    return NULL;
+}
+
+static Py_hash_t
+frozendict_hash(PyObject *self)
+{
+    _PyFrozenDictObject *fd = _PyFrozenDict_CAST(self);
+    Py_hash_t hash = FT_ATOMIC_LOAD_SSIZE_RELAXED(fd->fd_hash);
+    if (hash != -1) {
+        return hash;
+    }
+
+    PyObject *items = _PyDictView_New(self, &PyDictItems_Type);
+    if (items == NULL) {
+        return -1;
+    }
+    PyObject *set = PyFrozenSet_New(items);
+    Py_DECREF(items);
+    if (set == NULL) {
+        return -1;
+    }
+    hash = PyObject_Hash(set);
+    Py_DECREF(set);
+    FT_ATOMIC_STORE_SSIZE_RELAXED(fd->fd_hash, hash);
+    return hash;
+}
+
+static PyObject *
+frozendict_repr(PyObject *self)
+{
+    const char *name = _PyType_Name(Py_TYPE(self));
+    if (PyDict_GET_SIZE(self) == 0) {
+        return PyUnicode_FromFormat("%s()", name);
+    }
+    PyObject *repr = dict_repr(self);
+    if (repr == NULL) {
+        return NULL;
+    }
+    PyObject *res = PyUnicode_FromFormat("%s(%U)", name, repr);
+    Py_DECREF(repr);
+    return res;
+}
+
+static PyObject *
+frozendict_or(PyObject *self, PyObject *other)
+{
+    PyObject *res = dict_or(self, other);
+    if (res == NULL || res == Py_NotImplemented
+        || !PyObject_TypeCheck(self, &_PyFrozenDict_Type))
+    {
+        return res;
+    }
+    Py_SETREF(res, PyObject_CallOneArg((PyObject *)&_PyFrozenDict_Type, res));
+    return res;
+}
+
+static PyObject *
+frozendict_copy(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    if (_PyFrozenDict_CheckExact(self)) {
+        return Py_NewRef(self);
+    }
+    return PyObject_CallOneArg((PyObject *)Py_TYPE(self), self);
+}
+
+static PyObject *
+frozendict_fromkeys(PyObject *type, PyObject *args)
+{
+    PyObject *iterable, *value = Py_None;
+    if (!PyArg_UnpackTuple(args, "fromkeys", 1, 2, &iterable, &value)) {
+        return NULL;
+    }
+    PyObject *d = _PyDict_FromKeys((PyObject *)&PyDict_Type, iterable, value);
+    if (d == NULL) {
+        return NULL;
+    }
+    PyObject *res = PyObject_CallOneArg(type, d);
+    Py_DECREF(d);
+    return res;
+}
+
+static PyObject *
+frozendict_reduce(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *d = PyDict_Copy(self);
+    if (d == NULL) {
+        return NULL;
+    }
+    return Py_BuildValue("O(N)", Py_TYPE(self), d);
+}
+
+PyDoc_STRVAR(frozendict_copy__doc__,
+"copy($self, /)\n--\n\nReturn a shallow copy of the frozendict.");
+
+PyDoc_STRVAR(frozendict_fromkeys__doc__,
+"fromkeys($type, iterable, value=None, /)\n--\n\n"
+"Create a new frozendict with keys from iterable and values set to value.");
+
+PyDoc_STRVAR(frozendict_immutable__doc__,
+"Not supported: frozendict objects are immutable.");
+
+static PyMethodDef frozendict_methods[] = {
+    {"copy", frozendict_copy, METH_NOARGS, frozendict_copy__doc__},
+    {"fromkeys", frozendict_fromkeys, METH_VARARGS | METH_CLASS,
+     frozendict_fromkeys__doc__},
+    {"__reduce__", frozendict_reduce, METH_NOARGS,
+     PyDoc_STR("Return state information for pickling.")},
+    {"clear", _PyCFunction_CAST(frozendict_immutable),
+     METH_VARARGS | METH_KEYWORDS, frozendict_immutable__doc__},
+    {"pop", _PyCFunction_CAST(frozendict_immutable),
+     METH_VARARGS | METH_KEYWORDS, frozendict_immutable__doc__},
+    {"popitem", _PyCFunction_CAST(frozendict_immutable),
+     METH_VARARGS | METH_KEYWORDS, frozendict_immutable__doc__},
+    {"setdefault", _PyCFunction_CAST(frozendict_immutable),
+     METH_VARARGS | METH_KEYWORDS, frozendict_immutable__doc__},
+    {"update", _PyCFunction_CAST(frozendict_immutable),
+     METH_VARARGS | METH_KEYWORDS, frozendict_immutable__doc__},
+    {NULL, NULL}   /* sentinel */
+};
+
+static PyMappingMethods frozendict_as_mapping = {
+    dict_length, /*mp_length*/
+    dict_subscript, /*mp_subscript*/
+    frozendict_ass_sub, /*mp_ass_subscript*/
+};
+
+static PyNumberMethods frozendict_as_number = {
+    .nb_or = frozendict_or,
+    .nb_inplace_or = frozendict_or,
+};
+
+PyDoc_STRVAR(frozendict_doc,
+"frozendict() -> new empty frozendict\n"
+"frozendict(mapping) -> new frozendict initialized from a mapping object's\n"
+"    (key, value) pairs\n"
+"frozendict(iterable) -> new frozendict initialized from (key, value) pairs\n"
+"frozendict(**kwargs) -> new frozendict initialized with the name=value pairs\n"
+"    in the keyword argument list.\n"
+"\n"
+"An immutable and hashable dict, laid out so that looking up a key\n"
+"takes a single probe.");
+
+PyTypeObject _PyFrozenDict_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    .tp_name = "types.frozendict",
+    .tp_basicsize = sizeof(_PyFrozenDictObject),
+    .tp_repr = frozendict_repr,
+    .tp_as_number = &frozendict_as_number,
+    .tp_as_mapping = &frozendict_as_mapping,
+    .tp_hash = frozendict_hash,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
+        Py_TPFLAGS_BASETYPE | Py_TPFLAGS_DICT_SUBCLASS |
+        _Py_TPFLAGS_MATCH_SELF | Py_TPFLAGS_MAPPING,
+    .tp_doc = frozendict_doc,
+    .tp_traverse = dict_traverse,
+    .tp_clear = dict_tp_clear,
+    .tp_richcompare = dict_richcompare,
+    .tp_methods = frozendict_methods,
+    .tp_base = &PyDict_Type,
+    .tp_init = frozendict_init,
+    .tp_new = frozendict_new,
+};
+
 /* For backward compatibility with old dictionary interface */
 
 PyObject *
@@ -5705,6 +6520,76 @@ dictreviter_iter_lock_held(PyDictObject *d, PyObject *self)
     return NULL;
 }
 
+#ifdef Py_GIL_DISABLED
+
+// Lock-free version of dictreviter_iter_lock_held() for combined tables.
+// Returns 1 with new references in *out_key and/or *out_value, 0 when the
+// iteration is over or an error is set, and -1 if the caller has to retry
+// with the dict locked.
+static int
+dictreviter_iter_threadsafe(PyDictObject *d, dictiterobject *di,
+                            PyObject **out_key, PyObject **out_value)
+{
+    if (di->di_used != _Py_atomic_load_ssize_relaxed(&d->ma_used)) {
+        PyErr_SetString(PyExc_RuntimeError,
+                         "dictionary changed size during iteration");
+        di->di_used = -1; /* Make this state sticky */
+        return 0;
+    }
+    if (_Py_atomic_load_ptr_relaxed(&d->ma_values) != NULL) {
+        return -1;
+    }
+
+    ensure_shared_on_read(d);
+
+    Py_ssize_t i = _Py_atomic_load_ssize_relaxed(&di->di_pos);
+    PyDictKeysObject *k = _Py_atomic_load_ptr(&d->ma_keys);
+    if (i < 0) {
+        goto fail;
+    }
+    if (i >= _Py_atomic_load_ssize_relaxed(&k->dk_nentries)) {
+        // The keys were replaced since the iterator was created
+        return -1;
+    }
+
+    PyObject *value, **key_loc, **value_loc;
+    if (DK_IS_UNICODE(k)) {
+        PyDictUnicodeEntry *entry_ptr = &DK_UNICODE_ENTRIES(k)[i];
+        while ((value = _Py_atomic_load_ptr(&entry_ptr->me_value)) == NULL) {
+            if (--i < 0) {
+                goto fail;
+            }
+            entry_ptr--;
+        }
+        key_loc = &entry_ptr->me_key;
+        value_loc = &entry_ptr->me_value;
+    }
+    else {
+        PyDictKeyEntry *entry_ptr = &DK_ENTRIES(k)[i];
+        while ((value = _Py_atomic_load_ptr(&entry_ptr->me_value)) == NULL) {
+            if (--i < 0) {
+                goto fail;
+            }
+            entry_ptr--;
+        }
+        key_loc = &entry_ptr->me_key;
+        value_loc = &entry_ptr->me_value;
+    }
+    if (acquire_key_value(key_loc, value, value_loc, out_key, out_value) < 0) {
+        return -1;
+    }
+    _Py_atomic_store_ssize_relaxed(&di->di_pos, i - 1);
+    _Py_atomic_store_ssize_relaxed(&di->len, di->len - 1);
+    return 1;
+
+fail:
+    di->di_dict = NULL;
+    Py_DECREF(d);
+    return 0;
+}
+
+#endif
+
 static PyObject *
 dictreviter_iternext(PyObject *self)
 {
@@ -5715,6 +6600,47 @@ dictreviter_iternext(PyObject *self)
         return NULL;
 
     PyObject *value;
+#ifdef Py_GIL_DISABLED
+    PyObject *key = NULL;
+    bool want_key = !Py_IS_TYPE(di, &PyDictRevIterValue_Type);
+    bool want_value = !Py_IS_TYPE(di, &PyDictRevIterKey_Type);
+    int res = dictreviter_iter_threadsafe(d, di, want_key ? &key : NULL,
+                                          want_value ? &value : NULL);
+    if (res == 0) {
+        return NULL;
+    }
+    if (res > 0) {
+        if (!want_value) {
+            return key;
+        }
+        if (!want_key) {
+            return value;
+        }
+        PyObject *result = di->di_result;
+        if (acquire_iter_result(result)) {
+            PyObject *oldkey = PyTuple_GET_ITEM(result, 0);
+            PyObject *oldvalue = PyTuple_GET_ITEM(result, 1);
+            PyTuple_SET_ITEM(result, 0, key);
+            PyTuple_SET_ITEM(result, 1, value);
+            Py_DECREF(oldkey);
+            Py_DECREF(oldvalue);
+            if (!_PyObject_GC_IS_TRACKED(result)) {
+                _PyObject_GC_TRACK(result);
+            }
+        }
+        else {
+            result = PyTuple_New(2);
+            if (result == NULL) {
+                Py_DECREF(key);
+                Py_DECREF(value);
+                return NULL;
+            }
+            PyTuple_SET_ITEM(result, 0, key);
+            PyTuple_SET_ITEM(result, 1, value);
+        }
+        return result;
+    }
+#endif
     Py_BEGIN_CRITICAL_SECTION(d);
     value = dictreviter_iter_lock_held(d, self);
     Py_END_CRITICAL_SECTION();
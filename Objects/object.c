@@ -17,6 +17,7 @@
 #include "pycore_memoryobject.h"  // _PyManagedBuffer_Type
 #include "pycore_namespace.h"     // _PyNamespace_Type
 #include "pycore_object.h"        // PyAPI_DATA() _Py_SwappedOp definition
+#include "pycore_object_stack.h"  // _PyObjectStackChunk
 #include "pycore_long.h"          // _PyLong_GetZero()
 #include "pycore_optimizer.h"     // _PyUOpExecutor_Type, _PyUOpOptimizer_Type, ...
 #include "pycore_pyerrors.h"      // _PyErr_Occurred()
@@ -818,7 +819,7 @@ PyObject_Bytes(PyObject *v)
 
 static void
 clear_freelist(struct _Py_freelist *freelist, int is_finalization,
-               freefunc dofree)
+               Py_ssize_t maxsize, freefunc dofree)
 {
     void *ptr;
     while ((ptr = _PyFreeList_PopNoStats(freelist)) != NULL) {
@@ -829,6 +830,17 @@ clear_freelist(struct _Py_freelist *freelist, int is_finalization,
     if (is_finalization) {
         freelist->size = -1;
     }
+#ifdef Py_GIL_DISABLED
+    // Halve the capacity of a grown free list if few (or no) allocations
+    // found it empty since it grew: the thread no longer needs that much.
+    Py_ssize_t recent_misses = freelist->misses - freelist->misses_at_resize;
+    if (freelist->scale > 0 &&
+        recent_misses <= _PyFreeList_Capacity(freelist, maxsize) / 2)
+    {
+        freelist->scale--;
+        freelist->misses_at_resize = freelist->misses;
+    }
+#endif
 }
 
 static void
@@ -845,24 +857,127 @@ _PyObject_ClearFreeLists(struct _Py_freelists *freelists, int is_finalization)
 {
     // In the free-threaded build, freelists are per-PyThreadState and cleared in PyThreadState_Clear()
     // In the default build, freelists are per-interpreter and cleared in finalize_interp_types()
-    clear_freelist(&freelists->floats, is_finalization, free_object);
+#define CLEAR_FREELIST(NAME, dofree) \
+    clear_freelist(&freelists->NAME, is_finalization, \
+                   Py_ ## NAME ## _MAXFREELIST, dofree)
+
+    CLEAR_FREELIST(floats, free_object);
     for (Py_ssize_t i = 0; i < PyTuple_MAXSAVESIZE; i++) {
-        clear_freelist(&freelists->tuples[i], is_finalization, free_object);
-    }
-    clear_freelist(&freelists->lists, is_finalization, free_object);
-    clear_freelist(&freelists->dicts, is_finalization, free_object);
-    clear_freelist(&freelists->dictkeys, is_finalization, PyMem_Free);
-    clear_freelist(&freelists->slices, is_finalization, free_object);
-    clear_freelist(&freelists->contexts, is_finalization, free_object);
-    clear_freelist(&freelists->async_gens, is_finalization, free_object);
-    clear_freelist(&freelists->async_gen_asends, is_finalization, free_object);
-    clear_freelist(&freelists->futureiters, is_finalization, free_object);
+        clear_freelist(&freelists->tuples[i], is_finalization,
+                       Py_tuple_MAXFREELIST, free_object);
+    }
+    CLEAR_FREELIST(lists, free_object);
+    CLEAR_FREELIST(dicts, free_object);
+    CLEAR_FREELIST(dictkeys, PyMem_Free);
+    CLEAR_FREELIST(slices, free_object);
+    CLEAR_FREELIST(contexts, free_object);
+    CLEAR_FREELIST(async_gens, free_object);
+    CLEAR_FREELIST(async_gen_asends, free_object);
+    CLEAR_FREELIST(futureiters, free_object);
     if (is_finalization) {
         // Only clear object stack chunks during finalization. We use object
         // stacks during GC, so emptying the free-list is counterproductive.
-        clear_freelist(&freelists->object_stack_chunks, 1, PyMem_RawFree);
+        CLEAR_FREELIST(object_stack_chunks, PyMem_RawFree);
+    }
+    CLEAR_FREELIST(unicode_writers, PyMem_Free);
+#undef CLEAR_FREELIST
+}
+
+// Size in bytes of the memory held by a free list of PyObjects
+static Py_ssize_t
+object_freelist_bytes(struct _Py_freelist *freelist)
+{
+    if (freelist->freelist == NULL) {
+        return 0;
+    }
+    // All the objects of a free list have the same type and size. Their
+    // first word links the free list, but their type and size are intact.
+    PyObject *op = (PyObject *)freelist->freelist;
+    PyTypeObject *tp = Py_TYPE(op);
+    size_t size = _PyType_PreHeaderSize(tp);
+    if (tp->tp_itemsize != 0) {
+        size += _PyObject_VAR_SIZE(tp, ((PyVarObject *)op)->ob_size);
+    }
+    else {
+        size += _PyObject_SIZE(tp);
     }
-    clear_freelist(&freelists->unicode_writers, is_finalization, PyMem_Free);
+    return freelist->size * (Py_ssize_t)size;
+}
+
+static int
+add_freelist_stats(PyObject *dict, const char *name,
+                   struct _Py_freelist *freelist, Py_ssize_t maxsize,
+                   Py_ssize_t bytes)
+{
+    PyObject *stats = Py_BuildValue(
+        "{snsnsnsnsnsn}",
+        "size", Py_MAX(freelist->size, 0),
+        "capacity",
+        freelist->size < 0 ? 0 : _PyFreeList_Capacity(freelist, maxsize),
+        "hits", freelist->hits,
+        "misses", freelist->misses,
+        "overflows", freelist->overflows,
+        "bytes", bytes);
+    if (stats == NULL) {
+        return -1;
+    }
+    int res = PyDict_SetItemString(dict, name, stats);
+    Py_DECREF(stats);
+    return res;
+}
+
+PyObject *
+_PyObject_FreeListStats(struct _Py_freelists *freelists)
+{
+    PyObject *dict = PyDict_New();
+    if (dict == NULL) {
+        return NULL;
+    }
+
+#define ADD_OBJECT_FREELIST(NAME) \
+    if (add_freelist_stats(dict, #NAME, &freelists->NAME, \
+                           Py_ ## NAME ## _MAXFREELIST, \
+                           object_freelist_bytes(&freelists->NAME)) < 0) { \
+        goto error; \
+    }
+#define ADD_MEM_FREELIST(NAME, itemsize) \
+    if (add_freelist_stats(dict, #NAME, &freelists->NAME, \
+                           Py_ ## NAME ## _MAXFREELIST, \
+                           Py_MAX(freelists->NAME.size, 0) * (itemsize)) < 0) { \
+        goto error; \
+    }
+
+    ADD_OBJECT_FREELIST(floats);
+    for (Py_ssize_t i = 0; i < PyTuple_MAXSAVESIZE; i++) {
+        // The free list at index i holds tuples of length i + 1
+        char name[32];
+        PyOS_snprintf(name, sizeof(name), "tuples[%zd]", i + 1);
+        struct _Py_freelist *freelist = &freelists->tuples[i];
+        if (add_freelist_stats(dict, name, freelist, Py_tuple_MAXFREELIST,
+                               object_freelist_bytes(freelist)) < 0) {
+            goto error;
+        }
+    }
+    ADD_OBJECT_FREELIST(lists);
+    ADD_OBJECT_FREELIST(dicts);
+    // Only keys of the smallest size are kept, so they all have the same size
+    ADD_MEM_FREELIST(dictkeys,
+                     freelists->dictkeys.freelist == NULL ? 0 :
+                     (Py_ssize_t)_PyDict_KeysSize(freelists->dictkeys.freelist));
+    ADD_OBJECT_FREELIST(slices);
+    ADD_OBJECT_FREELIST(contexts);
+    ADD_OBJECT_FREELIST(async_gens);
+    ADD_OBJECT_FREELIST(async_gen_asends);
+    ADD_OBJECT_FREELIST(futureiters);
+    ADD_MEM_FREELIST(object_stack_chunks, (Py_ssize_t)sizeof(_PyObjectStackChunk));
+    ADD_MEM_FREELIST(unicode_writers, (Py_ssize_t)sizeof(_PyUnicodeWriter));
+#undef ADD_OBJECT_FREELIST
+#undef ADD_MEM_FREELIST
+    return dict;
+
+error:
+    Py_DECREF(dict);
+    return NULL;
 }
 
 /*
@@ -2353,6 +2468,7 @@ static PyTypeObject* static_types[] = {
     &PyODictKeys_Type,    // base=&PyDictKeys_Type
     &PyODictValues_Type,  // base=&PyDictValues_Type
     &PyODict_Type,        // base=&PyDict_Type
+    &_PyFrozenDict_Type,  // base=&PyDict_Type
 };
 
 
@@ -2486,6 +2602,38 @@ _PyObject_SetDeferredRefcount(PyObject *op)
 #endif
 }
 
+int
+PyUnstable_Object_EnableDeferredRefcount(PyObject *op)
+{
+#ifdef Py_GIL_DISABLED
+    if (!PyType_IS_GC(Py_TYPE(op)) || _Py_IsImmortal(op) ||
+        _PyObject_HasDeferredRefcount(op))
+    {
+        // Objects with deferred reference counting are only freed by the GC,
+        // so it can't be used for objects the GC doesn't know about.
+        return 0;
+    }
+
+    // Other threads may be using the object: stop them while we change its
+    // GC bits and the shared refcount.
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    _PyEval_StopTheWorld(interp);
+    int res = 0;
+    if (!_PyObject_HasDeferredRefcount(op)) {
+        if (!_PyObject_GC_IS_TRACKED(op)) {
+            _PyObject_GC_TRACK(op);
+        }
+        _PyObject_SET_GC_BITS(op, _PyGC_BITS_DEFERRED);
+        op->ob_ref_shared += _Py_REF_SHARED(_Py_REF_DEFERRED, 0);
+        res = 1;
+    }
+    _PyEval_StartTheWorld(interp);
+    return res;
+#else
+    return 0;
+#endif
+}
+
 void
 _Py_ResurrectReference(PyObject *op)
 {
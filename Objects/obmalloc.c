@@ -1,6 +1,7 @@
 /* Python's malloc wrappers (see pymem.h) */
 
 #include "Python.h"
+#include "pycore_ceval.h"         // _Py_set_eval_breaker_bit()
 #include "pycore_code.h"          // stats
 #include "pycore_object.h"        // _PyDebugAllocatorStats() definition
 #include "pycore_obmalloc.h"
@@ -357,6 +358,62 @@ void _PyMem_DebugFree(void *ctx, void *p);
 #  endif
 #endif
 
+#if defined(ARENAS_USE_MMAP) && defined(PYMALLOC_USE_HUGEPAGES) \
+    && (defined(MAP_HUGETLB) || defined(MADV_HUGEPAGE))
+#  define ARENAS_USE_HUGEPAGES
+
+/* Size of the huge pages backing the arenas.  ARENA_SIZE is a multiple of
+   it (see pycore_obmalloc.h). */
+#define HUGEPAGE_SIZE ((size_t)2 << 20)
+
+/* Try to map an arena backed by huge pages.  Explicit huge pages
+   (MAP_HUGETLB) are only available if the administrator reserved some, so
+   fall back to a mapping aligned on the huge page size and ask for
+   transparent huge pages.  Return NULL if neither is possible; the caller
+   then uses regular pages. */
+static void *
+arena_alloc_hugepages(size_t size)
+{
+    void *ptr;
+    if (size % HUGEPAGE_SIZE != 0) {
+        return NULL;
+    }
+#ifdef MAP_HUGETLB
+    int flags = MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB;
+#  ifdef MAP_HUGE_2MB
+    flags |= MAP_HUGE_2MB;
+#  endif
+    ptr = mmap(NULL, size, PROT_READ|PROT_WRITE, flags, -1, 0);
+    if (ptr != MAP_FAILED) {
+        return ptr;
+    }
+#endif
+#ifdef MADV_HUGEPAGE
+    /* The kernel only uses a transparent huge page for an aligned range:
+       over-allocate and unmap the unaligned head and tail. */
+    size_t len = size + HUGEPAGE_SIZE;
+    char *raw = mmap(NULL, len, PROT_READ|PROT_WRITE,
+                     MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        return NULL;
+    }
+    char *aligned = _Py_ALIGN_UP(raw, HUGEPAGE_SIZE);
+    if (aligned != raw) {
+        munmap(raw, aligned - raw);
+    }
+    size_t tail = (raw + len) - (aligned + size);
+    if (tail != 0) {
+        munmap(aligned + size, tail);
+    }
+    /* Failure is harmless: the arena is then backed by regular pages. */
+    (void)madvise(aligned, size, MADV_HUGEPAGE);
+    return aligned;
+#else
+    return NULL;
+#endif
+}
+#endif  /* ARENAS_USE_HUGEPAGES */
+
 void *
 _PyMem_ArenaAlloc(void *Py_UNUSED(ctx), size_t size)
 {
@@ -365,6 +422,12 @@ _PyMem_ArenaAlloc(void *Py_UNUSED(ctx), size_t size)
                         MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
 #elif defined(ARENAS_USE_MMAP)
     void *ptr;
+#ifdef ARENAS_USE_HUGEPAGES
+    ptr = arena_alloc_hugepages(size);
+    if (ptr != NULL) {
+        return ptr;
+    }
+#endif
     ptr = mmap(NULL, size, PROT_READ|PROT_WRITE,
                MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
     if (ptr == MAP_FAILED)
@@ -1073,13 +1136,15 @@ _PyMem_Strdup(const char *str)
 /* Delayed freeing support for Py_GIL_DISABLED */
 /***********************************************/
 
-// So that sizeof(struct _mem_work_chunk) is 4096 bytes on 64-bit platforms.
-#define WORK_ITEMS_PER_CHUNK 254
+// So that sizeof(struct _mem_work_chunk) fits in 4096 bytes on 64-bit
+// platforms.
+#define WORK_ITEMS_PER_CHUNK 169
 
 // A pointer to be freed once the QSBR read sequence reaches qsbr_goal.
 struct _mem_work_item {
     uintptr_t ptr; // lowest bit tagged 1 for objects freed with PyObject_Free
     uint64_t qsbr_goal;
+    size_t size;   // (approximate) size of the memory block in bytes
 };
 
 // A fixed-size buffer of pointers to be freed
@@ -1104,7 +1169,7 @@ free_work_item(uintptr_t ptr)
 }
 
 static void
-free_delayed(uintptr_t ptr)
+free_delayed(uintptr_t ptr, size_t size)
 {
 #ifndef Py_GIL_DISABLED
     free_work_item(ptr);
@@ -1148,29 +1213,41 @@ free_delayed(uintptr_t ptr)
     }
 
     assert(buf != NULL && buf->wr_idx < WORK_ITEMS_PER_CHUNK);
-    uint64_t seq = _Py_qsbr_deferred_advance(tstate->qsbr);
+    struct _qsbr_thread_state *qsbr = tstate->qsbr;
+    uint64_t seq = _Py_qsbr_deferred_advance_for_free(qsbr, size);
     buf->array[buf->wr_idx].ptr = ptr;
     buf->array[buf->wr_idx].qsbr_goal = seq;
+    buf->array[buf->wr_idx].size = size;
     buf->wr_idx++;
+    qsbr->queued_memory += size;
+    if (qsbr->queued_memory >= QSBR_FREE_MEM_LIMIT) {
+        qsbr->should_process = true;
+    }
 
     if (buf->wr_idx == WORK_ITEMS_PER_CHUNK) {
+        // Normally the queue is processed from the eval breaker once enough
+        // memory is waiting. Processing here bounds the number of small
+        // blocks that can accumulate.
         _PyMem_ProcessDelayed((PyThreadState *)tstate);
     }
+    else if (qsbr->should_process) {
+        _Py_set_eval_breaker_bit(&tstate->base, _PY_EVAL_QSBR_PROCESS_BIT);
+    }
 #endif
 }
 
 void
-_PyMem_FreeDelayed(void *ptr)
+_PyMem_FreeDelayed(void *ptr, size_t size)
 {
     assert(!((uintptr_t)ptr & 0x01));
-    free_delayed((uintptr_t)ptr);
+    free_delayed((uintptr_t)ptr, size);
 }
 
 void
-_PyObject_FreeDelayed(void *ptr)
+_PyObject_FreeDelayed(void *ptr, size_t size)
 {
     assert(!((uintptr_t)ptr & 0x01));
-    free_delayed(((uintptr_t)ptr)|0x01);
+    free_delayed(((uintptr_t)ptr)|0x01, size);
 }
 
 static struct _mem_work_chunk *
@@ -1179,20 +1256,24 @@ work_queue_first(struct llist_node *head)
     return llist_data(head->next, struct _mem_work_chunk, node);
 }
 
-static void
+// Frees the items whose goal was reached and returns the number of bytes
+// freed.
+static size_t
 process_queue(struct llist_node *head, struct _qsbr_thread_state *qsbr,
               bool keep_empty)
 {
+    size_t freed = 0;
     while (!llist_empty(head)) {
         struct _mem_work_chunk *buf = work_queue_first(head);
 
         while (buf->rd_idx < buf->wr_idx) {
             struct _mem_work_item *item = &buf->array[buf->rd_idx];
             if (!_Py_qsbr_poll(qsbr, item->qsbr_goal)) {
-                return;
+                return freed;
             }
 
             free_work_item(item->ptr);
+            freed += item->size;
             buf->rd_idx++;
         }
 
@@ -1200,31 +1281,51 @@ process_queue(struct llist_node *head, struct _qsbr_thread_state *qsbr,
         if (keep_empty && buf->node.next == head) {
             // Keep the last buffer in the queue to reduce re-allocations
             buf->rd_idx = buf->wr_idx = 0;
-            return;
+            return freed;
         }
 
         llist_remove(&buf->node);
         PyMem_Free(buf);
     }
+    return freed;
 }
 
-static void
+static size_t
 process_interp_queue(struct _Py_mem_interp_free_queue *queue,
                      struct _qsbr_thread_state *qsbr)
 {
     if (!_Py_atomic_load_int_relaxed(&queue->has_work)) {
-        return;
+        return 0;
     }
 
     // Try to acquire the lock, but don't block if it's already held.
+    size_t freed = 0;
     if (_PyMutex_LockTimed(&queue->mutex, 0, 0) == PY_LOCK_ACQUIRED) {
-        process_queue(&queue->head, qsbr, false);
+        freed = process_queue(&queue->head, qsbr, false);
 
         int more_work = !llist_empty(&queue->head);
         _Py_atomic_store_int_relaxed(&queue->has_work, more_work);
 
         PyMutex_Unlock(&queue->mutex);
     }
+    return freed;
+}
+
+// Adds the memory queued by the thread since the last call, minus the
+// memory just freed, to the shared backlog. Returns the new backlog.
+static Py_ssize_t
+update_backlog(struct _qsbr_thread_state *qsbr, size_t freed)
+{
+    struct _qsbr_shared *shared = qsbr->shared;
+    Py_ssize_t delta = (Py_ssize_t)qsbr->queued_memory - (Py_ssize_t)freed;
+    qsbr->queued_memory = 0;
+    if (freed != 0) {
+        _Py_atomic_add_ssize(&shared->reclaimed, (Py_ssize_t)freed);
+    }
+    if (delta == 0) {
+        return _Py_atomic_load_ssize_relaxed(&shared->backlog);
+    }
+    return _Py_atomic_add_ssize(&shared->backlog, delta) + delta;
 }
 
 void
@@ -1232,12 +1333,80 @@ _PyMem_ProcessDelayed(PyThreadState *tstate)
 {
     PyInterpreterState *interp = tstate->interp;
     _PyThreadStateImpl *tstate_impl = (_PyThreadStateImpl *)tstate;
+    struct llist_node *head = &tstate_impl->mem_free_queue;
 
     // Process thread-local work
-    process_queue(&tstate_impl->mem_free_queue, tstate_impl->qsbr, true);
+    size_t freed = process_queue(head, tstate_impl->qsbr, true);
 
     // Process shared interpreter work
-    process_interp_queue(&interp->mem_free_queue, tstate_impl->qsbr);
+    freed += process_interp_queue(&interp->mem_free_queue, tstate_impl->qsbr);
+
+    Py_ssize_t backlog = update_backlog(tstate_impl->qsbr, freed);
+    if (backlog >= QSBR_FREE_MEM_LIMIT && !llist_empty(head) &&
+        work_queue_first(head)->rd_idx < work_queue_first(head)->wr_idx)
+    {
+        // A lot of memory is waiting and some of it is ours: keep polling
+        // from the eval breaker instead of waiting for the queue to fill.
+        tstate_impl->qsbr->should_process = true;
+        _Py_set_eval_breaker_bit(tstate, _PY_EVAL_QSBR_PROCESS_BIT);
+    }
+}
+
+void
+_PyMem_ProcessDelayedOrReclaim(PyThreadState *tstate)
+{
+    _PyMem_ProcessDelayed(tstate);
+
+    struct _qsbr_shared *shared = &tstate->interp->qsbr;
+    Py_ssize_t limit = _Py_atomic_load_ssize_relaxed(&shared->memory_limit);
+    if (limit <= 0 || _Py_atomic_load_ssize_relaxed(&shared->backlog) <= limit) {
+        return;
+    }
+    // The backlog is approximate and may stay above the limit after a
+    // reclaim: stop the world at most once per write sequence, so that it
+    // is only stopped again once more memory was deferred.
+    uint64_t wr_seq = _Py_qsbr_shared_current(shared);
+    uint64_t reclaim_seq = _Py_atomic_load_uint64_relaxed(&shared->reclaim_seq);
+    if (reclaim_seq == wr_seq ||
+        !_Py_atomic_compare_exchange_uint64(&shared->reclaim_seq,
+                                            &reclaim_seq, wr_seq))
+    {
+        return;
+    }
+    _PyEval_StopTheWorld(tstate->interp);
+    _PyMem_ReclaimDelayed(tstate->interp);
+    // _PyMem_ReclaimDelayed() advanced the write sequence.
+    _Py_atomic_store_uint64_relaxed(&shared->reclaim_seq,
+                                    _Py_qsbr_shared_current(shared));
+    _PyEval_StartTheWorld(tstate->interp);
+    _Py_atomic_add_ssize(&shared->forced_reclaims, 1);
+}
+
+void
+_PyMem_ReclaimDelayed(PyInterpreterState *interp)
+{
+    // While we are in a "stop the world" pause, we can observe the latest
+    // write sequence by advancing the write sequence immediately.
+    _Py_qsbr_advance(&interp->qsbr);
+    _PyThreadStateImpl *current_tstate = (_PyThreadStateImpl *)_PyThreadState_GET();
+    _Py_qsbr_quiescent_state(current_tstate->qsbr);
+
+    // Merge the queues from other threads into our own queue so that we can
+    // process all of the pending delayed free requests at once.
+    HEAD_LOCK(&_PyRuntime);
+    for (PyThreadState *p = interp->threads.head; p != NULL; p = p->next) {
+        _PyThreadStateImpl *other = (_PyThreadStateImpl *)p;
+        if (other != current_tstate) {
+            llist_concat(&current_tstate->mem_free_queue, &other->mem_free_queue);
+            if (other->qsbr != NULL) {
+                current_tstate->qsbr->queued_memory += other->qsbr->queued_memory;
+                other->qsbr->queued_memory = 0;
+            }
+        }
+    }
+    HEAD_UNLOCK(&_PyRuntime);
+
+    _PyMem_ProcessDelayed((PyThreadState *)current_tstate);
 }
 
 void
@@ -1259,7 +1428,9 @@ _PyMem_AbandonDelayed(PyThreadState *tstate)
         return;
     }
 
-    // Merge the thread's work queue into the interpreter's work queue.
+    // Account for the memory queued since the thread last processed its
+    // queue, then merge the queue into the interpreter's work queue.
+    update_backlog(((_PyThreadStateImpl *)tstate)->qsbr, 0);
     PyMutex_Lock(&interp->mem_free_queue.mutex);
     llist_concat(&interp->mem_free_queue.head, queue);
     _Py_atomic_store_int_relaxed(&interp->mem_free_queue.has_work, 1);
@@ -1084,6 +1084,8 @@ type_modified_unlocked(PyTypeObject *type)
         // This field *must* be invalidated if the type is modified (see the
         // comment on struct _specialization_cache):
         ((PyHeapTypeObject *)type)->_spec_cache.getitem = NULL;
+        ((PyHeapTypeObject *)type)->_spec_cache.getattr = NULL;
+        ((PyHeapTypeObject *)type)->_spec_cache.descr_get = NULL;
     }
 }
 
@@ -1160,6 +1162,8 @@ type_mro_modified(PyTypeObject *type, PyObject *bases) {
         // This field *must* be invalidated if the type is modified (see the
         // comment on struct _specialization_cache):
         ((PyHeapTypeObject *)type)->_spec_cache.getitem = NULL;
+        ((PyHeapTypeObject *)type)->_spec_cache.getattr = NULL;
+        ((PyHeapTypeObject *)type)->_spec_cache.descr_get = NULL;
     }
 }
 
@@ -5492,6 +5496,20 @@ update_cache_gil_disabled(struct type_cache_entry *entry, PyObject *name,
     Py_DECREF(old_value);
 }
 
+static void
+update_thread_cache(struct _type_cache_thread_entry *entry, PyObject *name,
+                    unsigned int version_tag, PyObject *value)
+{
+    assert(version_tag != 0);
+    // The entry holds borrowed references, so only cache immortal names:
+    // interned strings are immortal on free-threaded builds.
+    if (_Py_IsImmortal(name)) {
+        entry->version = version_tag;
+        entry->name = name;
+        entry->value = value;
+    }
+}
+
 #endif
 
 void
@@ -5524,6 +5542,27 @@ _PyType_LookupRef(PyTypeObject *type, PyObject *name)
     struct type_cache *cache = get_type_cache();
     struct type_cache_entry *entry = &cache->hashtable[h];
 #ifdef Py_GIL_DISABLED
+    // Try the thread's own cache first: the shared entries are written by
+    // every thread, so their cache lines bounce between cores when many
+    // threads look up attributes at the same time.
+    struct _type_cache_thread_entry *thread_entry =
+        &((_PyThreadStateImpl *)_PyThreadState_GET())->type_cache[
+            h & ((1 << MCACHE_THREAD_SIZE_EXP) - 1)];
+    uint32_t thread_version = _Py_atomic_load_uint32_acquire(&type->tp_version_tag);
+    if (thread_entry->version == thread_version && thread_entry->name == name) {
+        PyObject *value = thread_entry->value;
+        // The type keeps the value alive only as long as its version tag
+        // is unchanged, so check the tag again once we own a reference.
+        if (value == NULL || _Py_TryIncref(value)) {
+            if (_Py_atomic_load_uint32_acquire(&type->tp_version_tag) == thread_version) {
+                OBJECT_STAT_INC(type_cache_thread_hits);
+                return value;
+            }
+            Py_XDECREF(value);
+        }
+    }
+    OBJECT_STAT_INC(type_cache_thread_misses);
+
     // synchronize-with other writing threads by doing an acquire load on the sequence
     while (1) {
         uint32_t sequence = _PySeqLock_BeginRead(&entry->sequence);
@@ -5537,6 +5576,7 @@ _PyType_LookupRef(PyTypeObject *type, PyObject *name)
             // If the sequence is still valid then we're done
             if (value == NULL || _Py_TryIncref(value)) {
                 if (_PySeqLock_EndRead(&entry->sequence, sequence)) {
+                    update_thread_cache(thread_entry, name, entry_version, value);
                     return value;
                 }
                 Py_XDECREF(value);
@@ -5599,6 +5639,7 @@ _PyType_LookupRef(PyTypeObject *type, PyObject *name)
     if (has_version) {
 #if Py_GIL_DISABLED
         update_cache_gil_disabled(entry, name, version, res);
+        update_thread_cache(thread_entry, name, version, res);
 #else
         PyObject *old_value = update_cache(entry, name, version, res);
         Py_DECREF(old_value);
@@ -16,10 +16,18 @@
 // The queueing thread uses the eval breaker mechanism to notify the owning
 // thread that it has objects to merge. Additionally, all queued objects are
 // merged during GC.
+//
+// To avoid taking a bucket mutex for every object, each thread first collects
+// the objects in small per-thread batches, one per owning thread, and hands a
+// batch over when it is full. Batches are also handed over when the thread
+// next handles its eval breaker, when it goes idle (detaches from the
+// interpreter), and when it exits. GC merges the batches of all threads
+// directly.
 #include "Python.h"
 #include "pycore_object.h"      // _Py_ExplicitMergeRefcount
 #include "pycore_brc.h"         // struct _brc_thread_state
 #include "pycore_ceval.h"       // _Py_set_eval_breaker_bit
+#include "pycore_code.h"        // OBJECT_STAT_INC()
 #include "pycore_llist.h"       // struct llist_node
 #include "pycore_pystate.h"     // _PyThreadStateImpl
 
@@ -48,6 +56,170 @@ find_thread_state(struct _brc_bucket *bucket, uintptr_t thread_id)
     return NULL;
 }
 
+#ifdef Py_STATS
+static PyTime_t
+stats_now(void)
+{
+    PyTime_t now = 0;
+    if (_Py_stats) {
+        (void)PyTime_MonotonicRaw(&now);
+    }
+    return now;
+}
+#endif
+
+// What to do with an object of a batch once the bucket mutex is released
+enum {
+    BRC_QUEUED,             // handed to the owning thread
+    BRC_DECREF,             // the owning thread already merged the refcount
+    BRC_DEALLOC,            // merged here and the refcount dropped to zero
+    BRC_STOP_THE_WORLD,     // could not be queued
+};
+
+// Hand the objects of `batch` to their owning thread. If `wait` is zero,
+// this neither blocks on the bucket mutex nor runs any destructor, and
+// returns -1 if some objects are left in the batch.
+static int
+flush_batch(PyInterpreterState *interp, struct _brc_batch *batch, int wait)
+{
+    Py_ssize_t n = batch->size;
+    if (n == 0) {
+        return 0;
+    }
+    uintptr_t tid = batch->tid;
+
+    // Empty the batch before locking: PyMutex_Lock() may detach this thread,
+    // which flushes the batches again (see _Py_brc_flush_idle()).
+    PyObject *objects[_Py_BRC_BATCH_SIZE];
+    char actions[_Py_BRC_BATCH_SIZE];
+    memcpy(objects, batch->objects, n * sizeof(PyObject *));
+    batch->size = 0;
+
+    struct _brc_bucket *bucket = get_bucket(interp, tid);
+    if (wait) {
+        PyMutex_Lock(&bucket->mutex);
+    }
+    else if (_PyMutex_LockTimed(&bucket->mutex, 0, 0) != PY_LOCK_ACQUIRED) {
+        batch->size = n;
+        return -1;
+    }
+
+    _PyThreadStateImpl *tstate = find_thread_state(bucket, tid);
+    if (tstate == NULL && !wait) {
+        // Merging the refcounts here might deallocate the objects.
+        PyMutex_Unlock(&bucket->mutex);
+        batch->size = n;
+        return -1;
+    }
+
+#ifdef Py_STATS
+    if (tstate != NULL && tstate->brc.objects_to_merge.head == NULL) {
+        tstate->brc.first_queued = batch->first_queued;
+    }
+#endif
+
+    Py_ssize_t queued = 0;
+    for (Py_ssize_t i = 0; i < n; i++) {
+        PyObject *ob = objects[i];
+        if (_Py_atomic_load_uintptr(&ob->ob_tid) == 0) {
+            // The owning thread may have concurrently decided to merge the
+            // refcount fields.
+            actions[i] = BRC_DECREF;
+        }
+        else if (tstate == NULL) {
+            // If we didn't find the owning thread then it must have already
+            // exited. It's safe (and necessary) to merge the refcount.
+            // Subtract one when merging because we've stolen a reference.
+            Py_ssize_t refcount = _Py_ExplicitMergeRefcount(ob, -1);
+            actions[i] = refcount == 0 ? BRC_DEALLOC : BRC_QUEUED;
+        }
+        else if (_PyObjectStack_Push(&tstate->brc.objects_to_merge, ob) == 0) {
+            actions[i] = BRC_QUEUED;
+            queued++;
+        }
+        else {
+            actions[i] = BRC_STOP_THE_WORLD;
+        }
+    }
+
+    if (queued) {
+        // Notify owning thread
+        _Py_set_eval_breaker_bit(&tstate->base, _PY_EVAL_EXPLICIT_MERGE_BIT);
+        OBJECT_STAT_INC(brc_batches);
+    }
+    PyMutex_Unlock(&bucket->mutex);
+
+    if (!wait) {
+        // Put the objects we could not hand over back into the batch.
+        for (Py_ssize_t i = 0; i < n; i++) {
+            if (actions[i] != BRC_QUEUED) {
+                batch->objects[batch->size++] = objects[i];
+            }
+        }
+        batch->tid = tid;
+        return batch->size ? -1 : 0;
+    }
+
+    for (Py_ssize_t i = 0; i < n; i++) {
+        PyObject *ob = objects[i];
+        switch (actions[i]) {
+        case BRC_DECREF:
+            Py_DECREF(ob);
+            break;
+        case BRC_DEALLOC:
+            _Py_Dealloc(ob);
+            break;
+        case BRC_STOP_THE_WORLD: {
+            // Fall back to stopping all threads and manually merging the
+            // refcount if we can't enqueue the object to be merged.
+            _PyEval_StopTheWorld(interp);
+            Py_ssize_t refcount = _Py_ExplicitMergeRefcount(ob, -1);
+            _PyEval_StartTheWorld(interp);
+
+            if (refcount == 0) {
+                _Py_Dealloc(ob);
+            }
+            break;
+        }
+        }
+    }
+    return 0;
+}
+
+static void
+flush_batches(PyInterpreterState *interp, struct _brc_thread_state *brc)
+{
+    for (int i = 0; i < _Py_BRC_NUM_BATCHES; i++) {
+        (void)flush_batch(interp, &brc->batches[i], 1);
+    }
+}
+
+// Return the batch collecting objects owned by thread `tid`, an empty batch
+// if there is none, or else the least recently used batch.  Thread ids are
+// aligned addresses, so they are searched rather than hashed.
+static struct _brc_batch *
+find_batch(struct _brc_thread_state *brc, uintptr_t tid)
+{
+    struct _brc_batch *victim = NULL;
+    for (int i = 0; i < _Py_BRC_NUM_BATCHES; i++) {
+        struct _brc_batch *batch = &brc->batches[i];
+        if (batch->size == 0) {
+            if (victim == NULL || victim->size > 0) {
+                victim = batch;
+            }
+        }
+        else if (batch->tid == tid) {
+            return batch;
+        }
+        else if (victim == NULL
+                 || (victim->size > 0 && batch->last_used < victim->last_used))
+        {
+            victim = batch;
+        }
+    }
+    return victim;
+}
+
 // Enqueue an object to be merged by the owning thread. This steals a
 // reference to the object.
 void
@@ -63,40 +235,43 @@ _Py_brc_queue_object(PyObject *ob)
         return;
     }
 
-    struct _brc_bucket *bucket = get_bucket(interp, ob_tid);
-    PyMutex_Lock(&bucket->mutex);
-    _PyThreadStateImpl *tstate = find_thread_state(bucket, ob_tid);
-    if (tstate == NULL) {
-        // If we didn't find the owning thread then it must have already exited.
-        // It's safe (and necessary) to merge the refcount. Subtract one when
-        // merging because we've stolen a reference.
-        Py_ssize_t refcount = _Py_ExplicitMergeRefcount(ob, -1);
-        PyMutex_Unlock(&bucket->mutex);
-        if (refcount == 0) {
-            _Py_Dealloc(ob);
-        }
-        return;
+    OBJECT_STAT_INC(brc_queued);
+    _PyThreadStateImpl *tstate = (_PyThreadStateImpl *)_PyThreadState_GET();
+    struct _brc_batch *batch = find_batch(&tstate->brc, ob_tid);
+    while (batch->size > 0 && batch->tid != ob_tid) {
+        // All the batches collect objects for other threads: hand the
+        // least recently used one over.  Flushing may run destructors that
+        // queue objects again and refill any batch, so search again.
+        (void)flush_batch(interp, batch, 1);
+        batch = find_batch(&tstate->brc, ob_tid);
     }
+    if (batch->size == 0) {
+        // Hand the batch over at the latest when this thread next handles
+        // its eval breaker, so that objects are not kept alive for long.
+        _Py_set_eval_breaker_bit(&tstate->base, _PY_EVAL_EXPLICIT_MERGE_BIT);
+#ifdef Py_STATS
+        batch->first_queued = stats_now();
+#endif
+    }
+    batch->tid = ob_tid;
+    batch->last_used = ++tstate->brc.batch_clock;
+    batch->objects[batch->size++] = ob;
+    if (batch->size == _Py_BRC_BATCH_SIZE) {
+        (void)flush_batch(interp, batch, 1);
+    }
+}
 
-    if (_PyObjectStack_Push(&tstate->brc.objects_to_merge, ob) < 0) {
-        PyMutex_Unlock(&bucket->mutex);
-
-        // Fall back to stopping all threads and manually merging the refcount
-        // if we can't enqueue the object to be merged.
-        _PyEval_StopTheWorld(interp);
-        Py_ssize_t refcount = _Py_ExplicitMergeRefcount(ob, -1);
-        _PyEval_StartTheWorld(interp);
-
-        if (refcount == 0) {
-            _Py_Dealloc(ob);
+void
+_Py_brc_flush_idle(PyThreadState *tstate)
+{
+    struct _brc_thread_state *brc = &((_PyThreadStateImpl *)tstate)->brc;
+    for (int i = 0; i < _Py_BRC_NUM_BATCHES; i++) {
+        if (brc->batches[i].size > 0 &&
+            flush_batch(tstate->interp, &brc->batches[i], 0) == 0)
+        {
+            OBJECT_STAT_INC(brc_idle_flushes);
         }
-        return;
     }
-
-    // Notify owning thread
-    _Py_set_eval_breaker_bit(&tstate->base, _PY_EVAL_EXPLICIT_MERGE_BIT);
-
-    PyMutex_Unlock(&bucket->mutex);
 }
 
 static void
@@ -104,6 +279,7 @@ merge_queued_objects(_PyObjectStack *to_merge)
 {
     PyObject *ob;
     while ((ob = _PyObjectStack_Pop(to_merge)) != NULL) {
+        OBJECT_STAT_INC(brc_merged);
         // Subtract one when merging because the queue had a reference.
         Py_ssize_t refcount = _Py_ExplicitMergeRefcount(ob, -1);
         if (refcount == 0) {
@@ -121,9 +297,19 @@ _Py_brc_merge_refcounts(PyThreadState *tstate)
 
     assert(brc->tid == _Py_ThreadId());
 
+    // Hand over the objects this thread queued for other threads as well.
+    flush_batches(tstate->interp, brc);
+
     // Append all objects into a local stack. We don't want to hold the lock
     // while calling destructors.
     PyMutex_Lock(&bucket->mutex);
+#ifdef Py_STATS
+    if (_Py_stats && brc->objects_to_merge.head != NULL) {
+        OBJECT_STAT_INC(brc_merges);
+        _Py_stats->object_stats.brc_merge_latency_ns +=
+            stats_now() - brc->first_queued;
+    }
+#endif
     _PyObjectStack_Merge(&brc->local_objects_to_merge, &brc->objects_to_merge);
     PyMutex_Unlock(&bucket->mutex);
 
@@ -173,11 +359,17 @@ _Py_brc_remove_thread(PyThreadState *tstate)
     // as abandoned and may merge the objects' refcounts directly.
     bool empty = false;
     while (!empty) {
+        // Hand over the objects this thread queued for other threads
+        flush_batches(tstate->interp, brc);
+
         // Process the local stack until it's empty
         merge_queued_objects(&brc->local_objects_to_merge);
 
         PyMutex_Lock(&bucket->mutex);
         empty = (brc->objects_to_merge.head == NULL);
+        for (int i = 0; i < _Py_BRC_NUM_BATCHES; i++) {
+            empty = empty && brc->batches[i].size == 0;
+        }
         if (empty) {
             llist_remove(&brc->bucket_node);
         }
@@ -449,6 +449,9 @@ dummy_func(
             BINARY_OP_SUBTRACT_FLOAT,
             BINARY_OP_ADD_UNICODE,
             // BINARY_OP_INPLACE_ADD_UNICODE,  // See comments at that opcode.
+            BINARY_OP_MIXED_INT_FLOAT,
+            BINARY_OP_EXTEND_LIST,
+            BINARY_OP_REMAINDER_UNICODE,
         };
 
         op(_GUARD_BOTH_INT, (left, right -- left, right)) {
@@ -580,6 +583,91 @@ dummy_func(
         macro(BINARY_OP_SUBTRACT_FLOAT) =
             _GUARD_BOTH_FLOAT + unused/1 + _BINARY_OP_SUBTRACT_FLOAT;
 
+        /* Mixed int and float +, - and *, in either order. The int is
+         * converted exactly as float's own number methods would, so a too
+         * large int raises OverflowError here too. */
+        op(_BINARY_OP_MIXED_INT_FLOAT, (left, right -- res)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+
+            int int_left = PyLong_CheckExact(left_o);
+            EXIT_IF(int_left ? !PyFloat_CheckExact(right_o)
+                             : !PyFloat_CheckExact(left_o) || !PyLong_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            double l, r;
+            if (int_left) {
+                l = PyLong_AsDouble(left_o);
+                r = PyFloat_AS_DOUBLE(right_o);
+            }
+            else {
+                l = PyFloat_AS_DOUBLE(left_o);
+                r = PyLong_AsDouble(right_o);
+            }
+            int failed = (l == -1.0 || r == -1.0) && PyErr_Occurred();
+            if (failed) {
+                DECREF_INPUTS();
+                ERROR_IF(true, error);
+            }
+            double dres;
+            if (oparg == NB_ADD || oparg == NB_INPLACE_ADD) {
+                dres = l + r;
+            }
+            else if (oparg == NB_SUBTRACT || oparg == NB_INPLACE_SUBTRACT) {
+                dres = l - r;
+            }
+            else {
+                assert(oparg == NB_MULTIPLY || oparg == NB_INPLACE_MULTIPLY);
+                dres = l * r;
+            }
+            DECREF_INPUTS();
+            PyObject *res_o = PyFloat_FromDouble(dres);
+            ERROR_IF(res_o == NULL, error);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
+        macro(BINARY_OP_MIXED_INT_FLOAT) =
+            unused/1 + _BINARY_OP_MIXED_INT_FLOAT;
+
+        /* list += list or tuple. The right operand is restricted to types
+         * without nb_add, so list_inplace_concat is what would be called. */
+        op(_BINARY_OP_EXTEND_LIST, (left, right -- res)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+
+            assert(oparg == NB_INPLACE_ADD);
+            EXIT_IF(!PyList_CheckExact(left_o));
+            EXIT_IF(!PyList_CheckExact(right_o) && !PyTuple_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            int err = PyList_Extend(left_o, right_o);
+            PyStackRef_CLOSE(right);
+            if (err < 0) {
+                PyStackRef_CLOSE(left);
+                ERROR_IF(true, error);
+            }
+            res = left;
+            DEAD(left);
+        }
+
+        macro(BINARY_OP_EXTEND_LIST) =
+            unused/1 + _BINARY_OP_EXTEND_LIST;
+
+        /* str % tuple, the printf-style formatting case. */
+        op(_BINARY_OP_REMAINDER_UNICODE, (left, right -- res)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+
+            EXIT_IF(!PyUnicode_CheckExact(left_o));
+            EXIT_IF(!PyTuple_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = PyUnicode_Format(left_o, right_o);
+            DECREF_INPUTS();
+            ERROR_IF(res_o == NULL, error);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
+        macro(BINARY_OP_REMAINDER_UNICODE) =
+            unused/1 + _BINARY_OP_REMAINDER_UNICODE;
+
         op(_GUARD_BOTH_UNICODE, (left, right -- left, right)) {
             PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
             PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
@@ -808,7 +896,7 @@ dummy_func(
             PyObject *sub = PyStackRef_AsPyObjectBorrow(sub_st);
             PyObject *dict = PyStackRef_AsPyObjectBorrow(dict_st);
 
-            DEOPT_IF(!PyDict_CheckExact(dict));
+            DEOPT_IF(!PyDict_CheckExact(dict) && !_PyFrozenDict_CheckExact(dict));
             STAT_INC(BINARY_SUBSCR, hit);
             PyObject *res_o;
             int rc = PyDict_GetItemRef(dict, sub, &res_o);
@@ -2002,6 +2090,8 @@ dummy_func(
             LOAD_ATTR_CLASS_WITH_METACLASS_CHECK,
             LOAD_ATTR_PROPERTY,
             LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN,
+            LOAD_ATTR_GETATTR_FALLBACK,
+            LOAD_ATTR_DESCRIPTOR_GET,
             LOAD_ATTR_METHOD_WITH_VALUES,
             LOAD_ATTR_METHOD_NO_DICT,
             LOAD_ATTR_METHOD_LAZY_DICT,
@@ -2232,6 +2322,75 @@ dummy_func(
             _SAVE_RETURN_OFFSET +
             _PUSH_FRAME;
 
+        op(_LOAD_ATTR_GETATTR_FRAME, (owner -- new_frame: _PyInterpreterFrame *)) {
+            assert((oparg & 1) == 0);
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(PyType_HasFeature(tp, Py_TPFLAGS_HEAPTYPE));
+            PyHeapTypeObject *ht = (PyHeapTypeObject *)tp;
+            PyObject *getattr = ht->_spec_cache.getattr;
+            DEOPT_IF(getattr == NULL);
+            assert(PyFunction_Check(getattr));
+            uint32_t cached_version = ht->_spec_cache.getattr_version;
+            DEOPT_IF(((PyFunctionObject *)getattr)->func_version != cached_version);
+            PyCodeObject *code = (PyCodeObject *)PyFunction_GET_CODE(getattr);
+            assert(code->co_argcount == 2);
+            DEOPT_IF(!_PyThreadState_HasStackSpace(tstate, code->co_framesize));
+            STAT_INC(LOAD_ATTR, hit);
+            PyObject *name = GETITEM(FRAME_CO_NAMES, oparg >> 1);
+            new_frame = _PyFrame_PushUnchecked(tstate, PyStackRef_FromPyObjectNew(getattr), 2, frame);
+            new_frame->localsplus[0] = owner;
+            DEAD(owner);
+            new_frame->localsplus[1] = PyStackRef_FromPyObjectNew(name);
+        }
+
+        /* The attribute is absent from both the instance and its type, so
+         * the generic lookup would fail and fall back to __getattr__: call
+         * it directly. */
+        macro(LOAD_ATTR_GETATTR_FALLBACK) =
+            unused/1 +
+            _CHECK_PEP_523 +
+            _GUARD_TYPE_VERSION +
+            _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT +
+            _GUARD_KEYS_VERSION +
+            unused/4 +
+            _LOAD_ATTR_GETATTR_FRAME +
+            _SAVE_RETURN_OFFSET +
+            _PUSH_FRAME;
+
+        op(_LOAD_ATTR_DESCRIPTOR_GET_FRAME, (descr/4, owner -- new_frame: _PyInterpreterFrame *)) {
+            assert((oparg & 1) == 0);
+            PyTypeObject *dtp = Py_TYPE(descr);
+            DEOPT_IF(!PyType_HasFeature(dtp, Py_TPFLAGS_HEAPTYPE));
+            PyHeapTypeObject *ht = (PyHeapTypeObject *)dtp;
+            PyObject *descr_get = ht->_spec_cache.descr_get;
+            DEOPT_IF(descr_get == NULL);
+            assert(PyFunction_Check(descr_get));
+            uint32_t cached_version = ht->_spec_cache.descr_get_version;
+            DEOPT_IF(((PyFunctionObject *)descr_get)->func_version != cached_version);
+            PyCodeObject *code = (PyCodeObject *)PyFunction_GET_CODE(descr_get);
+            assert(code->co_argcount == 3);
+            DEOPT_IF(!_PyThreadState_HasStackSpace(tstate, code->co_framesize));
+            STAT_INC(LOAD_ATTR, hit);
+            PyTypeObject *owner_type = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            new_frame = _PyFrame_PushUnchecked(tstate, PyStackRef_FromPyObjectNew(descr_get), 3, frame);
+            new_frame->localsplus[0] = PyStackRef_FromPyObjectNew(descr);
+            new_frame->localsplus[1] = owner;
+            DEAD(owner);
+            new_frame->localsplus[2] = PyStackRef_FromPyObjectNew((PyObject *)owner_type);
+        }
+
+        /* A descriptor implemented in Python, not shadowed by the instance:
+         * call its __get__(descr, owner, type(owner)) in a new frame. */
+        macro(LOAD_ATTR_DESCRIPTOR_GET) =
+            unused/1 +
+            _CHECK_PEP_523 +
+            _GUARD_TYPE_VERSION +
+            _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT +
+            _GUARD_KEYS_VERSION +
+            _LOAD_ATTR_DESCRIPTOR_GET_FRAME +
+            _SAVE_RETURN_OFFSET +
+            _PUSH_FRAME;
+
         inst(LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN, (unused/1, type_version/2, func_version/2, getattribute/4, owner -- unused, unused if (0))) {
             PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
 
@@ -2507,7 +2666,7 @@ dummy_func(
             PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
             PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
 
-            DEOPT_IF(!PyDict_CheckExact(right_o));
+            DEOPT_IF(!PyDict_CheckExact(right_o) && !_PyFrozenDict_CheckExact(right_o));
             STAT_INC(CONTAINS_OP, hit);
             int res = PyDict_Contains(right_o, left_o);
             DECREF_INPUTS();
@@ -4136,6 +4295,8 @@ dummy_func(
             CALL_KW_BOUND_METHOD,
             CALL_KW_PY,
             CALL_KW_NON_PY,
+            CALL_KW_BUILTIN_FAST,
+            CALL_KW_METHOD_DESCRIPTOR_FAST,
         };
 
         inst(INSTRUMENTED_CALL_KW, (counter/1, version/2 -- )) {
@@ -4380,6 +4541,100 @@ dummy_func(
             _CALL_KW_NON_PY +
             _CHECK_PERIODIC;
 
+        op(_CALL_KW_BUILTIN_FAST, (callable[1], self_or_null[1], args[oparg], kwnames -- res)) {
+            /* Builtin METH_FASTCALL | METH_KEYWORDS functions */
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable[0]);
+
+            int total_args = oparg;
+            if (!PyStackRef_IsNull(self_or_null[0])) {
+                args--;
+                total_args++;
+            }
+            EXIT_IF(!PyCFunction_CheckExact(callable_o));
+            EXIT_IF(PyCFunction_GET_FLAGS(callable_o) != (METH_FASTCALL | METH_KEYWORDS));
+            STAT_INC(CALL_KW, hit);
+            PyObject *kwnames_o = PyStackRef_AsPyObjectBorrow(kwnames);
+            int positional_args = total_args - (int)PyTuple_GET_SIZE(kwnames_o);
+            /* res = func(self, args, nargs, kwnames) */
+            PyCFunctionFastWithKeywords cfunc =
+                (PyCFunctionFastWithKeywords)(void(*)(void))
+                PyCFunction_GET_FUNCTION(callable_o);
+
+            STACKREFS_TO_PYOBJECTS(args, total_args, args_o);
+            if (CONVERSION_FAILED(args_o)) {
+                DECREF_INPUTS();
+                ERROR_IF(true, error);
+            }
+            PyObject *res_o = cfunc(PyCFunction_GET_SELF(callable_o), args_o, positional_args, kwnames_o);
+            STACKREFS_TO_PYOBJECTS_CLEANUP(args_o);
+            PyStackRef_CLOSE(kwnames);
+            assert((res_o != NULL) ^ (_PyErr_Occurred(tstate) != NULL));
+
+            /* Free the arguments. */
+            for (int i = 0; i < total_args; i++) {
+                PyStackRef_CLOSE(args[i]);
+            }
+            DEAD(self_or_null);
+            PyStackRef_CLOSE(callable[0]);
+            ERROR_IF(res_o == NULL, error);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
+        macro(CALL_KW_BUILTIN_FAST) =
+            unused/1 + // Skip over the counter
+            unused/2 +
+            _CALL_KW_BUILTIN_FAST +
+            _CHECK_PERIODIC;
+
+        op(_CALL_KW_METHOD_DESCRIPTOR_FAST, (callable[1], self_or_null[1], args[oparg], kwnames -- res)) {
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable[0]);
+
+            int total_args = oparg;
+            if (!PyStackRef_IsNull(self_or_null[0])) {
+                args--;
+                total_args++;
+            }
+            PyMethodDescrObject *method = (PyMethodDescrObject *)callable_o;
+            EXIT_IF(!Py_IS_TYPE(method, &PyMethodDescr_Type));
+            PyMethodDef *meth = method->d_method;
+            EXIT_IF(meth->ml_flags != (METH_FASTCALL|METH_KEYWORDS));
+            PyObject *kwnames_o = PyStackRef_AsPyObjectBorrow(kwnames);
+            int positional_args = total_args - (int)PyTuple_GET_SIZE(kwnames_o);
+            // self must be passed positionally:
+            EXIT_IF(positional_args < 1);
+            PyTypeObject *d_type = method->d_common.d_type;
+            PyObject *self = PyStackRef_AsPyObjectBorrow(args[0]);
+            EXIT_IF(!Py_IS_TYPE(self, d_type));
+            STAT_INC(CALL_KW, hit);
+
+            STACKREFS_TO_PYOBJECTS(args, total_args, args_o);
+            if (CONVERSION_FAILED(args_o)) {
+                DECREF_INPUTS();
+                ERROR_IF(true, error);
+            }
+            PyCFunctionFastWithKeywords cfunc =
+                (PyCFunctionFastWithKeywords)(void(*)(void))meth->ml_meth;
+            PyObject *res_o = cfunc(self, (args_o + 1), positional_args - 1, kwnames_o);
+            STACKREFS_TO_PYOBJECTS_CLEANUP(args_o);
+            PyStackRef_CLOSE(kwnames);
+            assert((res_o != NULL) ^ (_PyErr_Occurred(tstate) != NULL));
+
+            /* Free the arguments. */
+            for (int i = 0; i < total_args; i++) {
+                PyStackRef_CLOSE(args[i]);
+            }
+            DEAD(self_or_null);
+            PyStackRef_CLOSE(callable[0]);
+            ERROR_IF(res_o == NULL, error);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
+        macro(CALL_KW_METHOD_DESCRIPTOR_FAST) =
+            unused/1 + // Skip over the counter
+            unused/2 +
+            _CALL_KW_METHOD_DESCRIPTOR_FAST +
+            _CHECK_PERIODIC;
+
         inst(INSTRUMENTED_CALL_FUNCTION_EX, ( -- )) {
             GO_TO_INSTRUCTION(CALL_FUNCTION_EX);
         }
@@ -4991,6 +5246,16 @@ dummy_func(
             GOTO_UNWIND();
         }
 
+        /* BUILD_TUPLE(n) immediately followed by UNPACK_SEQUENCE(n), with
+         * the tuple allocation sunk by the optimizer. */
+        tier2 pure op(_REVERSE, (values[oparg] -- values[oparg])) {
+            for (int i = 0, j = oparg - 1; i < j; i++, j--) {
+                _PyStackRef tmp = values[i];
+                values[i] = values[j];
+                values[j] = tmp;
+            }
+        }
+
         /* Progress is guaranteed if we DEOPT on the eval breaker, because
          * ENTER_EXECUTOR will not re-enter tier 2 with the eval breaker set. */
         tier2 op(_TIER2_RESUME_CHECK, (--)) {
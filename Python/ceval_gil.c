@@ -1289,6 +1289,13 @@ _Py_HandlePending(PyThreadState *tstate)
         _Py_unset_eval_breaker_bit(tstate, _PY_EVAL_EXPLICIT_MERGE_BIT);
         _Py_brc_merge_refcounts(tstate);
     }
+    /* Process deferred memory frees held by QSBR */
+    if ((breaker & _PY_EVAL_QSBR_PROCESS_BIT) != 0) {
+        _Py_unset_eval_breaker_bit(tstate, _PY_EVAL_QSBR_PROCESS_BIT);
+        if (_Py_qsbr_should_process(((_PyThreadStateImpl *)tstate)->qsbr)) {
+            _PyMem_ProcessDelayedOrReclaim(tstate);
+        }
+    }
 #endif
 
     /* GC scheduled to run */
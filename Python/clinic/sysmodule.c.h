@@ -6,6 +6,7 @@ preserve
 #  include "pycore_gc.h"          // PyGC_Head
 #  include "pycore_runtime.h"     // _Py_ID()
 #endif
+#include "pycore_abstract.h"      // _PyNumber_Index()
 #include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
 
 PyDoc_STRVAR(sys_addaudithook__doc__,
@@ -323,6 +324,134 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(sys__defer_refcount__doc__,
+"_defer_refcount($module, object, /)\n"
+"--\n"
+"\n"
+"Enable deferred reference counting on the object.\n"
+"\n"
+"Return True if it was enabled.  Deferred reference counting avoids\n"
+"contention on the reference count of objects shared by many threads, but the\n"
+"object is then only freed by the garbage collector.  It is only available\n"
+"on free-threaded builds, for objects tracked by the garbage collector.");
+
+#define SYS__DEFER_REFCOUNT_METHODDEF    \
+    {"_defer_refcount", (PyCFunction)sys__defer_refcount, METH_O, sys__defer_refcount__doc__},
+
+static int
+sys__defer_refcount_impl(PyObject *module, PyObject *object);
+
+static PyObject *
+sys__defer_refcount(PyObject *module, PyObject *object)
+{
+    PyObject *return_value = NULL;
+    int _return_value;
+
+    _return_value = sys__defer_refcount_impl(module, object);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyBool_FromLong((long)_return_value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(sys__freelist_stats__doc__,
+"_freelist_stats($module, /)\n"
+"--\n"
+"\n"
+"Return statistics about the free lists of small objects.\n"
+"\n"
+"Return a dictionary mapping the name of each free list to a dictionary with\n"
+"its current size and capacity, the number of allocations it served (hits),\n"
+"of allocations that found it empty (misses), of frees that found it full\n"
+"(overflows), and the number of bytes it holds.  On free-threaded builds,\n"
+"free lists are per thread and the statistics are those of the current\n"
+"thread.");
+
+#define SYS__FREELIST_STATS_METHODDEF    \
+    {"_freelist_stats", (PyCFunction)sys__freelist_stats, METH_NOARGS, sys__freelist_stats__doc__},
+
+static PyObject *
+sys__freelist_stats_impl(PyObject *module);
+
+static PyObject *
+sys__freelist_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__freelist_stats_impl(module);
+}
+
+PyDoc_STRVAR(sys__get_qsbr_stats__doc__,
+"_get_qsbr_stats($module, /)\n"
+"--\n"
+"\n"
+"Return statistics about the memory waiting to be freed after a grace period.\n"
+"\n"
+"On free-threaded builds, memory that other threads may still be reading is\n"
+"freed only once all threads have passed a quiescent state.  The returned\n"
+"dictionary has the following keys:\n"
+"\n"
+"- backlog: bytes currently waiting to be freed\n"
+"- reclaimed: total bytes freed after a grace period\n"
+"- forced_reclaims: number of times the world was stopped because the\n"
+"  backlog exceeded the memory limit\n"
+"- memory_limit: the limit set by sys._set_qsbr_memory_limit()\n"
+"\n"
+"The backlog is updated in batches, so it is approximate.");
+
+#define SYS__GET_QSBR_STATS_METHODDEF    \
+    {"_get_qsbr_stats", (PyCFunction)sys__get_qsbr_stats, METH_NOARGS, sys__get_qsbr_stats__doc__},
+
+static PyObject *
+sys__get_qsbr_stats_impl(PyObject *module);
+
+static PyObject *
+sys__get_qsbr_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__get_qsbr_stats_impl(module);
+}
+
+PyDoc_STRVAR(sys__set_qsbr_memory_limit__doc__,
+"_set_qsbr_memory_limit($module, limit, /)\n"
+"--\n"
+"\n"
+"Set the limit of memory waiting to be freed after a grace period.\n"
+"\n"
+"When the memory waiting to be freed exceeds *limit* bytes, the next thread\n"
+"to notice stops all threads and frees it at once.  0 disables the limit.\n"
+"This only has an effect on free-threaded builds.");
+
+#define SYS__SET_QSBR_MEMORY_LIMIT_METHODDEF    \
+    {"_set_qsbr_memory_limit", (PyCFunction)sys__set_qsbr_memory_limit, METH_O, sys__set_qsbr_memory_limit__doc__},
+
+static PyObject *
+sys__set_qsbr_memory_limit_impl(PyObject *module, Py_ssize_t limit);
+
+static PyObject *
+sys__set_qsbr_memory_limit(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t limit;
+
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(arg);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        limit = ival;
+    }
+    return_value = sys__set_qsbr_memory_limit_impl(module, limit);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(sys_settrace__doc__,
 "settrace($module, function, /)\n"
 "--\n"
@@ -1614,4 +1743,4 @@ exit:
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=9cc9069aef1482bc input=a9049054013a1b77]*/
+/*[clinic end generated code: output=13f30e625c31fa99 input=a9049054013a1b77]*/
@@ -7,6 +7,7 @@
 #include "pycore_initconfig.h"    // _PyStatus_OK()
 #include "pycore_namespace.h"     //_PyNamespace_New()
 #include "pycore_pyerrors.h"      // _PyErr_Clear()
+#include "pycore_setobject.h"     // _PySet_NextEntry()
 #include "pycore_weakref.h"       // _PyWeakref_GET_REF()
 
 
@@ -170,6 +171,7 @@ _PyCrossInterpreterData_Clear(PyInterpreterState *interp,
     assert(data != NULL);
     // This must be called in the owning interpreter.
     assert(interp == NULL
+           || data->independent
            || _PyCrossInterpreterData_INTERPID(data) == -1
            || _PyCrossInterpreterData_INTERPID(data) == PyInterpreterState_GetID(interp));
     _xidata_clear(data);
@@ -297,6 +299,17 @@ _xidata_release(_PyCrossInterpreterData *data, int rawfree)
         return 0;
     }
 
+    if (data->independent) {
+        // The original interpreter is not needed, and it may even be
+        // destroyed already.
+        assert(data->obj == NULL);
+        _xidata_clear(data);
+        if (rawfree) {
+            PyMem_RawFree(data);
+        }
+        return 0;
+    }
+
     // Switch to the original interpreter.
     PyInterpreterState *interp = _PyInterpreterState_LookUpID(
                                     _PyCrossInterpreterData_INTERPID(data));
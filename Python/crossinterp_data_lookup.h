@@ -457,99 +457,503 @@ _bool_shared(PyThreadState *tstate, PyObject *obj,
     return 0;
 }
 
-// tuple
+// containers
+
+/* Tuples, lists, dicts and frozensets are flattened, with all their
+   items, into a single buffer allocated with the raw allocator, rather
+   than sharing each item separately.  Each value is written as a tag
+   byte followed by its payload:
+
+     NONE, FALSE, TRUE      -
+     INT                    Py_ssize_t value
+     FLOAT                  double value
+     STR                    Py_ssize_t length, char kind, length * kind bytes
+     BYTES                  Py_ssize_t size, size bytes
+     TUPLE, LIST, FROZENSET Py_ssize_t length, length values
+     DICT                   Py_ssize_t length, length (key, value) pairs
+     XID                    Py_ssize_t index in the "xids" array
+
+   Since the buffer is not aligned, values are copied with memcpy().
+
+   Other shareable objects are shared on their own, as items of the "xids"
+   array.  Without them, the buffer does not depend on the interpreter
+   which created it. */
+
+enum _shared_flat_tag {
+    _FLAT_NONE,
+    _FLAT_FALSE,
+    _FLAT_TRUE,
+    _FLAT_INT,
+    _FLAT_FLOAT,
+    _FLAT_STR,
+    _FLAT_BYTES,
+    _FLAT_TUPLE,
+    _FLAT_LIST,
+    _FLAT_DICT,
+    _FLAT_FROZENSET,
+    _FLAT_XID,
+};
 
-struct _shared_tuple_data {
-    Py_ssize_t len;
-    _PyCrossInterpreterData **data;
+struct _shared_flat_data {
+    _PyCrossInterpreterData **xids;
+    Py_ssize_t nxids;
+    size_t size;
+    char buf[];
 };
 
-static PyObject *
-_new_tuple_object(_PyCrossInterpreterData *data)
+static void
+_flat_release_xids(_PyCrossInterpreterData **xids, Py_ssize_t nxids)
 {
-    struct _shared_tuple_data *shared = (struct _shared_tuple_data *)(data->data);
-    PyObject *tuple = PyTuple_New(shared->len);
-    if (tuple == NULL) {
-        return NULL;
-    }
-
-    for (Py_ssize_t i = 0; i < shared->len; i++) {
-        PyObject *item = _PyCrossInterpreterData_NewObject(shared->data[i]);
-        if (item == NULL){
-            Py_DECREF(tuple);
-            return NULL;
-        }
-        PyTuple_SET_ITEM(tuple, i, item);
+    for (Py_ssize_t i = 0; i < nxids; i++) {
+        _PyCrossInterpreterData_Release(xids[i]);
+        PyMem_RawFree(xids[i]);
     }
-    return tuple;
+    PyMem_RawFree(xids);
 }
 
 static void
-_tuple_shared_free(void* data)
-{
-    struct _shared_tuple_data *shared = (struct _shared_tuple_data *)(data);
-#ifndef NDEBUG
-    int64_t interpid = PyInterpreterState_GetID(_PyInterpreterState_GET());
-#endif
-    for (Py_ssize_t i = 0; i < shared->len; i++) {
-        if (shared->data[i] != NULL) {
-            assert(_PyCrossInterpreterData_INTERPID(shared->data[i]) == interpid);
-            _PyCrossInterpreterData_Release(shared->data[i]);
-            PyMem_RawFree(shared->data[i]);
-            shared->data[i] = NULL;
-        }
+_flat_shared_free(void *data)
+{
+    struct _shared_flat_data *shared = (struct _shared_flat_data *)data;
+    if (shared->xids != NULL) {
+        _flat_release_xids(shared->xids, shared->nxids);
     }
-    PyMem_Free(shared->data);
     PyMem_RawFree(shared);
 }
 
+/* writing */
+
+typedef struct {
+    struct _shared_flat_data *shared;
+    size_t allocated;
+    Py_ssize_t xids_allocated;
+} _flat_writer;
+
+#define _FLAT_INITIAL_SIZE 256
+
 static int
-_tuple_shared(PyThreadState *tstate, PyObject *obj,
-             _PyCrossInterpreterData *data)
+_flat_writer_init(_flat_writer *writer)
 {
-    Py_ssize_t len = PyTuple_GET_SIZE(obj);
-    if (len < 0) {
+    size_t allocated = _FLAT_INITIAL_SIZE;
+    struct _shared_flat_data *shared = PyMem_RawMalloc(
+            sizeof(struct _shared_flat_data) + allocated);
+    if (shared == NULL) {
+        PyErr_NoMemory();
         return -1;
     }
-    struct _shared_tuple_data *shared = PyMem_RawMalloc(sizeof(struct _shared_tuple_data));
-    if (shared == NULL){
-        PyErr_NoMemory();
+    shared->xids = NULL;
+    shared->nxids = 0;
+    shared->size = 0;
+    writer->shared = shared;
+    writer->allocated = allocated;
+    writer->xids_allocated = 0;
+    return 0;
+}
+
+// Reserve "size" bytes at the end of the buffer and return their offset,
+// or -1 on error.  The buffer may move.
+static Py_ssize_t
+_flat_reserve(_flat_writer *writer, size_t size)
+{
+    struct _shared_flat_data *shared = writer->shared;
+    if (writer->allocated - shared->size < size) {
+        if (size > (size_t)PY_SSIZE_T_MAX - sizeof(struct _shared_flat_data)
+                   - shared->size)
+        {
+            PyErr_NoMemory();
+            return -1;
+        }
+        size_t allocated = shared->size + size;
+        if (writer->allocated <= (size_t)PY_SSIZE_T_MAX / 2) {
+            allocated = Py_MAX(allocated, writer->allocated * 2);
+        }
+        shared = PyMem_RawRealloc(
+                shared, sizeof(struct _shared_flat_data) + allocated);
+        if (shared == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        writer->shared = shared;
+        writer->allocated = allocated;
+    }
+    Py_ssize_t offset = (Py_ssize_t)shared->size;
+    shared->size += size;
+    return offset;
+}
+
+static int
+_flat_write(_flat_writer *writer, int tag, const void *payload, size_t size)
+{
+    Py_ssize_t offset = _flat_reserve(writer, 1 + size);
+    if (offset < 0) {
         return -1;
     }
+    char *p = writer->shared->buf + offset;
+    *p = (char)tag;
+    if (size != 0) {
+        memcpy(p + 1, payload, size);
+    }
+    return 0;
+}
 
-    shared->len = len;
-    shared->data = (_PyCrossInterpreterData **) PyMem_Calloc(shared->len, sizeof(_PyCrossInterpreterData *));
-    if (shared->data == NULL) {
-        PyErr_NoMemory();
+static int
+_flat_write_ssize(_flat_writer *writer, int tag, Py_ssize_t value)
+{
+    return _flat_write(writer, tag, &value, sizeof(value));
+}
+
+// The length of a list or a dict is only known once its items are written,
+// since another thread can change it meanwhile.
+static void
+_flat_patch_length(_flat_writer *writer, Py_ssize_t offset, Py_ssize_t len)
+{
+    memcpy(writer->shared->buf + offset + 1, &len, sizeof(len));
+}
+
+static int
+_flat_write_xid(_flat_writer *writer, PyObject *obj)
+{
+    struct _shared_flat_data *shared = writer->shared;
+    if (shared->nxids == writer->xids_allocated) {
+        Py_ssize_t allocated = writer->xids_allocated * 2 + 4;
+        _PyCrossInterpreterData **xids = PyMem_RawRealloc(
+                shared->xids, allocated * sizeof(_PyCrossInterpreterData *));
+        if (xids == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        shared->xids = xids;
+        writer->xids_allocated = allocated;
+    }
+    _PyCrossInterpreterData *data = _PyCrossInterpreterData_New();
+    if (data == NULL) {
+        return -1;  // PyErr_NoMemory already set
+    }
+    if (_PyObject_GetCrossInterpreterData(obj, data) < 0) {
+        PyMem_RawFree(data);
         return -1;
     }
+    Py_ssize_t index = shared->nxids;
+    shared->xids[index] = data;
+    shared->nxids++;
+    return _flat_write_ssize(writer, _FLAT_XID, index);
+}
+
+static int _flat_write_object(PyThreadState *, _flat_writer *, PyObject *);
 
-    for (Py_ssize_t i = 0; i < shared->len; i++) {
-        _PyCrossInterpreterData *data = _PyCrossInterpreterData_New();
-        if (data == NULL) {
-            goto error;  // PyErr_NoMemory already set
+static int
+_flat_write_items(PyThreadState *tstate, _flat_writer *writer, PyObject *obj)
+{
+    int res = -1;
+    Py_ssize_t offset = (Py_ssize_t)writer->shared->size;
+    Py_ssize_t len = 0;
+
+    if (PyTuple_CheckExact(obj)) {
+        len = PyTuple_GET_SIZE(obj);
+        if (_flat_write_ssize(writer, _FLAT_TUPLE, len) < 0) {
+            return -1;
         }
-        PyObject *item = PyTuple_GET_ITEM(obj, i);
+        for (Py_ssize_t i = 0; i < len; i++) {
+            if (_flat_write_object(tstate, writer,
+                                   PyTuple_GET_ITEM(obj, i)) < 0)
+            {
+                return -1;
+            }
+        }
+        return 0;
+    }
+    else if (PyFrozenSet_CheckExact(obj)) {
+        len = PySet_GET_SIZE(obj);
+        if (_flat_write_ssize(writer, _FLAT_FROZENSET, len) < 0) {
+            return -1;
+        }
+        Py_ssize_t pos = 0;
+        PyObject *item;
+        Py_hash_t hash;
+        while (_PySet_NextEntry(obj, &pos, &item, &hash)) {
+            if (_flat_write_object(tstate, writer, item) < 0) {
+                return -1;
+            }
+        }
+        return 0;
+    }
+    else if (PyList_CheckExact(obj)) {
+        if (_flat_write_ssize(writer, _FLAT_LIST, 0) < 0) {
+            return -1;
+        }
+        Py_BEGIN_CRITICAL_SECTION(obj);
+        for (; len < PyList_GET_SIZE(obj); len++) {
+            PyObject *item = Py_NewRef(PyList_GET_ITEM(obj, len));
+            int err = _flat_write_object(tstate, writer, item);
+            Py_DECREF(item);
+            if (err < 0) {
+                goto done;
+            }
+        }
+        res = 0;
+    done:;
+        Py_END_CRITICAL_SECTION();
+    }
+    else {
+        assert(PyDict_CheckExact(obj));
+        if (_flat_write_ssize(writer, _FLAT_DICT, 0) < 0) {
+            return -1;
+        }
+        Py_BEGIN_CRITICAL_SECTION(obj);
+        Py_ssize_t pos = 0;
+        PyObject *key, *value;
+        while (PyDict_Next(obj, &pos, &key, &value)) {
+            Py_INCREF(key);
+            Py_INCREF(value);
+            int err = _flat_write_object(tstate, writer, key);
+            if (err == 0) {
+                err = _flat_write_object(tstate, writer, value);
+            }
+            Py_DECREF(key);
+            Py_DECREF(value);
+            if (err < 0) {
+                goto dict_done;
+            }
+            len++;
+        }
+        res = 0;
+    dict_done:;
+        Py_END_CRITICAL_SECTION();
+    }
+    if (res == 0) {
+        _flat_patch_length(writer, offset, len);
+    }
+    return res;
+}
 
-        int res = -1;
-        if (!_Py_EnterRecursiveCallTstate(tstate, " while sharing a tuple")) {
-            res = _PyObject_GetCrossInterpreterData(item, data);
-            _Py_LeaveRecursiveCallTstate(tstate);
+static int
+_flat_write_object(PyThreadState *tstate, _flat_writer *writer, PyObject *obj)
+{
+    PyTypeObject *type = Py_TYPE(obj);
+    if (obj == Py_None) {
+        return _flat_write(writer, _FLAT_NONE, NULL, 0);
+    }
+    else if (type == &PyBool_Type) {
+        return _flat_write(writer, Py_IsTrue(obj) ? _FLAT_TRUE : _FLAT_FALSE,
+                           NULL, 0);
+    }
+    else if (type == &PyLong_Type) {
+        Py_ssize_t value = PyLong_AsSsize_t(obj);
+        if (value == -1 && PyErr_Occurred()) {
+            if (PyErr_ExceptionMatches(PyExc_OverflowError)) {
+                PyErr_SetString(PyExc_OverflowError, "try sending as bytes");
+            }
+            return -1;
+        }
+        return _flat_write_ssize(writer, _FLAT_INT, value);
+    }
+    else if (type == &PyFloat_Type) {
+        double value = PyFloat_AS_DOUBLE(obj);
+        return _flat_write(writer, _FLAT_FLOAT, &value, sizeof(value));
+    }
+    else if (type == &PyUnicode_Type) {
+        Py_ssize_t len = PyUnicode_GET_LENGTH(obj);
+        int kind = PyUnicode_KIND(obj);
+        Py_ssize_t offset = _flat_reserve(
+                writer, 1 + sizeof(len) + 1 + (size_t)len * kind);
+        if (offset < 0) {
+            return -1;
+        }
+        char *p = writer->shared->buf + offset;
+        *p++ = _FLAT_STR;
+        memcpy(p, &len, sizeof(len));
+        p += sizeof(len);
+        *p++ = (char)kind;
+        memcpy(p, PyUnicode_DATA(obj), (size_t)len * kind);
+        return 0;
+    }
+    else if (type == &PyBytes_Type) {
+        Py_ssize_t len = PyBytes_GET_SIZE(obj);
+        Py_ssize_t offset = _flat_reserve(writer, 1 + sizeof(len) + len);
+        if (offset < 0) {
+            return -1;
+        }
+        char *p = writer->shared->buf + offset;
+        *p++ = _FLAT_BYTES;
+        memcpy(p, &len, sizeof(len));
+        memcpy(p + sizeof(len), PyBytes_AS_STRING(obj), len);
+        return 0;
+    }
+    else if (type == &PyTuple_Type || type == &PyList_Type
+             || type == &PyDict_Type || type == &PyFrozenSet_Type)
+    {
+        if (_Py_EnterRecursiveCallTstate(tstate, " while sharing a container")) {
+            return -1;
         }
-        if (res < 0) {
-            PyMem_RawFree(data);
+        int res = _flat_write_items(tstate, writer, obj);
+        _Py_LeaveRecursiveCallTstate(tstate);
+        return res;
+    }
+    else {
+        return _flat_write_xid(writer, obj);
+    }
+}
+
+/* reading */
+
+typedef struct {
+    const char *p;
+    _PyCrossInterpreterData **xids;
+} _flat_reader;
+
+static Py_ssize_t
+_flat_read_ssize(_flat_reader *reader)
+{
+    Py_ssize_t value;
+    memcpy(&value, reader->p, sizeof(value));
+    reader->p += sizeof(value);
+    return value;
+}
+
+static PyObject *_flat_read_object(_flat_reader *);
+
+static PyObject *
+_flat_read_items(_flat_reader *reader, int tag)
+{
+    Py_ssize_t len = _flat_read_ssize(reader);
+    PyObject *obj;
+    switch (tag) {
+    case _FLAT_TUPLE:
+        obj = PyTuple_New(len);
+        break;
+    case _FLAT_LIST:
+        obj = PyList_New(len);
+        break;
+    case _FLAT_DICT:
+        obj = _PyDict_NewPresized(len);
+        break;
+    default:
+        assert(tag == _FLAT_FROZENSET);
+        obj = PyFrozenSet_New(NULL);
+        break;
+    }
+    if (obj == NULL) {
+        return NULL;
+    }
+
+    for (Py_ssize_t i = 0; i < len; i++) {
+        PyObject *item = _flat_read_object(reader);
+        if (item == NULL) {
             goto error;
         }
-        shared->data[i] = data;
+        if (tag == _FLAT_TUPLE) {
+            PyTuple_SET_ITEM(obj, i, item);
+        }
+        else if (tag == _FLAT_LIST) {
+            PyList_SET_ITEM(obj, i, item);
+        }
+        else if (tag == _FLAT_DICT) {
+            PyObject *value = _flat_read_object(reader);
+            if (value == NULL) {
+                Py_DECREF(item);
+                goto error;
+            }
+            int err = PyDict_SetItem(obj, item, value);
+            Py_DECREF(item);
+            Py_DECREF(value);
+            if (err < 0) {
+                goto error;
+            }
+        }
+        else {
+            int err = PySet_Add(obj, item);
+            Py_DECREF(item);
+            if (err < 0) {
+                goto error;
+            }
+        }
     }
-    _PyCrossInterpreterData_Init(
-            data, tstate->interp, shared, obj, _new_tuple_object);
-    data->free = _tuple_shared_free;
-    return 0;
+    return obj;
 
 error:
-    _tuple_shared_free(shared);
-    return -1;
+    Py_DECREF(obj);
+    return NULL;
+}
+
+static PyObject *
+_flat_read_object(_flat_reader *reader)
+{
+    int tag = *reader->p++;
+    switch (tag) {
+    case _FLAT_NONE:
+        return Py_NewRef(Py_None);
+    case _FLAT_FALSE:
+        Py_RETURN_FALSE;
+    case _FLAT_TRUE:
+        Py_RETURN_TRUE;
+    case _FLAT_INT:
+        return PyLong_FromSsize_t(_flat_read_ssize(reader));
+    case _FLAT_FLOAT: {
+        double value;
+        memcpy(&value, reader->p, sizeof(value));
+        reader->p += sizeof(value);
+        return PyFloat_FromDouble(value);
+    }
+    case _FLAT_STR: {
+        Py_ssize_t len = _flat_read_ssize(reader);
+        int kind = *reader->p++;
+        PyObject *str = PyUnicode_FromKindAndData(kind, reader->p, len);
+        reader->p += len * kind;
+        return str;
+    }
+    case _FLAT_BYTES: {
+        Py_ssize_t len = _flat_read_ssize(reader);
+        PyObject *bytes = PyBytes_FromStringAndSize(reader->p, len);
+        reader->p += len;
+        return bytes;
+    }
+    case _FLAT_XID:
+        return _PyCrossInterpreterData_NewObject(
+                reader->xids[_flat_read_ssize(reader)]);
+    default: {
+        if (Py_EnterRecursiveCall(" while unsharing a container")) {
+            return NULL;
+        }
+        PyObject *obj = _flat_read_items(reader, tag);
+        Py_LeaveRecursiveCall();
+        return obj;
+    }
+    }
+}
+
+static PyObject *
+_new_flat_object(_PyCrossInterpreterData *data)
+{
+    struct _shared_flat_data *shared = (struct _shared_flat_data *)(data->data);
+    _flat_reader reader = {
+        .p = shared->buf,
+        .xids = shared->xids,
+    };
+    return _flat_read_object(&reader);
+}
+
+static int
+_container_shared(PyThreadState *tstate, PyObject *obj,
+                  _PyCrossInterpreterData *data)
+{
+    _flat_writer writer;
+    if (_flat_writer_init(&writer) < 0) {
+        return -1;
+    }
+    if (_flat_write_object(tstate, &writer, obj) < 0) {
+        _flat_shared_free(writer.shared);
+        return -1;
+    }
+    struct _shared_flat_data *shared = writer.shared;
+    _PyCrossInterpreterData_Init(data, tstate->interp, shared, NULL,
+                                 _new_flat_object);
+    _PyCrossInterpreterData_SET_FREE(data, _flat_shared_free);
+    if (shared->nxids == 0) {
+        // Lists and dicts are copied: the receiving interpreter gets
+        // objects which do not depend on this one.
+        _PyCrossInterpreterData_SET_INDEPENDENT(data);
+    }
+    return 0;
 }
 
 // registration
@@ -588,7 +992,22 @@ _register_builtins_for_crossinterpreter_data(struct _xidregistry *xidregistry)
     }
 
     // tuple
-    if (_xidregistry_add_type(xidregistry, &PyTuple_Type, _tuple_shared) != 0) {
+    if (_xidregistry_add_type(xidregistry, &PyTuple_Type, _container_shared) != 0) {
         Py_FatalError("could not register tuple for cross-interpreter sharing");
     }
+
+    // list
+    if (_xidregistry_add_type(xidregistry, &PyList_Type, _container_shared) != 0) {
+        Py_FatalError("could not register list for cross-interpreter sharing");
+    }
+
+    // dict
+    if (_xidregistry_add_type(xidregistry, &PyDict_Type, _container_shared) != 0) {
+        Py_FatalError("could not register dict for cross-interpreter sharing");
+    }
+
+    // frozenset
+    if (_xidregistry_add_type(xidregistry, &PyFrozenSet_Type, _container_shared) != 0) {
+        Py_FatalError("could not register frozenset for cross-interpreter sharing");
+    }
 }
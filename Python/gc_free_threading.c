@@ -388,51 +388,44 @@ gc_visit_thread_stacks(PyInterpreterState *interp)
 }
 
 static void
-merge_queued_objects(_PyThreadStateImpl *tstate, struct collection_state *state)
+merge_queued_object(PyObject *op, struct collection_state *state)
 {
-    struct _brc_thread_state *brc = &tstate->brc;
-    _PyObjectStack_Merge(&brc->local_objects_to_merge, &brc->objects_to_merge);
+    // Subtract one when merging because the queue had a reference.
+    Py_ssize_t refcount = merge_refcount(op, -1);
 
-    PyObject *op;
-    while ((op = _PyObjectStack_Pop(&brc->local_objects_to_merge)) != NULL) {
-        // Subtract one when merging because the queue had a reference.
-        Py_ssize_t refcount = merge_refcount(op, -1);
-
-        if (!_PyObject_GC_IS_TRACKED(op) && refcount == 0) {
-            // GC objects with zero refcount are handled subsequently by the
-            // GC as if they were cyclic trash, but we have to handle dead
-            // non-GC objects here. Add one to the refcount so that we can
-            // decref and deallocate the object once we start the world again.
-            op->ob_ref_shared += (1 << _Py_REF_SHARED_SHIFT);
+    if (!_PyObject_GC_IS_TRACKED(op) && refcount == 0) {
+        // GC objects with zero refcount are handled subsequently by the
+        // GC as if they were cyclic trash, but we have to handle dead
+        // non-GC objects here. Add one to the refcount so that we can
+        // decref and deallocate the object once we start the world again.
+        op->ob_ref_shared += (1 << _Py_REF_SHARED_SHIFT);
 #ifdef Py_REF_DEBUG
-            _Py_IncRefTotal(_PyThreadState_GET());
+        _Py_IncRefTotal(_PyThreadState_GET());
 #endif
-            worklist_push(&state->objs_to_decref, op);
-        }
+        worklist_push(&state->objs_to_decref, op);
     }
 }
 
 static void
-process_delayed_frees(PyInterpreterState *interp)
+merge_queued_objects(_PyThreadStateImpl *tstate, struct collection_state *state)
 {
-    // While we are in a "stop the world" pause, we can observe the latest
-    // write sequence by advancing the write sequence immediately.
-    _Py_qsbr_advance(&interp->qsbr);
-    _PyThreadStateImpl *current_tstate = (_PyThreadStateImpl *)_PyThreadState_GET();
-    _Py_qsbr_quiescent_state(current_tstate->qsbr);
+    struct _brc_thread_state *brc = &tstate->brc;
+    _PyObjectStack_Merge(&brc->local_objects_to_merge, &brc->objects_to_merge);
 
-    // Merge the queues from other threads into our own queue so that we can
-    // process all of the pending delayed free requests at once.
-    HEAD_LOCK(&_PyRuntime);
-    for (PyThreadState *p = interp->threads.head; p != NULL; p = p->next) {
-        _PyThreadStateImpl *other = (_PyThreadStateImpl *)p;
-        if (other != current_tstate) {
-            llist_concat(&current_tstate->mem_free_queue, &other->mem_free_queue);
-        }
+    PyObject *op;
+    while ((op = _PyObjectStack_Pop(&brc->local_objects_to_merge)) != NULL) {
+        merge_queued_object(op, state);
     }
-    HEAD_UNLOCK(&_PyRuntime);
 
-    _PyMem_ProcessDelayed((PyThreadState *)current_tstate);
+    // Also merge the objects this thread queued for other threads but has
+    // not handed over yet.
+    for (int i = 0; i < _Py_BRC_NUM_BATCHES; i++) {
+        struct _brc_batch *batch = &brc->batches[i];
+        for (Py_ssize_t j = 0; j < batch->size; j++) {
+            merge_queued_object(batch->objects[j], state);
+        }
+        batch->size = 0;
+    }
 }
 
 // Subtract an incoming reference from the computed "gc_refs" refcount.
@@ -1229,7 +1222,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
     }
     HEAD_UNLOCK(&_PyRuntime);
 
-    process_delayed_frees(interp);
+    _PyMem_ReclaimDelayed(interp);
 
     // Find unreachable objects
     int err = deduce_unreachable_heap(interp, state);
@@ -1919,7 +1912,10 @@ PyObject_GC_Del(void *op)
     record_deallocation(_PyThreadState_GET());
     PyObject *self = (PyObject *)op;
     if (_PyObject_GC_IS_SHARED_INLINE(self)) {
-        _PyObject_FreeDelayed(((char *)op)-presize);
+        PyTypeObject *type = Py_TYPE(self);
+        size_t size = type->tp_itemsize == 0 ? _PyObject_SIZE(type)
+            : _PyObject_VAR_SIZE(type, Py_ABS(Py_SIZE(self)));
+        _PyObject_FreeDelayed(((char *)op)-presize, presize + size);
     }
     else {
         PyObject_Free(((char *)op)-presize);
@@ -2,6 +2,7 @@
 
 #include "Python.h"
 
+#include "pycore_code.h"          // LOCK_STAT_INC()
 #include "pycore_lock.h"
 #include "pycore_parking_lot.h"
 #include "pycore_semaphore.h"
@@ -28,6 +29,43 @@ static const int MAX_SPIN_COUNT = 40;
 static const int MAX_SPIN_COUNT = 0;
 #endif
 
+// How long to spin is adapted to how long locks are held. A PyMutex is only
+// one byte, so the estimates live in a small table hashed by the address of
+// the mutex. Each estimate is a moving average (scaled by
+// 2**SPIN_ESTIMATE_SHIFT) of the number of spins that ended with the lock
+// acquired. Threads spin up to twice the estimate, plus MIN_SPIN_COUNT,
+// capped by MAX_SPIN_COUNT. When a thread parks, the estimate moves towards
+// zero if other threads were already parked (the lock is contended), and
+// towards twice the spins done otherwise (the lock is held longer than the
+// threads spin), so that it can grow up to MAX_SPIN_COUNT again.
+#define SPIN_ESTIMATE_SHIFT 3
+#define MIN_SPIN_COUNT 4
+#define LOG2_NUM_SPIN_ESTIMATES 6
+#define NUM_SPIN_ESTIMATES (1 << LOG2_NUM_SPIN_ESTIMATES)
+
+static struct {
+    int value;
+    // Keep each estimate on its own cache line
+    char padding[64 - sizeof(int)];
+} spin_estimates[NUM_SPIN_ESTIMATES];
+
+static int *
+spin_estimate(PyMutex *m)
+{
+    // Objects are 16-byte aligned and ob_mutex sits at a fixed offset, so
+    // drop the low bits and use the top bits of a Fibonacci hash.
+    uint64_t h = (uint64_t)((uintptr_t)m >> 4) * UINT64_C(0x9E3779B97F4A7C15);
+    return &spin_estimates[h >> (64 - LOG2_NUM_SPIN_ESTIMATES)].value;
+}
+
+static void
+update_spin_estimate(int *estimate, Py_ssize_t spin_count)
+{
+    int v = _Py_atomic_load_int_relaxed(estimate);
+    v += (int)spin_count - (v >> SPIN_ESTIMATE_SHIFT);
+    _Py_atomic_store_int_relaxed(estimate, v);
+}
+
 struct mutex_entry {
     // The time after which the unlocking thread should hand off lock ownership
     // directly to the waiting thread. Written by the waiting thread.
@@ -73,17 +111,32 @@ _PyMutex_LockTimed(PyMutex *m, PyTime_t timeout, _PyLockFlags flags)
         .handed_off = 0,
     };
 
+    LOCK_STAT_INC(contended);
+    int *estimate = NULL;
+    Py_ssize_t max_spin_count = 0;
+    if (MAX_SPIN_COUNT > 0) {
+        estimate = spin_estimate(m);
+        max_spin_count = 2 * (_Py_atomic_load_int_relaxed(estimate)
+                              >> SPIN_ESTIMATE_SHIFT) + MIN_SPIN_COUNT;
+        max_spin_count = Py_MIN(max_spin_count, MAX_SPIN_COUNT);
+    }
+
     Py_ssize_t spin_count = 0;
+    int parked = 0;
     for (;;) {
         if ((v & _Py_LOCKED) == 0) {
             // The lock is unlocked. Try to grab it.
             if (_Py_atomic_compare_exchange_uint8(&m->_bits, &v, v|_Py_LOCKED)) {
+                if (estimate != NULL && !parked) {
+                    update_spin_estimate(estimate, spin_count);
+                    LOCK_STAT_INC(spin_acquired);
+                }
                 return PY_LOCK_ACQUIRED;
             }
             continue;
         }
 
-        if (!(v & _Py_HAS_PARKED) && spin_count < MAX_SPIN_COUNT) {
+        if (!(v & _Py_HAS_PARKED) && spin_count < max_spin_count) {
             // Spin for a bit.
             _Py_yield();
             spin_count++;
@@ -94,6 +147,14 @@ _PyMutex_LockTimed(PyMutex *m, PyTime_t timeout, _PyLockFlags flags)
             return PY_LOCK_FAILURE;
         }
 
+        if (estimate != NULL && !parked) {
+            // Spinning did not pay off: spin less next time if the lock is
+            // contended, longer if it is only held for long.
+            update_spin_estimate(estimate,
+                                 (v & _Py_HAS_PARKED) ? 0 : 2 * spin_count);
+        }
+        parked = 1;
+
         uint8_t newv = v;
         if (!(v & _Py_HAS_PARKED)) {
             // We are the first waiter. Set the _Py_HAS_PARKED flag.
@@ -103,6 +164,7 @@ _PyMutex_LockTimed(PyMutex *m, PyTime_t timeout, _PyLockFlags flags)
             }
         }
 
+        LOCK_STAT_INC(parked);
         int ret = _PyParkingLot_Park(&m->_bits, &newv, sizeof(newv), timeout,
                                      &entry, (flags & _PY_LOCK_DETACH) != 0);
         if (ret == Py_PARK_OK) {
@@ -146,6 +208,7 @@ mutex_unpark(PyMutex *m, struct mutex_entry *entry, int has_more_waiters)
 
         entry->handed_off = should_be_fair;
         if (should_be_fair) {
+            LOCK_STAT_INC(handoffs);
             v |= _Py_LOCKED;
         }
         if (has_more_waiters) {
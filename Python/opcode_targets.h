@@ -152,8 +152,11 @@ static void *opcode_targets[256] = {
     &&TARGET_BINARY_OP_ADD_FLOAT,
     &&TARGET_BINARY_OP_ADD_INT,
     &&TARGET_BINARY_OP_ADD_UNICODE,
+    &&TARGET_BINARY_OP_EXTEND_LIST,
+    &&TARGET_BINARY_OP_MIXED_INT_FLOAT,
     &&TARGET_BINARY_OP_MULTIPLY_FLOAT,
     &&TARGET_BINARY_OP_MULTIPLY_INT,
+    &&TARGET_BINARY_OP_REMAINDER_UNICODE,
     &&TARGET_BINARY_OP_SUBTRACT_FLOAT,
     &&TARGET_BINARY_OP_SUBTRACT_INT,
     &&TARGET_BINARY_SUBSCR_DICT,
@@ -170,6 +173,8 @@ static void *opcode_targets[256] = {
     &&TARGET_CALL_BUILTIN_O,
     &&TARGET_CALL_ISINSTANCE,
     &&TARGET_CALL_KW_BOUND_METHOD,
+    &&TARGET_CALL_KW_BUILTIN_FAST,
+    &&TARGET_CALL_KW_METHOD_DESCRIPTOR_FAST,
     &&TARGET_CALL_KW_NON_PY,
     &&TARGET_CALL_KW_PY,
     &&TARGET_CALL_LEN,
@@ -195,7 +200,9 @@ static void *opcode_targets[256] = {
     &&TARGET_FOR_ITER_TUPLE,
     &&TARGET_LOAD_ATTR_CLASS,
     &&TARGET_LOAD_ATTR_CLASS_WITH_METACLASS_CHECK,
+    &&TARGET_LOAD_ATTR_DESCRIPTOR_GET,
     &&TARGET_LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN,
+    &&TARGET_LOAD_ATTR_GETATTR_FALLBACK,
     &&TARGET_LOAD_ATTR_INSTANCE_VALUE,
     &&TARGET_LOAD_ATTR_METHOD_LAZY_DICT,
     &&TARGET_LOAD_ATTR_METHOD_NO_DICT,
@@ -228,13 +235,6 @@ static void *opcode_targets[256] = {
     &&TARGET_UNPACK_SEQUENCE_TWO_TUPLE,
     &&_unknown_opcode,
     &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
     &&TARGET_INSTRUMENTED_END_FOR,
     &&TARGET_INSTRUMENTED_END_SEND,
     &&TARGET_INSTRUMENTED_LOAD_SUPER_ATTR,
@@ -5,6 +5,7 @@
 #include "pycore_interp.h"
 #include "pycore_backoff.h"
 #include "pycore_bitutils.h"        // _Py_popcount32()
+#include "pycore_ceval.h"           // _Py_set_eval_breaker_bit()
 #include "pycore_object.h"          // _PyObject_GC_UNTRACK()
 #include "pycore_opcode_metadata.h" // _PyOpcode_OpName[]
 #include "pycore_opcode_utils.h"  // MAX_REAL_OPCODE
@@ -202,6 +203,13 @@ _PyOptimizer_Optimize(
     }
     (*executor_ptr)->vm_data.chain_depth = chain_depth;
     assert((*executor_ptr)->vm_data.valid);
+    if (interp->executor_memory_limit != 0 &&
+        interp->executor_memory > interp->executor_memory_limit)
+    {
+        // Evict cold executors at the next safe point:
+        _Py_set_eval_breaker_bit(_PyThreadState_GET(),
+                                 _PY_EVAL_JIT_INVALIDATE_COLD_BIT);
+    }
     return 1;
 }
 
@@ -258,6 +266,7 @@ uop_dealloc(_PyExecutorObject *self) {
     assert(self->vm_data.code == NULL);
     unlink_executor(self);
 #ifdef _Py_JIT
+    _PyInterpreterState_GET()->executor_memory -= self->jit_size;
     _PyJIT_Free(self);
 #endif
     PyObject_GC_Del(self);
@@ -798,6 +807,8 @@ translate_bytecode_to_trace(
                             assert(i + 1 == nuops);
                             if (opcode == FOR_ITER_GEN ||
                                 opcode == LOAD_ATTR_PROPERTY ||
+                                opcode == LOAD_ATTR_GETATTR_FALLBACK ||
+                                opcode == LOAD_ATTR_DESCRIPTOR_GET ||
                                 opcode == BINARY_SUBSCR_GETITEM ||
                                 opcode == SEND_GEN)
                             {
@@ -1189,17 +1200,18 @@ make_executor_from_uops(_PyUOpInstruction *buffer, int length, const _PyBloomFil
     }
     sanity_check(executor);
 #endif
+    // This is initialized to true so we can prevent the executor
+    // from being immediately detected as cold and invalidated.
+    executor->vm_data.warm = true;
 #ifdef _Py_JIT
     executor->jit_code = NULL;
     executor->jit_side_entry = NULL;
     executor->jit_size = 0;
-    // This is initialized to true so we can prevent the executor
-    // from being immediately detected as cold and invalidated.
-    executor->vm_data.warm = true;
     if (_PyJIT_Compile(executor, executor->trace, length)) {
         Py_DECREF(executor);
         return NULL;
     }
+    _PyInterpreterState_GET()->executor_memory += executor->jit_size;
 #endif
     _PyObject_GC_TRACK(executor);
     return executor;
@@ -1489,6 +1501,12 @@ bloom_filter_may_contain(_PyBloomFilter *bloom, _PyBloomFilter *hashes)
     return true;
 }
 
+static size_t
+executor_memory_size(_PyExecutorObject *executor)
+{
+    return _PyObject_VAR_SIZE(Py_TYPE(executor), Py_SIZE(executor));
+}
+
 static void
 link_executor(_PyExecutorObject *executor)
 {
@@ -1508,6 +1526,7 @@ link_executor(_PyExecutorObject *executor)
         interp->executor_list_head = executor;
     }
     executor->vm_data.linked = true;
+    interp->executor_memory += executor_memory_size(executor);
     /* executor_list_head must be first in list */
     assert(interp->executor_list_head->vm_data.links.previous == NULL);
 }
@@ -1518,6 +1537,7 @@ unlink_executor(_PyExecutorObject *executor)
     if (!executor->vm_data.linked) {
         return;
     }
+    PyInterpreterState *interp = PyInterpreterState_Get();
     _PyExecutorLinkListNode *links = &executor->vm_data.links;
     assert(executor->vm_data.valid);
     _PyExecutorObject *next = links->next;
@@ -1530,11 +1550,12 @@ unlink_executor(_PyExecutorObject *executor)
     }
     else {
         // prev == NULL implies that executor is the list head
-        PyInterpreterState *interp = PyInterpreterState_Get();
         assert(interp->executor_list_head == executor);
         interp->executor_list_head = next;
     }
     executor->vm_data.linked = false;
+    assert(interp->executor_memory >= executor_memory_size(executor));
+    interp->executor_memory -= executor_memory_size(executor);
 }
 
 /* This must be called by optimizers before using the executor */
@@ -1661,15 +1682,34 @@ _Py_Executors_InvalidateAll(PyInterpreterState *interp, int is_invalidation)
     }
 }
 
+static bool
+executors_over_budget(PyInterpreterState *interp)
+{
+    return interp->executor_memory_limit != 0 &&
+           interp->executor_memory > interp->executor_memory_limit;
+}
+
+/* Invalidate all executors that have not run since the last call, then,
+ * if executor memory is still over budget, evict warm executors as well,
+ * oldest first. Together with the warm bit set by _MAKE_WARM, this is a
+ * second-chance approximation of LRU eviction. */
 void
 _Py_Executors_InvalidateCold(PyInterpreterState *interp)
 {
     /* Walk the list of executors */
     /* TO DO -- Use a tree to avoid traversing as many objects */
+    /* Warm executors, newest first. Only needed when there is a budget. */
+    PyObject *warm = NULL;
     PyObject *invalidate = PyList_New(0);
     if (invalidate == NULL) {
         goto error;
     }
+    if (interp->executor_memory_limit != 0) {
+        warm = PyList_New(0);
+        if (warm == NULL) {
+            goto error;
+        }
+    }
 
     /* Clearing an executor can deallocate others, so we need to make a list of
      * executors to invalidate first */
@@ -1677,26 +1717,74 @@ _Py_Executors_InvalidateCold(PyInterpreterState *interp)
         assert(exec->vm_data.valid);
         _PyExecutorObject *next = exec->vm_data.links.next;
 
-        if (!exec->vm_data.warm && PyList_Append(invalidate, (PyObject *)exec) < 0) {
-            goto error;
+        if (!exec->vm_data.warm) {
+            if (PyList_Append(invalidate, (PyObject *)exec) < 0) {
+                goto error;
+            }
         }
         else {
             exec->vm_data.warm = false;
+            if (warm != NULL && PyList_Append(warm, (PyObject *)exec) < 0) {
+                goto error;
+            }
         }
 
         exec = next;
     }
     for (Py_ssize_t i = 0; i < PyList_GET_SIZE(invalidate); i++) {
         _PyExecutorObject *exec = (_PyExecutorObject *)PyList_GET_ITEM(invalidate, i);
-        executor_clear(exec);
+        if (exec->vm_data.valid) {
+            executor_clear(exec);
+            interp->executors_invalidated_cold++;
+        }
+    }
+    if (warm != NULL) {
+        for (Py_ssize_t i = PyList_GET_SIZE(warm) - 1;
+             i >= 0 && executors_over_budget(interp); i--)
+        {
+            _PyExecutorObject *exec = (_PyExecutorObject *)PyList_GET_ITEM(warm, i);
+            if (exec->vm_data.valid) {
+                executor_clear(exec);
+                interp->executors_evicted++;
+            }
+        }
     }
     Py_DECREF(invalidate);
+    Py_XDECREF(warm);
     return;
 error:
     PyErr_Clear();
     Py_XDECREF(invalidate);
+    Py_XDECREF(warm);
     // If we're truly out of memory, wiping out everything is a fine fallback
     _Py_Executors_InvalidateAll(interp, 0);
 }
 
+void
+_Py_Executors_SetMemoryLimit(PyInterpreterState *interp, size_t limit)
+{
+    interp->executor_memory_limit = limit;
+    if (executors_over_budget(interp)) {
+        _Py_Executors_InvalidateCold(interp);
+    }
+}
+
+PyObject *
+_Py_Executors_GetStats(PyInterpreterState *interp)
+{
+    Py_ssize_t count = 0;
+    for (_PyExecutorObject *exec = interp->executor_list_head; exec != NULL;
+         exec = exec->vm_data.links.next)
+    {
+        count++;
+    }
+    return Py_BuildValue(
+        "{snsnsnsnsn}",
+        "executors", count,
+        "memory", (Py_ssize_t)interp->executor_memory,
+        "memory_limit", (Py_ssize_t)interp->executor_memory_limit,
+        "invalidated_cold", (Py_ssize_t)interp->executors_invalidated_cold,
+        "evicted", (Py_ssize_t)interp->executors_evicted);
+}
+
 #endif /* _Py_TIER2 */
@@ -635,6 +635,50 @@ remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
     Py_UNREACHABLE();
 }
 
+static void
+sink_tuple_allocations(_PyUOpInstruction *buffer, int buffer_size)
+{
+    /* A tuple built by _BUILD_TUPLE and unpacked again by the next real
+     * instruction never escapes: nothing else can observe it, and since
+     * there is no side exit in between, tier 1 never needs it to be
+     * materialized. Replace the pair with a permutation of the stack.
+     * Must run after remove_unneeded_uops, so that the only instructions
+     * left between the two are _NOPs and _SET_IPs. */
+    for (int pc = 0; pc < buffer_size; pc++) {
+        _PyUOpInstruction *unpack = &buffer[pc];
+        if (unpack->opcode != _UNPACK_SEQUENCE_TWO_TUPLE &&
+            unpack->opcode != _UNPACK_SEQUENCE_TUPLE)
+        {
+            continue;
+        }
+        int build_pc = pc - 1;
+        while (build_pc >= 0 && (buffer[build_pc].opcode == _NOP ||
+                                 buffer[build_pc].opcode == _SET_IP)) {
+            build_pc--;
+        }
+        if (build_pc < 0) {
+            continue;
+        }
+        _PyUOpInstruction *build = &buffer[build_pc];
+        if (build->opcode != _BUILD_TUPLE || build->oparg != unpack->oparg) {
+            continue;
+        }
+        int oparg = unpack->oparg;
+        assert(unpack->opcode != _UNPACK_SEQUENCE_TWO_TUPLE || oparg == 2);
+        DPRINTF(2, "Sinking tuple of size %d at pc %d\n", oparg, build_pc);
+        REPLACE_OP(build, _NOP, 0, 0);
+        if (oparg == 1) {
+            REPLACE_OP(unpack, _NOP, 0, 0);
+        }
+        else if (oparg <= 3) {
+            REPLACE_OP(unpack, _SWAP, oparg, 0);
+        }
+        else {
+            REPLACE_OP(unpack, _REVERSE, oparg, 0);
+        }
+    }
+}
+
 //  0 - failure, no error raised, just fall back to Tier 1
 // -1 - failure, and raise error
 //  > 0 - length of optimized trace
@@ -665,6 +709,8 @@ _Py_uop_analyze_and_optimize(
     length = remove_unneeded_uops(buffer, length);
     assert(length > 0);
 
+    sink_tuple_allocations(buffer, length);
+
     OPT_STAT_INC(optimizer_successes);
     return length;
 }
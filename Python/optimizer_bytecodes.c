@@ -331,6 +331,23 @@ dummy_func(void) {
         }
     }
 
+    op(_BINARY_OP_MIXED_INT_FLOAT, (left, right -- res)) {
+        (void)left;
+        (void)right;
+        res = sym_new_type(ctx, &PyFloat_Type);
+    }
+
+    op(_BINARY_OP_EXTEND_LIST, (left, right -- res)) {
+        (void)right;
+        res = left;
+    }
+
+    op(_BINARY_OP_REMAINDER_UNICODE, (left, right -- res)) {
+        (void)left;
+        (void)right;
+        res = sym_new_type(ctx, &PyUnicode_Type);
+    }
+
     op(_BINARY_SUBSCR_INIT_CALL, (container, sub -- new_frame: _Py_UOpsAbstractFrame *)) {
         (void)container;
         (void)sub;
@@ -554,6 +571,19 @@ dummy_func(void) {
         ctx->done = true;
     }
 
+    op(_LOAD_ATTR_GETATTR_FRAME, (owner -- new_frame: _Py_UOpsAbstractFrame *)) {
+        (void)owner;
+        new_frame = NULL;
+        ctx->done = true;
+    }
+
+    op(_LOAD_ATTR_DESCRIPTOR_GET_FRAME, (descr/4, owner -- new_frame: _Py_UOpsAbstractFrame *)) {
+        (void)descr;
+        (void)owner;
+        new_frame = NULL;
+        ctx->done = true;
+    }
+
     op(_INIT_CALL_BOUND_METHOD_EXACT_ARGS, (callable, unused, unused[oparg] -- func, self, unused[oparg])) {
         (void)callable;
         func = sym_new_not_null(ctx);
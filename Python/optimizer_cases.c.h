@@ -445,6 +445,50 @@
             break;
         }
 
+        case _BINARY_OP_MIXED_INT_FLOAT: {
+            _Py_UopsSymbol *right;
+            _Py_UopsSymbol *left;
+            _Py_UopsSymbol *res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            (void)left;
+            (void)right;
+            res = sym_new_type(ctx, &PyFloat_Type);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _BINARY_OP_EXTEND_LIST: {
+            _Py_UopsSymbol *right;
+            _Py_UopsSymbol *left;
+            _Py_UopsSymbol *res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            (void)right;
+            res = left;
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _BINARY_OP_REMAINDER_UNICODE: {
+            _Py_UopsSymbol *right;
+            _Py_UopsSymbol *left;
+            _Py_UopsSymbol *res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            (void)left;
+            (void)right;
+            res = sym_new_type(ctx, &PyUnicode_Type);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _GUARD_BOTH_UNICODE: {
             _Py_UopsSymbol *right;
             _Py_UopsSymbol *left;
@@ -1223,6 +1267,30 @@
             break;
         }
 
+        case _LOAD_ATTR_GETATTR_FRAME: {
+            _Py_UopsSymbol *owner;
+            _Py_UOpsAbstractFrame *new_frame;
+            owner = stack_pointer[-1];
+            (void)owner;
+            new_frame = NULL;
+            ctx->done = true;
+            stack_pointer[-1] = (_Py_UopsSymbol *)new_frame;
+            break;
+        }
+
+        case _LOAD_ATTR_DESCRIPTOR_GET_FRAME: {
+            _Py_UopsSymbol *owner;
+            _Py_UOpsAbstractFrame *new_frame;
+            owner = stack_pointer[-1];
+            PyObject *descr = (PyObject *)this_instr->operand;
+            (void)descr;
+            (void)owner;
+            new_frame = NULL;
+            ctx->done = true;
+            stack_pointer[-1] = (_Py_UopsSymbol *)new_frame;
+            break;
+        }
+
         /* _LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN is not a viable micro-op for tier 2 */
 
         case _GUARD_DORV_NO_DICT: {
@@ -2105,6 +2173,24 @@
             break;
         }
 
+        case _CALL_KW_BUILTIN_FAST: {
+            _Py_UopsSymbol *res;
+            res = sym_new_not_null(ctx);
+            stack_pointer[-3 - oparg] = res;
+            stack_pointer += -2 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _CALL_KW_METHOD_DESCRIPTOR_FAST: {
+            _Py_UopsSymbol *res;
+            res = sym_new_not_null(ctx);
+            stack_pointer[-3 - oparg] = res;
+            stack_pointer += -2 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         /* _INSTRUMENTED_CALL_FUNCTION_EX is not a viable micro-op for tier 2 */
 
         case _MAKE_CALLARGS_A_TUPLE: {
@@ -2497,6 +2583,10 @@
             break;
         }
 
+        case _REVERSE: {
+            break;
+        }
+
         case _TIER2_RESUME_CHECK: {
             break;
         }
@@ -658,6 +658,10 @@ init_interpreter(PyInterpreterState *interp,
     (void)_Py_SetOptimizer(interp, NULL);
     interp->executor_list_head = NULL;
     interp->trace_run_counter = JIT_CLEANUP_THRESHOLD;
+    interp->executor_memory = 0;
+    interp->executor_memory_limit = 0;
+    interp->executors_invalidated_cold = 0;
+    interp->executors_evicted = 0;
 #endif
     if (interp != &runtime->_main_interpreter) {
         /* Fix the self-referential, statically initialized fields. */
@@ -2090,6 +2094,11 @@ detach_thread(PyThreadState *tstate, int detached_state)
     // XXX assert(tstate_is_alive(tstate) && tstate_is_bound(tstate));
     assert(_Py_atomic_load_int_relaxed(&tstate->state) == _Py_THREAD_ATTACHED);
     assert(tstate == current_fast_get());
+#ifdef Py_GIL_DISABLED
+    // Don't leave the refcounts of other threads' objects unmerged while
+    // this thread is idle.
+    _Py_brc_flush_idle(tstate);
+#endif
     if (tstate->critical_section != 0) {
         _PyCriticalSection_SuspendAll(tstate);
     }
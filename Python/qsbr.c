@@ -123,9 +123,25 @@ _Py_qsbr_deferred_advance(struct _qsbr_thread_state *qsbr)
         return _Py_qsbr_shared_current(qsbr->shared) + QSBR_INCR;
     }
     qsbr->deferrals = 0;
+    qsbr->deferred_memory = 0;
     return _Py_qsbr_advance(qsbr->shared);
 }
 
+uint64_t
+_Py_qsbr_deferred_advance_for_free(struct _qsbr_thread_state *qsbr,
+                                   size_t size)
+{
+    qsbr->deferred_memory += size;
+    if (qsbr->deferred_memory >= QSBR_FREE_MEM_LIMIT) {
+        // Don't make a lot of memory wait for more deferrals: start its
+        // grace period now.
+        qsbr->deferred_memory = 0;
+        qsbr->deferrals = 0;
+        return _Py_qsbr_advance(qsbr->shared);
+    }
+    return _Py_qsbr_deferred_advance(qsbr);
+}
+
 static uint64_t
 qsbr_poll_scan(struct _qsbr_shared *shared)
 {
@@ -222,6 +222,14 @@ print_object_stats(FILE *out, ObjectStats *stats)
     fprintf(out, "Object method cache collisions: %" PRIu64 "\n", stats->type_cache_collisions);
     fprintf(out, "Object method cache dunder hits: %" PRIu64 "\n", stats->type_cache_dunder_hits);
     fprintf(out, "Object method cache dunder misses: %" PRIu64 "\n", stats->type_cache_dunder_misses);
+    fprintf(out, "Object method cache thread hits: %" PRIu64 "\n", stats->type_cache_thread_hits);
+    fprintf(out, "Object method cache thread misses: %" PRIu64 "\n", stats->type_cache_thread_misses);
+    fprintf(out, "Object BRC queued: %" PRIu64 "\n", stats->brc_queued);
+    fprintf(out, "Object BRC batches: %" PRIu64 "\n", stats->brc_batches);
+    fprintf(out, "Object BRC idle flushes: %" PRIu64 "\n", stats->brc_idle_flushes);
+    fprintf(out, "Object BRC merges: %" PRIu64 "\n", stats->brc_merges);
+    fprintf(out, "Object BRC merged: %" PRIu64 "\n", stats->brc_merged);
+    fprintf(out, "Object BRC merge latency (ns): %" PRIu64 "\n", stats->brc_merge_latency_ns);
 }
 
 static void
@@ -321,6 +329,16 @@ print_rare_event_stats(FILE *out, RareEventStats *stats)
     fprintf(out, "Rare event (watched_globals_modification): %" PRIu64 "\n", stats->watched_globals_modification);
 }
 
+static void
+print_lock_stats(FILE *out, LockStats *stats)
+{
+    fprintf(out, "Lock contended: %" PRIu64 "\n", stats->contended);
+    fprintf(out, "Lock spin acquired: %" PRIu64 "\n", stats->spin_acquired);
+    fprintf(out, "Lock parked: %" PRIu64 "\n", stats->parked);
+    fprintf(out, "Lock handoffs: %" PRIu64 "\n", stats->handoffs);
+    fprintf(out, "Lock NUMA local wakeups: %" PRIu64 "\n", stats->numa_local_wakeups);
+}
+
 static void
 print_stats(FILE *out, PyStats *stats)
 {
@@ -332,6 +350,7 @@ print_stats(FILE *out, PyStats *stats)
     print_optimization_stats(out, &stats->optimization_stats);
 #endif
     print_rare_event_stats(out, &stats->rare_event_stats);
+    print_lock_stats(out, &stats->lock_stats);
 }
 
 void
@@ -563,6 +582,9 @@ _PyCode_Quicken(PyCodeObject *code)
 #define SPEC_FAIL_BINARY_OP_TRUE_DIVIDE_FLOAT           26
 #define SPEC_FAIL_BINARY_OP_TRUE_DIVIDE_OTHER           27
 #define SPEC_FAIL_BINARY_OP_XOR                         28
+#define SPEC_FAIL_BINARY_OP_ADD_LIST                    29
+#define SPEC_FAIL_BINARY_OP_INPLACE_ADD_LIST_OTHER      30
+#define SPEC_FAIL_BINARY_OP_REMAINDER_UNICODE_NOT_TUPLE 31
 
 /* Calls */
 
@@ -946,6 +968,127 @@ instance_has_key(PyObject *obj, PyObject* name)
     return true;
 }
 
+/* Guard that the instance does not shadow the attribute: it must keep its
+ * values inline, and the shared keys must not gain the name.
+ * Returns 0 on failure. */
+static int
+write_inline_values_keys_version(PyObject *owner, _PyLoadMethodCache *lm_cache)
+{
+    PyTypeObject *type = Py_TYPE(owner);
+    if ((type->tp_flags & Py_TPFLAGS_INLINE_VALUES) == 0 ||
+        !_PyObject_InlineValues(owner)->valid)
+    {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_ATTR_NOT_MANAGED_DICT);
+        return 0;
+    }
+    PyDictKeysObject *keys = ((PyHeapTypeObject *)type)->ht_cached_keys;
+    uint32_t keys_version = _PyDictKeys_GetVersionForCurrentState(
+            _PyInterpreterState_GET(), keys);
+    if (keys_version == 0) {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_OUT_OF_VERSIONS);
+        return 0;
+    }
+    write_u32(lm_cache->keys_version, keys_version);
+    return 1;
+}
+
+/* The attribute is neither on the instance nor on the type, so the lookup
+ * always ends in a call to the type's Python __getattr__(self, name). */
+static int
+specialize_getattr_fallback(PyObject *owner, _Py_CODEUNIT *instr)
+{
+    _PyLoadMethodCache *lm_cache = (_PyLoadMethodCache *)(instr + 1);
+    PyTypeObject *type = Py_TYPE(owner);
+    PyObject *getattr = _PyType_Lookup(type, &_Py_ID(__getattr__));
+    if (getattr == NULL) {
+        return 0;
+    }
+    if (!Py_IS_TYPE(getattr, &PyFunction_Type)) {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_OVERRIDDEN);
+        return -1;
+    }
+    if (!function_check_args(getattr, 2, LOAD_ATTR)) {
+        return -1;
+    }
+    if (instr->op.arg & 1) {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_ATTR_METHOD);
+        return -1;
+    }
+    if (_PyInterpreterState_GET()->eval_frame) {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_OTHER);
+        return -1;
+    }
+    uint32_t version = function_get_version(getattr, LOAD_ATTR);
+    if (version == 0) {
+        return -1;
+    }
+    if (!write_inline_values_keys_version(owner, lm_cache)) {
+        return -1;
+    }
+    PyHeapTypeObject *ht = (PyHeapTypeObject *)type;
+    ht->_spec_cache.getattr = getattr;
+    ht->_spec_cache.getattr_version = version;
+    write_u32(lm_cache->type_version, type->tp_version_tag);
+    instr->op.code = LOAD_ATTR_GETATTR_FALLBACK;
+    return 0;
+}
+
+/* An instance of a Python class defining __get__. Whether or not it is a data
+ * descriptor, the instance must not shadow it, so LOAD_ATTR_DESCRIPTOR_GET
+ * only needs to find __get__ again through the descriptor's type. */
+static int
+specialize_python_descriptor_get(PyObject *owner, _Py_CODEUNIT *instr,
+                                 PyObject *descr)
+{
+    _PyLoadMethodCache *lm_cache = (_PyLoadMethodCache *)(instr + 1);
+    PyTypeObject *type = Py_TYPE(owner);
+    PyTypeObject *desc_cls = Py_TYPE(descr);
+    if (!PyType_HasFeature(desc_cls, Py_TPFLAGS_HEAPTYPE)) {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_ATTR_MUTABLE_CLASS);
+        return -1;
+    }
+    PyObject *descr_get = _PyType_Lookup(desc_cls, &_Py_ID(__get__));
+    if (descr_get == NULL) {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_ATTR_MUTABLE_CLASS);
+        return -1;
+    }
+    if (!Py_IS_TYPE(descr_get, &PyFunction_Type)) {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_ATTR_NON_OVERRIDING_DESCRIPTOR);
+        return -1;
+    }
+    if (!function_check_args(descr_get, 3, LOAD_ATTR)) {
+        return -1;
+    }
+    if (instr->op.arg & 1) {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_ATTR_METHOD);
+        return -1;
+    }
+    if (_PyInterpreterState_GET()->eval_frame) {
+        SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_OTHER);
+        return -1;
+    }
+    /* The cached __get__ is only invalidated by PyType_Modified() if the
+     * descriptor's type has a valid version. */
+    if (type_get_version(desc_cls, LOAD_ATTR) == 0) {
+        return -1;
+    }
+    uint32_t version = function_get_version(descr_get, LOAD_ATTR);
+    if (version == 0) {
+        return -1;
+    }
+    if (!write_inline_values_keys_version(owner, lm_cache)) {
+        return -1;
+    }
+    PyHeapTypeObject *ht = (PyHeapTypeObject *)desc_cls;
+    ht->_spec_cache.descr_get = descr_get;
+    ht->_spec_cache.descr_get_version = version;
+    write_u32(lm_cache->type_version, type->tp_version_tag);
+    /* borrowed, kept alive by the owner's type while its version is valid */
+    write_obj(lm_cache->descr, descr);
+    instr->op.code = LOAD_ATTR_DESCRIPTOR_GET;
+    return 0;
+}
+
 static int
 specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* name)
 {
@@ -1047,6 +1190,9 @@ specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* na
             SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_ATTR_NON_OBJECT_SLOT);
             return -1;
         case MUTABLE:
+            if (!shadow && type->tp_getattro == PyObject_GenericGetAttr) {
+                return specialize_python_descriptor_get(owner, instr, descr);
+            }
             SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_ATTR_MUTABLE_CLASS);
             return -1;
         case GETSET_OVERRIDDEN:
@@ -1100,6 +1246,9 @@ specialize_instance_load_attr(PyObject* owner, _Py_CODEUNIT* instr, PyObject* na
             if (shadow) {
                 goto try_instance;
             }
+            if (type->tp_getattro == _Py_slot_tp_getattr_hook) {
+                return specialize_getattr_fallback(owner, instr);
+            }
             return 0;
     }
     Py_UNREACHABLE();
@@ -1669,7 +1818,7 @@ _Py_Specialize_BinarySubscr(
             PySlice_Check(sub) ? SPEC_FAIL_SUBSCR_STRING_SLICE : SPEC_FAIL_OTHER);
         goto fail;
     }
-    if (container_type == &PyDict_Type) {
+    if (container_type == &PyDict_Type || container_type == &_PyFrozenDict_Type) {
         instr->op.code = BINARY_SUBSCR_DICT;
         goto success;
     }
@@ -2113,6 +2262,41 @@ _Py_Specialize_Call(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs)
     }
 }
 
+/* Keyword calls into C. The kwnames tuple is a constant, so a
+ * METH_FASTCALL | METH_KEYWORDS callee can take it as-is; everything else
+ * goes through vectorcall. */
+static int
+specialize_c_call_kw(PyObject *callable, _Py_CODEUNIT *instr)
+{
+    if (PyCFunction_GET_FUNCTION(callable) == NULL) {
+        SPECIALIZATION_FAIL(CALL_KW, SPEC_FAIL_OTHER);
+        return -1;
+    }
+    if ((PyCFunction_GET_FLAGS(callable) &
+         (METH_VARARGS | METH_FASTCALL | METH_NOARGS | METH_O |
+          METH_KEYWORDS | METH_METHOD)) == (METH_FASTCALL | METH_KEYWORDS))
+    {
+        instr->op.code = CALL_KW_BUILTIN_FAST;
+        return 0;
+    }
+    instr->op.code = CALL_KW_NON_PY;
+    return 0;
+}
+
+static int
+specialize_method_descriptor_kw(PyMethodDescrObject *descr, _Py_CODEUNIT *instr)
+{
+    if ((descr->d_method->ml_flags &
+         (METH_VARARGS | METH_FASTCALL | METH_NOARGS | METH_O |
+          METH_KEYWORDS | METH_METHOD)) == (METH_FASTCALL | METH_KEYWORDS))
+    {
+        instr->op.code = CALL_KW_METHOD_DESCRIPTOR_FAST;
+        return 0;
+    }
+    instr->op.code = CALL_KW_NON_PY;
+    return 0;
+}
+
 void
 _Py_Specialize_CallKw(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs)
 {
@@ -2136,6 +2320,12 @@ _Py_Specialize_CallKw(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs)
             fail = -1;
         }
     }
+    else if (PyCFunction_CheckExact(callable)) {
+        fail = specialize_c_call_kw(callable, instr);
+    }
+    else if (Py_IS_TYPE(callable, &PyMethodDescr_Type)) {
+        fail = specialize_method_descriptor_kw((PyMethodDescrObject *)callable, instr);
+    }
     else {
         instr->op.code = CALL_KW_NON_PY;
         fail = 0;
@@ -2160,6 +2350,10 @@ binary_op_fail_kind(int oparg, PyObject *lhs, PyObject *rhs)
     switch (oparg) {
         case NB_ADD:
         case NB_INPLACE_ADD:
+            if (PyList_CheckExact(lhs)) {
+                return oparg == NB_ADD ? SPEC_FAIL_BINARY_OP_ADD_LIST
+                                       : SPEC_FAIL_BINARY_OP_INPLACE_ADD_LIST_OTHER;
+            }
             if (!Py_IS_TYPE(lhs, Py_TYPE(rhs))) {
                 return SPEC_FAIL_BINARY_OP_ADD_DIFFERENT_TYPES;
             }
@@ -2196,6 +2390,9 @@ binary_op_fail_kind(int oparg, PyObject *lhs, PyObject *rhs)
             return SPEC_FAIL_BINARY_OP_POWER;
         case NB_REMAINDER:
         case NB_INPLACE_REMAINDER:
+            if (PyUnicode_CheckExact(lhs)) {
+                return SPEC_FAIL_BINARY_OP_REMAINDER_UNICODE_NOT_TUPLE;
+            }
             return SPEC_FAIL_BINARY_OP_REMAINDER;
         case NB_RSHIFT:
         case NB_INPLACE_RSHIFT:
@@ -2223,6 +2420,13 @@ binary_op_fail_kind(int oparg, PyObject *lhs, PyObject *rhs)
 }
 #endif   // Py_STATS
 
+static bool
+is_mixed_int_float(PyObject *lhs, PyObject *rhs)
+{
+    return (PyLong_CheckExact(lhs) && PyFloat_CheckExact(rhs)) ||
+           (PyFloat_CheckExact(lhs) && PyLong_CheckExact(rhs));
+}
+
 void
 _Py_Specialize_BinaryOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *instr,
                         int oparg, _PyStackRef *locals)
@@ -2235,6 +2439,16 @@ _Py_Specialize_BinaryOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *in
     switch (oparg) {
         case NB_ADD:
         case NB_INPLACE_ADD:
+            if (oparg == NB_INPLACE_ADD && PyList_CheckExact(lhs) &&
+                (PyList_CheckExact(rhs) || PyTuple_CheckExact(rhs)))
+            {
+                instr->op.code = BINARY_OP_EXTEND_LIST;
+                goto success;
+            }
+            if (is_mixed_int_float(lhs, rhs)) {
+                instr->op.code = BINARY_OP_MIXED_INT_FLOAT;
+                goto success;
+            }
             if (!Py_IS_TYPE(lhs, Py_TYPE(rhs))) {
                 break;
             }
@@ -2259,6 +2473,10 @@ _Py_Specialize_BinaryOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *in
             break;
         case NB_MULTIPLY:
         case NB_INPLACE_MULTIPLY:
+            if (is_mixed_int_float(lhs, rhs)) {
+                instr->op.code = BINARY_OP_MIXED_INT_FLOAT;
+                goto success;
+            }
             if (!Py_IS_TYPE(lhs, Py_TYPE(rhs))) {
                 break;
             }
@@ -2273,6 +2491,10 @@ _Py_Specialize_BinaryOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *in
             break;
         case NB_SUBTRACT:
         case NB_INPLACE_SUBTRACT:
+            if (is_mixed_int_float(lhs, rhs)) {
+                instr->op.code = BINARY_OP_MIXED_INT_FLOAT;
+                goto success;
+            }
             if (!Py_IS_TYPE(lhs, Py_TYPE(rhs))) {
                 break;
             }
@@ -2285,6 +2507,13 @@ _Py_Specialize_BinaryOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *in
                 goto success;
             }
             break;
+        case NB_REMAINDER:
+        case NB_INPLACE_REMAINDER:
+            if (PyUnicode_CheckExact(lhs) && PyTuple_CheckExact(rhs)) {
+                instr->op.code = BINARY_OP_REMAINDER_UNICODE;
+                goto success;
+            }
+            break;
     }
     SPECIALIZATION_FAIL(BINARY_OP, binary_op_fail_kind(oparg, lhs, rhs));
     STAT_INC(BINARY_OP, failure);
@@ -2706,7 +2935,7 @@ _Py_Specialize_ContainsOp(_PyStackRef value_st, _Py_CODEUNIT *instr)
     assert(ENABLE_SPECIALIZATION);
     assert(_PyOpcode_Caches[CONTAINS_OP] == INLINE_CACHE_ENTRIES_COMPARE_OP);
     _PyContainsOpCache *cache = (_PyContainsOpCache  *)(instr + 1);
-    if (PyDict_CheckExact(value)) {
+    if (PyDict_CheckExact(value) || _PyFrozenDict_CheckExact(value)) {
         instr->op.code = CONTAINS_OP_DICT;
         goto success;
     }
@@ -19,6 +19,7 @@ Data members:
 #include "pycore_ceval.h"         // _PyEval_SetAsyncGenFinalizer()
 #include "pycore_dict.h"          // _PyDict_GetItemWithError()
 #include "pycore_frame.h"         // _PyInterpreterFrame
+#include "pycore_freelist.h"      // _PyObject_FreeListStats()
 #include "pycore_initconfig.h"    // _PyStatus_EXCEPTION()
 #include "pycore_long.h"          // _PY_LONG_MAX_STR_DIGITS_THRESHOLD
 #include "pycore_modsupport.h"    // _PyModule_CreateInitialized()
@@ -1001,6 +1002,111 @@ sys__is_interned_impl(PyObject *module, PyObject *string)
 }
 
 
+/*[clinic input]
+sys._defer_refcount -> bool
+
+  object: object
+  /
+
+Enable deferred reference counting on the object.
+
+Return True if it was enabled.  Deferred reference counting avoids
+contention on the reference count of objects shared by many threads, but the
+object is then only freed by the garbage collector.  It is only available
+on free-threaded builds, for objects tracked by the garbage collector.
+[clinic start generated code]*/
+
+static int
+sys__defer_refcount_impl(PyObject *module, PyObject *object)
+/*[clinic end generated code: output=92b69075d0a091ae input=831d9aba4a2ea22a]*/
+{
+    return PyUnstable_Object_EnableDeferredRefcount(object);
+}
+
+
+/*[clinic input]
+sys._freelist_stats
+
+Return statistics about the free lists of small objects.
+
+Return a dictionary mapping the name of each free list to a dictionary with
+its current size and capacity, the number of allocations it served (hits),
+of allocations that found it empty (misses), of frees that found it full
+(overflows), and the number of bytes it holds.  On free-threaded builds,
+free lists are per thread and the statistics are those of the current
+thread.
+[clinic start generated code]*/
+
+static PyObject *
+sys__freelist_stats_impl(PyObject *module)
+/*[clinic end generated code: output=c437154b32bad3c4 input=1cfe63cadc400078]*/
+{
+    return _PyObject_FreeListStats(_Py_freelists_GET());
+}
+
+
+/*[clinic input]
+sys._get_qsbr_stats
+
+Return statistics about the memory waiting to be freed after a grace period.
+
+On free-threaded builds, memory that other threads may still be reading is
+freed only once all threads have passed a quiescent state.  The returned
+dictionary has the following keys:
+
+- backlog: bytes currently waiting to be freed
+- reclaimed: total bytes freed after a grace period
+- forced_reclaims: number of times the world was stopped because the
+  backlog exceeded the memory limit
+- memory_limit: the limit set by sys._set_qsbr_memory_limit()
+
+The backlog is updated in batches, so it is approximate.
+[clinic start generated code]*/
+
+static PyObject *
+sys__get_qsbr_stats_impl(PyObject *module)
+/*[clinic end generated code: output=d5c9e0a3a20f8f6a input=b4ba3896d38731f6]*/
+{
+    struct _qsbr_shared *shared = &_PyInterpreterState_GET()->qsbr;
+    Py_ssize_t backlog = _Py_atomic_load_ssize_relaxed(&shared->backlog);
+    return Py_BuildValue(
+        "{snsnsnsn}",
+        "backlog", Py_MAX(backlog, 0),
+        "reclaimed", _Py_atomic_load_ssize_relaxed(&shared->reclaimed),
+        "forced_reclaims",
+        _Py_atomic_load_ssize_relaxed(&shared->forced_reclaims),
+        "memory_limit", _Py_atomic_load_ssize_relaxed(&shared->memory_limit));
+}
+
+
+/*[clinic input]
+sys._set_qsbr_memory_limit
+
+  limit: Py_ssize_t
+  /
+
+Set the limit of memory waiting to be freed after a grace period.
+
+When the memory waiting to be freed exceeds *limit* bytes, the next thread
+to notice stops all threads and frees it at once.  0 disables the limit.
+This only has an effect on free-threaded builds.
+[clinic start generated code]*/
+
+static PyObject *
+sys__set_qsbr_memory_limit_impl(PyObject *module, Py_ssize_t limit)
+/*[clinic end generated code: output=dd2fbb9219edb30d input=1a05bdc254c2487d]*/
+{
+    if (limit < 0) {
+        PyErr_SetString(PyExc_ValueError, "limit must be non-negative");
+        return NULL;
+    }
+    struct _qsbr_shared *shared = &_PyInterpreterState_GET()->qsbr;
+    _Py_atomic_store_ssize_relaxed(&shared->memory_limit, limit);
+    Py_RETURN_NONE;
+}
+
+
+
 /*
  * Cached interned string objects used for calling the profile and
  * trace functions.
@@ -2582,6 +2688,10 @@ static PyMethodDef sys_methods[] = {
     SYS__ENABLELEGACYWINDOWSFSENCODING_METHODDEF
     SYS_INTERN_METHODDEF
     SYS__IS_INTERNED_METHODDEF
+    SYS__DEFER_REFCOUNT_METHODDEF
+    SYS__FREELIST_STATS_METHODDEF
+    SYS__GET_QSBR_STATS_METHODDEF
+    SYS__SET_QSBR_MEMORY_LIMIT_METHODDEF
     SYS_IS_FINALIZING_METHODDEF
     SYS_MDEBUG_METHODDEF
     SYS_SETSWITCHINTERVAL_METHODDEF
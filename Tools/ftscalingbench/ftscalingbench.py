@@ -0,0 +1,216 @@
+# Measure how operations on shared dicts, lists and queues scale with the
+# number of threads.
+#
+# Usage: python Tools/ftscalingbench/ftscalingbench.py [-t THREADS] [BENCH ...]
+#
+# Every benchmark runs the same loop over one container shared by all the
+# threads, first in a single thread and then in THREADS threads at once.
+# The report gives the throughput per thread (in thousands of loop
+# iterations per second) and the speedup of the whole run over the single
+# thread case.  Ideal scaling gives a speedup equal to the number of threads.
+#
+# The results are only meaningful for `--disable-gil` builds: with the GIL
+# the speedup is at most 1.
+
+import argparse
+import os
+import queue
+import sys
+import threading
+import time
+
+# How long each measurement runs, in seconds
+DURATION = 1.0
+
+# Number of loop iterations between two checks of the clock
+BATCH = 1000
+
+SHARED_DICT = {f"key{i}": i for i in range(100)}
+SHARED_INT_DICT = {i: i for i in range(100)}
+SHARED_TUPLE_DICT = {(i, i): i for i in range(100)}
+SHARED_LIST = list(range(100))
+SHARED_QUEUE = queue.SimpleQueue()
+
+BENCHMARKS = {}
+
+
+def register(func):
+    BENCHMARKS[func.__name__] = func
+    return func
+
+
+@register
+def dict_getitem_str(n):
+    d = SHARED_DICT
+    for _ in range(n):
+        d["key10"]
+        d["key90"]
+
+
+@register
+def dict_get_int(n):
+    d = SHARED_INT_DICT
+    for _ in range(n):
+        d.get(10)
+        d.get(1000)
+
+
+@register
+def dict_get_tuple(n):
+    d = SHARED_TUPLE_DICT
+    key = (10, 10)
+    for _ in range(n):
+        d.get(key)
+
+
+@register
+def dict_contains(n):
+    d = SHARED_INT_DICT
+    for _ in range(n):
+        10 in d
+        1000 in d
+
+
+@register
+def dict_iter(n):
+    d = SHARED_DICT
+    for _ in range(n // 10):
+        for _ in d:
+            pass
+
+
+@register
+def dict_items(n):
+    d = SHARED_DICT
+    for _ in range(n // 10):
+        for _ in d.items():
+            pass
+
+
+@register
+def dict_reversed(n):
+    d = SHARED_DICT
+    for _ in range(n // 10):
+        for _ in reversed(d):
+            pass
+
+
+@register
+def list_getitem(n):
+    lst = SHARED_LIST
+    for _ in range(n):
+        lst[10]
+        lst[-1]
+
+
+@register
+def list_slice(n):
+    lst = SHARED_LIST
+    for _ in range(n):
+        lst[10:20]
+        lst[::10]
+
+
+@register
+def list_index(n):
+    lst = SHARED_LIST
+    for _ in range(n):
+        lst.index(10)
+
+
+@register
+def list_count(n):
+    lst = SHARED_LIST
+    for _ in range(n // 10):
+        lst.count(10)
+
+
+@register
+def list_iter(n):
+    lst = SHARED_LIST
+    for _ in range(n // 10):
+        for _ in lst:
+            pass
+
+
+@register
+def simplequeue_put_get(n):
+    # Every thread gets as many items as it puts, so get() never blocks
+    # for long
+    q = SHARED_QUEUE
+    for _ in range(n):
+        q.put(1)
+        q.get()
+
+
+@register
+def simplequeue_batch(n):
+    q = SHARED_QUEUE
+    for _ in range(n // 10):
+        for _ in range(10):
+            q.put(1)
+        for _ in range(10):
+            q.get()
+
+
+def run(func, num_threads):
+    """Return the number of batches each thread completed per second."""
+    counts = [0] * num_threads
+    start = threading.Barrier(num_threads + 1)
+    stop = False
+
+    def worker(idx):
+        start.wait()
+        count = 0
+        while not stop:
+            func(BATCH)
+            count += 1
+        counts[idx] = count
+
+    threads = [threading.Thread(target=worker, args=(i,))
+               for i in range(num_threads)]
+    for t in threads:
+        t.start()
+    start.wait()
+    t0 = time.perf_counter()
+    time.sleep(DURATION)
+    stop = True
+    for t in threads:
+        t.join()
+    elapsed = time.perf_counter() - t0
+    return [c / elapsed for c in counts]
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Measure the thread scaling of operations on shared "
+                    "containers.")
+    parser.add_argument("-t", "--threads", type=int,
+                        default=min(os.cpu_count() or 1, 32),
+                        help="number of threads (default: number of CPUs)")
+    parser.add_argument("benchmarks", nargs="*", metavar="BENCH",
+                        help=f"benchmarks to run (default: all of "
+                             f"{', '.join(BENCHMARKS)})")
+    args = parser.parse_args()
+
+    names = args.benchmarks or list(BENCHMARKS)
+    for name in names:
+        if name not in BENCHMARKS:
+            parser.error(f"unknown benchmark: {name}")
+
+    gil = getattr(sys, "_is_gil_enabled", lambda: True)()
+    print(f"GIL {'enabled' if gil else 'disabled'}, {args.threads} threads")
+    print(f"{'Benchmark':<20}{'1 thread (k/s)':>16}"
+          f"{'per thread (k/s)':>18}{'speedup':>10}")
+    for name in names:
+        func = BENCHMARKS[name]
+        func(BATCH)  # warm up and let the interpreter specialize
+        single = sum(run(func, 1)) * BATCH / 1000
+        rates = run(func, args.threads)
+        per_thread = sum(rates) / len(rates) * BATCH / 1000
+        speedup = per_thread * args.threads / single
+        print(f"{name:<20}{single:>16.0f}{per_thread:>18.0f}{speedup:>10.1f}x")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,7 +1,7 @@
 # Measure the performance of PyMutex and PyThread_type_lock locks
 # with short critical sections.
 #
-# Usage: python Tools/lockbench/lockbench.py [CRITICAL_SECTION_LENGTH]
+# Usage: python Tools/lockbench/lockbench.py [-s SCENARIO] [CRITICAL_SECTION_LENGTH]
 #
 # How to interpret the results:
 #
@@ -17,9 +17,14 @@
 # of times. A fairness of 1/N means that only one thread ever acquired the
 # lock.
 # See https://en.wikipedia.org/wiki/Fairness_measure#Jain's_fairness_index
+#
+# Scenarios: Each scenario sets how much work the threads do while holding
+# the lock and between two acquisitions. "light" contention favors spinning,
+# "heavy" and "long" contention favor parking the waiting threads quickly,
+# and "long" also exercises the handoff to threads that waited too long.
 
+import argparse
 from _testinternalcapi import benchmark_locks
-import sys
 
 # Max number of threads to test
 MAX_THREADS = 10
@@ -27,27 +32,59 @@
 # How much "work" to do while holding the lock
 CRITICAL_SECTION_LENGTH = 1
 
+# name: (critical section length, non-critical length)
+SCENARIOS = {
+    "heavy": (None, 0),
+    "light": (None, 100),
+    "long": (100, 0),
+    "long-light": (100, 1000),
+}
+
 
 def jains_fairness(values):
     # Jain's fairness index
     # See https://en.wikipedia.org/wiki/Fairness_measure
     return (sum(values) ** 2) / (len(values) * sum(x ** 2 for x in values))
 
-def main():
+def run_scenario(name, max_threads, critical_section_length):
+    cs_length, noncritical_length = SCENARIOS[name]
+    if cs_length is None:
+        cs_length = critical_section_length
+    print(f"Scenario: {name} (critical section {cs_length}, "
+          f"non-critical {noncritical_length})")
     print("Lock Type           Threads           Acquisitions (kHz)   Fairness")
     for lock_type in ["PyMutex", "PyThread_type_lock"]:
         use_pymutex = (lock_type == "PyMutex")
-        for num_threads in range(1, MAX_THREADS + 1):
+        for num_threads in range(1, max_threads + 1):
             acquisitions, thread_iters = benchmark_locks(
-                num_threads, use_pymutex, CRITICAL_SECTION_LENGTH)
+                num_threads, use_pymutex, cs_length, 1000,
+                noncritical_length)
 
             acquisitions /= 1000  # report in kHz for readability
             fairness = jains_fairness(thread_iters)
 
             print(f"{lock_type: <20}{num_threads: <18}{acquisitions: >5.0f}{fairness: >20.2f}")
 
+def main():
+    parser = argparse.ArgumentParser(
+        description="Measure the throughput and fairness of locks.")
+    parser.add_argument("-s", "--scenario", action="append",
+                        choices=SCENARIOS,
+                        help="scenario to run, can be repeated "
+                             "(default: heavy)")
+    parser.add_argument("-t", "--threads", type=int, default=MAX_THREADS,
+                        help=f"max number of threads (default: {MAX_THREADS})")
+    parser.add_argument("critical_section_length", type=int, nargs="?",
+                        default=CRITICAL_SECTION_LENGTH,
+                        help="work done while holding the lock in the "
+                             "heavy and light scenarios")
+    args = parser.parse_args()
+
+    for i, name in enumerate(args.scenario or ["heavy"]):
+        if i:
+            print()
+        run_scenario(name, args.threads, args.critical_section_length)
+
 
 if __name__ == "__main__":
-    if len(sys.argv) > 1:
-        CRITICAL_SECTION_LENGTH = int(sys.argv[1])
     main()
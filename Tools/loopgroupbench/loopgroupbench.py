@@ -0,0 +1,112 @@
+# Measure how a connection-heavy asyncio server scales with the number of
+# event loops of an asyncio.LoopGroup.
+#
+# Usage: python Tools/loopgroupbench/loopgroupbench.py [-n CONNECTIONS]
+#                                                      [-c CONCURRENCY]
+#                                                      [WORKERS ...]
+#
+# An echo server is started with reuse_port=True on each event loop of the
+# group, so that the kernel spreads the incoming connections over the
+# loops.  Clients, also run by the group, open CONNECTIONS short-lived
+# connections, each sending one message and waiting for the reply.  The
+# report gives the number of connections per second for each number of
+# workers.
+#
+# The event loops only run in parallel on the free-threaded build: with the
+# GIL, more workers only add overhead.
+
+import argparse
+import asyncio
+import socket
+import sys
+import time
+
+# Total number of connections
+CONNECTIONS = 5000
+
+# Number of connections opened concurrently by the clients of each loop
+CONCURRENCY = 100
+
+MESSAGE = b"x" * 64
+
+
+async def echo(reader, writer):
+    data = await reader.read(4096)
+    writer.write(data)
+    await writer.drain()
+    writer.close()
+
+
+async def start_server(port):
+    return await asyncio.start_server(echo, "127.0.0.1", port,
+                                      reuse_port=True)
+
+
+async def connect(port):
+    reader, writer = await asyncio.open_connection("127.0.0.1", port)
+    writer.write(MESSAGE)
+    await reader.readexactly(len(MESSAGE))
+    writer.close()
+    await writer.wait_closed()
+
+
+async def clients(port, connections, concurrency):
+    sem = asyncio.Semaphore(concurrency)
+
+    async def client():
+        async with sem:
+            await connect(port)
+
+    async with asyncio.TaskGroup() as tg:
+        for _ in range(connections):
+            tg.create_task(client())
+
+
+def reserve_port():
+    # Keep a socket bound to the port until the servers are started, so
+    # that no other process can take it.
+    sock = socket.socket()
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEPORT, 1)
+    sock.bind(("127.0.0.1", 0))
+    return sock
+
+
+def bench(workers, connections, concurrency):
+    with asyncio.LoopGroup(workers) as group:
+        with reserve_port() as sock:
+            port = sock.getsockname()[1]
+            servers = [fut.result()
+                       for fut in group.submit_each(start_server, port)]
+
+        start = time.perf_counter()
+        futures = [group.submit(clients(port, connections // workers,
+                                        concurrency))
+                   for _ in range(workers)]
+        for fut in futures:
+            fut.result()
+        elapsed = time.perf_counter() - start
+
+        for server in servers:
+            server.get_loop().call_soon_threadsafe(server.close)
+    return elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-n", "--connections", type=int, default=CONNECTIONS)
+    parser.add_argument("-c", "--concurrency", type=int,
+                        default=CONCURRENCY)
+    parser.add_argument("workers", nargs="*", type=int, default=[1, 2, 4])
+    args = parser.parse_args()
+
+    gil = sys._is_gil_enabled() if hasattr(sys, "_is_gil_enabled") else True
+    print(f"GIL {'enabled' if gil else 'disabled'}, "
+          f"{args.connections} connections")
+    for workers in args.workers:
+        elapsed = bench(workers, args.connections, args.concurrency)
+        print(f"{workers:3} workers: {args.connections / elapsed:8.0f} "
+              f"connections/sec")
+
+
+if __name__ == "__main__":
+    main()
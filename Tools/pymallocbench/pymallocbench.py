@@ -0,0 +1,73 @@
+# Measure the cost of random accesses to many small objects allocated by
+# pymalloc, to compare builds with and without --with-pymalloc-hugepages.
+#
+# Usage: python Tools/pymallocbench/pymallocbench.py [-n OBJECTS] [-r ROUNDS]
+#
+# The benchmark allocates OBJECTS small objects spread over many arenas and
+# then reads them in a random order, so that most accesses touch a different
+# page than the previous one.  The report gives the number of accesses per
+# second.  With 4 KiB pages the working set is much larger than what the TLB
+# covers; with huge pages each arena needs a single TLB entry.
+#
+# To see the TLB misses directly, run the benchmark under perf:
+#
+#     perf stat -e dTLB-loads,dTLB-load-misses \
+#         python Tools/pymallocbench/pymallocbench.py
+#
+# Run it with PYTHONMALLOC=pymalloc so that a debug build does not add its
+# debug hooks, and compare the "arenas" line of sys._debugmallocstats()
+# between the two builds to check the arena size.
+
+import argparse
+import random
+import time
+
+# Number of objects to allocate
+OBJECTS = 2_000_000
+
+# Number of passes over the objects
+ROUNDS = 5
+
+
+class Node:
+    __slots__ = ("value",)
+
+    def __init__(self, value):
+        self.value = value
+
+
+def run(num_objects, rounds):
+    nodes = [Node(i) for i in range(num_objects)]
+    order = list(range(num_objects))
+    random.Random(0).shuffle(order)
+    # Access the objects through a shuffled list of references, so the loop
+    # itself stays sequential and only the object accesses are random.
+    shuffled = [nodes[i] for i in order]
+    del nodes, order
+
+    best = float("inf")
+    for _ in range(rounds):
+        t0 = time.perf_counter()
+        total = 0
+        for node in shuffled:
+            total += node.value
+        best = min(best, time.perf_counter() - t0)
+    return num_objects / best
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Measure random accesses to small pymalloc objects.")
+    parser.add_argument("-n", "--objects", type=int, default=OBJECTS,
+                        help=f"number of objects (default: {OBJECTS})")
+    parser.add_argument("-r", "--rounds", type=int, default=ROUNDS,
+                        help=f"number of passes, the best one is reported "
+                             f"(default: {ROUNDS})")
+    args = parser.parse_args()
+
+    rate = run(args.objects, args.rounds)
+    print(f"{args.objects} objects: {rate / 1e6:.1f} M accesses/s")
+
+
+if __name__ == "__main__":
+    main()
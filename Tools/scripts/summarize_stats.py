@@ -429,6 +429,17 @@ def get_object_stats(self) -> dict[str, tuple[int, int]]:
                 result[label] = (value, den)
         return result
 
+    def get_lock_stats(self) -> dict[str, tuple[int, int | None]]:
+        contended = self._data.get("Lock contended", 0)
+        result = {}
+        for key, value in self._data.items():
+            if key.startswith("Lock "):
+                label = key[5:]
+                label = label[0].upper() + label[1:]
+                den = None if key == "Lock contended" else contended
+                result[label] = (value, den)
+        return result
+
     def get_gc_stats(self) -> list[dict[str, int]]:
         gc_stats: list[dict[str, int]] = []
         for key, value in self._data.items():
@@ -1137,6 +1148,33 @@ def calc_gc_stats(stats: Stats) -> Rows:
     )
 
 
+def lock_stats_section() -> Section:
+    def calc_lock_stats_table(stats: Stats) -> Rows:
+        lock_stats = stats.get_lock_stats()
+        return [
+            (label, Count(value), Ratio(value, den))
+            for label, (value, den) in lock_stats.items()
+        ]
+
+    return Section(
+        "Lock stats",
+        "Contention on PyMutex locks",
+        [
+            Table(
+                ("", "Count:", "Ratio:"),
+                calc_lock_stats_table,
+                JoinMode.CHANGE,
+            )
+        ],
+        doc="""
+        "Contended" counts acquisitions that found the lock held. The ratios
+        are relative to it. "Spin acquired" acquisitions never parked; a
+        high ratio means the adaptive spinning works. "Handoffs" are unlocks
+        that passed the lock directly to a waiter that had waited too long.
+        """,
+    )
+
+
 def optimization_section() -> Section:
     def calc_optimization_table(stats: Stats) -> Rows:
         optimization_stats = stats.get_optimization_stats()
@@ -1306,6 +1344,7 @@ def calc_rows(stats: Stats) -> Rows:
     call_stats_section(),
     object_stats_section(),
     gc_stats_section(),
+    lock_stats_section(),
     optimization_section(),
     rare_event_section(),
     meta_stats_section(),
@@ -0,0 +1,176 @@
+# Compare the epoll and io_uring asyncio event loops with an echo benchmark,
+# counting the system calls needed per request.
+#
+# Usage: python Tools/uringbench/uringbench.py [-c CLIENTS] [-n REQUESTS]
+#                                              [--strace] [LOOP ...]
+#
+# CLIENTS connections each send a small message REQUESTS times to an echo
+# server running in the same event loop, and wait for the reply before
+# sending the next one.  The report gives the number of requests per second
+# and the number of loop iterations per request.
+#
+# Each iteration of the selector loop is an epoll_wait() call, and every
+# read and write is one more system call.  The io_uring loop submits the
+# reads and writes started during an iteration with the io_uring_enter()
+# call which also waits for the completions, so the number of iterations is
+# close to its number of system calls.
+#
+# With --strace, each loop runs in a child process under strace, and the
+# report also gives the total number of system calls per request made while
+# the clients run.
+
+import argparse
+import asyncio
+import os
+import selectors
+import subprocess
+import sys
+import tempfile
+import time
+
+# Number of concurrent connections
+CLIENTS = 10
+
+# Number of requests per connection
+REQUESTS = 2000
+
+MESSAGE = b"x" * 64
+
+START_MARKER = b"uringbench-start"
+STOP_MARKER = b"uringbench-stop"
+
+LOOPS = {
+    "epoll": lambda: asyncio.SelectorEventLoop(selectors.EpollSelector()),
+    "io_uring": lambda: asyncio.IoUringEventLoop(),
+}
+
+
+async def echo(reader, writer):
+    while data := await reader.read(4096):
+        writer.write(data)
+    writer.close()
+
+
+async def client(port, requests):
+    reader, writer = await asyncio.open_connection("127.0.0.1", port)
+    for _ in range(requests):
+        writer.write(MESSAGE)
+        await reader.readexactly(len(MESSAGE))
+    writer.close()
+    await writer.wait_closed()
+
+
+async def bench(clients, requests, counter, marker_fd):
+    server = await asyncio.start_server(echo, "127.0.0.1", 0)
+    port = server.sockets[0].getsockname()[1]
+    if marker_fd is not None:
+        os.write(marker_fd, START_MARKER)
+    counter[0] = 0
+    t0 = time.perf_counter()
+    async with asyncio.TaskGroup() as tg:
+        for _ in range(clients):
+            tg.create_task(client(port, requests))
+    elapsed = time.perf_counter() - t0
+    iterations = counter[0]
+    if marker_fd is not None:
+        os.write(marker_fd, STOP_MARKER)
+    server.close()
+    await server.wait_closed()
+    return elapsed, iterations
+
+
+def run(name, clients, requests, marker_fd=None):
+    """Return the requests per second and the loop iterations per request."""
+    loop = LOOPS[name]()
+    # Count the calls to the selector or the proactor
+    counter = [0]
+    selector = loop._selector
+    select = selector.select
+
+    def counting_select(timeout=None):
+        counter[0] += 1
+        return select(timeout)
+
+    selector.select = counting_select
+    try:
+        elapsed, iterations = loop.run_until_complete(
+            bench(clients, requests, counter, marker_fd))
+    finally:
+        loop.close()
+    total = clients * requests
+    return total / elapsed, iterations / total
+
+
+def count_syscalls(trace_file):
+    # Count the system calls between the markers.  A call interrupted by
+    # a thread switch is printed as "<unfinished ...>" and then "resumed".
+    count = None
+    with open(trace_file, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            if START_MARKER.decode() in line:
+                count = 0
+            elif STOP_MARKER.decode() in line:
+                break
+            elif count is not None:
+                if "resumed>" in line or line.split(None, 1)[-1][:3] in ("+++", "---"):
+                    continue
+                count += 1
+    return count
+
+
+def run_strace(name, clients, requests):
+    with tempfile.TemporaryDirectory() as tmpdir:
+        trace_file = os.path.join(tmpdir, "trace")
+        cmd = ["strace", "-f", "-qq", "-s", "32", "-o", trace_file,
+               sys.executable, __file__, "--child",
+               "-c", str(clients), "-n", str(requests), name]
+        subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL)
+        return count_syscalls(trace_file) / (clients * requests)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare the epoll and io_uring asyncio event loops.")
+    parser.add_argument("-c", "--clients", type=int, default=CLIENTS,
+                        help=f"number of connections (default: {CLIENTS})")
+    parser.add_argument("-n", "--requests", type=int, default=REQUESTS,
+                        help=f"requests per connection (default: {REQUESTS})")
+    parser.add_argument("--strace", action="store_true",
+                        help="count all the system calls with strace")
+    parser.add_argument("--child", action="store_true",
+                        help=argparse.SUPPRESS)
+    parser.add_argument("loops", nargs="*", metavar="LOOP",
+                        help=f"event loops to run (default: all of "
+                             f"{', '.join(LOOPS)})")
+    args = parser.parse_args()
+
+    names = args.loops or list(LOOPS)
+    for name in names:
+        if name not in LOOPS:
+            parser.error(f"unknown event loop: {name}")
+
+    if args.child:
+        marker_fd = os.open(os.devnull, os.O_WRONLY)
+        for name in names:
+            run(name, args.clients, args.requests, marker_fd)
+        return
+
+    print(f"{args.clients} clients, {args.requests} requests per client")
+    header = f"{'Loop':<12}{'requests/s':>12}{'iterations/request':>20}"
+    if args.strace:
+        header += f"{'syscalls/request':>18}"
+    print(header)
+    for name in names:
+        try:
+            rate, iterations = run(name, args.clients, args.requests)
+        except OSError as exc:
+            print(f"{name:<12}unavailable: {exc}")
+            continue
+        line = f"{name:<12}{rate:>12.0f}{iterations:>20.2f}"
+        if args.strace:
+            line += f"{run_strace(name, args.clients, args.requests):>18.2f}"
+        print(line)
+
+
+if __name__ == "__main__":
+    main()